@@ -49,6 +49,9 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QTime>
 #include <QtCore/QDataStream>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+#include <QtCore/QtEndian>
 
 #if defined(Q_OS_WIN)
 #include <QtCore/QLibrary>
@@ -74,6 +77,15 @@ namespace QtLP_Private
 
 const char* QtLocalPeer::ack = "ack";
 
+// Messages are sent as one frame: quint32 length followed by UTF-8 payload,
+// batched messages are separated by '\0' in the payload
+static const char messageSeparator = '\0';
+static const quint32 maxFrameSize = 1024 * 1024;
+// Clients that don't send complete frame in time are disconnected
+static const int connectionTimeoutMsecs = 2000;
+// Object name of the per-connection timeout timer
+static const char connectionTimerName[] = "qtlocalpeer_timeout";
+
 QtLocalPeer::QtLocalPeer(QObject* parent, const QString &appId)
     : QObject(parent), id(appId)
 {
@@ -144,17 +156,29 @@ bool QtLocalPeer::isClient()
 
 
 bool QtLocalPeer::sendMessage(const QString &message, int timeout)
+{
+    return sendMessages(QStringList() << message, timeout);
+}
+
+bool QtLocalPeer::sendMessages(const QStringList &messages, int timeout)
 {
     if (!isClient()) {
         return false;
     }
 
+    // Timeout is for the whole exchange, not for each step
+    QElapsedTimer timer;
+    timer.start();
+    auto remaining = [&timer, timeout]() {
+        return int(qMax(qint64(0), timeout - timer.elapsed()));
+    };
+
     QLocalSocket socket;
     bool connOk = false;
     for (int i = 0; i < 2; i++) {
         // Try twice, in case the other instance is just starting up
         socket.connectToServer(socketName);
-        connOk = socket.waitForConnected(timeout / 2);
+        connOk = socket.waitForConnected(remaining() / 2);
         if (connOk || i) {
             break;
         }
@@ -170,11 +194,11 @@ bool QtLocalPeer::sendMessage(const QString &message, int timeout)
         return false;
     }
 
-    QByteArray uMsg(message.toUtf8());
+    QByteArray uMsg(messages.join(QLatin1Char(messageSeparator)).toUtf8());
     QDataStream ds(&socket);
     ds.writeBytes(uMsg.constData(), uMsg.size());
-    bool res = socket.waitForBytesWritten(timeout);
-    res &= socket.waitForReadyRead(timeout);   // wait for ack
+    bool res = socket.waitForBytesWritten(remaining());
+    res &= socket.waitForReadyRead(remaining());   // wait for ack
     res &= (socket.read(qstrlen(ack)) == ack);
     return res;
 }
@@ -186,35 +210,75 @@ void QtLocalPeer::removeLockedFile()
 
 void QtLocalPeer::receiveConnection()
 {
-    QLocalSocket* socket = server->nextPendingConnection();
+    // Never block here, the frame is read from readyRead() as it arrives
+    while (QLocalSocket* socket = server->nextPendingConnection()) {
+        QTimer* timer = new QTimer(socket);
+        timer->setObjectName(QLatin1String(connectionTimerName));
+        timer->setSingleShot(true);
+        connect(timer, SIGNAL(timeout()), this, SLOT(connectionTimeout()));
+        timer->start(connectionTimeoutMsecs);
+
+        connect(socket, SIGNAL(readyRead()), this, SLOT(readFromSocket()));
+        connect(socket, SIGNAL(disconnected()), socket, SLOT(deleteLater()));
+
+        readMessage(socket);
+    }
+}
+
+void QtLocalPeer::readFromSocket()
+{
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(sender());
+    if (socket) {
+        readMessage(socket);
+    }
+}
+
+void QtLocalPeer::connectionTimeout()
+{
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(sender()->parent());
     if (!socket) {
         return;
     }
 
-    while (socket->bytesAvailable() < (int)sizeof(quint32)) {
-        socket->waitForReadyRead();
-    }
-    QDataStream ds(socket);
-    QByteArray uMsg;
-    quint32 remaining;
-    ds >> remaining;
-    uMsg.resize(remaining);
-    int got = 0;
-    char* uMsgBuf = uMsg.data();
-    do {
-        got = ds.readRawData(uMsgBuf, remaining);
-        remaining -= got;
-        uMsgBuf += got;
-    }
-    while (remaining && got >= 0 && socket->waitForReadyRead(2000));
-    if (got < 0) {
-        qWarning("QtLocalPeer: Message reception failed %s", qPrintable(socket->errorString()));
-        delete socket;
+    qWarning("QtLocalPeer: Client did not send message in time");
+    socket->abort();
+    socket->deleteLater();
+}
+
+void QtLocalPeer::readMessage(QLocalSocket* socket)
+{
+    if (socket->bytesAvailable() < qint64(sizeof(quint32))) {
+        return;
+    }
+
+    quint32 size;
+    socket->peek(reinterpret_cast<char*>(&size), sizeof(quint32));
+    size = qFromBigEndian(size);
+
+    if (size > maxFrameSize) {
+        qWarning("QtLocalPeer: Message too large (%u bytes)", size);
+        socket->abort();
+        socket->deleteLater();
         return;
     }
-    QString message(QString::fromUtf8(uMsg));
+
+    if (socket->bytesAvailable() < qint64(sizeof(quint32) + size)) {
+        return;
+    }
+
+    socket->read(sizeof(quint32));
+    const QByteArray uMsg = socket->read(size);
+
+    // Frame is complete, the client no longer needs to be timed out
+    delete socket->findChild<QTimer*>(QLatin1String(connectionTimerName));
+
+    // Acknowledge before handling the messages, so the client doesn't wait for us
+    disconnect(socket, SIGNAL(readyRead()), this, SLOT(readFromSocket()));
     socket->write(ack, qstrlen(ack));
-    socket->waitForBytesWritten(1000);
-    delete socket;
-    emit messageReceived(message); //### (might take a long time to return)
+    socket->flush();
+    socket->disconnectFromServer();
+
+    foreach (const QString &message, QString::fromUtf8(uMsg).split(QLatin1Char(messageSeparator))) {
+        emit messageReceived(message);
+    }
 }
@@ -48,6 +48,7 @@
 #include <QtNetwork/QLocalServer>
 #include <QtNetwork/QLocalSocket>
 #include <QtCore/QDir>
+#include <QtCore/QStringList>
 
 #if defined(Q_OS_HAIKU) || defined(Q_OS_OS2)
 #include <unistd.h>
@@ -66,6 +67,7 @@ public:
     QtLocalPeer(QObject* parent = 0, const QString &appId = QString());
     bool isClient();
     bool sendMessage(const QString &message, int timeout);
+    bool sendMessages(const QStringList &messages, int timeout);
     QString applicationId() const
     { return id; }
     void removeLockedFile();
@@ -75,6 +77,8 @@ Q_SIGNALS:
 
 protected Q_SLOTS:
     void receiveConnection();
+    void readFromSocket();
+    void connectionTimeout();
 
 protected:
     QString id;
@@ -83,5 +87,7 @@ protected:
     QtLP_Private::QtLockedFile lockFile;
 
 private:
+    void readMessage(QLocalSocket* socket);
+
     static const char* ack;
 };
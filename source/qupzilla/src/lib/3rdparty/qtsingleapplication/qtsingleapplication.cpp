@@ -227,6 +227,22 @@ bool QtSingleApplication::sendMessage(const QString &message, int timeout)
 #endif
 }
 
+/*!
+    Sends all \a messages to the currently running instance in one
+    connection. The messageReceived() signal is emitted for each of
+    them, in order.
+
+    \sa sendMessage()
+*/
+bool QtSingleApplication::sendMessages(const QStringList &messages, int timeout)
+{
+#ifdef Q_OS_HAIKU
+    return false;
+#else
+    return (peer && peer->sendMessages(messages, timeout));
+#endif
+}
+
 
 /*!
     Returns the application identifier. Two processes with the same
@@ -88,6 +88,7 @@ public:
 
 public Q_SLOTS:
     bool sendMessage(const QString &message, int timeout = 5000);
+    bool sendMessages(const QStringList &messages, int timeout = 5000);
     void activateWindow();
 
 
@@ -105,7 +105,7 @@ void AdBlockIcon::updateBadgeText()
     if (!view) {
         return;
     }
-    const int count = AdBlockManager::instance()->blockedRequestsForUrl(view->url()).count();
+    const int count = AdBlockManager::instance()->blockedRequestsCount(view->url());
     if (count > 0) {
         setBadgeText(QString::number(count));
     } else {
@@ -27,16 +27,21 @@
 #include "browserwindow.h"
 #include "settings.h"
 #include "networkmanager.h"
+#include "tracerecorder.h"
+#include "scripts.h"
 
 #include <QAction>
 #include <QDateTime>
 #include <QTextStream>
 #include <QDir>
 #include <QTimer>
+#include <QSet>
 #include <QMessageBox>
 #include <QUrlQuery>
 #include <QMutexLocker>
 #include <QSaveFile>
+#include <QWebEngineProfile>
+#include <QWebEngineScriptCollection>
 
 //#define ADBLOCK_DEBUG
 
@@ -46,15 +51,28 @@
 
 Q_GLOBAL_STATIC(AdBlockManager, qz_adblock_manager)
 
+// Decisions for longer urls are not cached
+static const int maxCachedUrlLength = 2048;
+
 AdBlockManager::AdBlockManager(QObject* parent)
     : QObject(parent)
     , m_loaded(false)
     , m_enabled(true)
     , m_matcher(new AdBlockMatcher(this))
     , m_interceptor(new AdBlockUrlInterceptor(this))
+    , m_drainTimer(new QTimer(this))
+    , m_decisionCache(2048)
+    , m_firstPartyCache(64)
+    , m_decisionCacheHits(0)
+    , m_decisionCacheMisses(0)
 {
     qRegisterMetaType<AdBlockedRequest>();
 
+    // Blocked requests are reported at most once per frame
+    m_drainTimer->setSingleShot(true);
+    m_drainTimer->setInterval(16);
+    connect(m_drainTimer, &QTimer::timeout, this, &AdBlockManager::drainBlockedRequests);
+
     load();
 }
 
@@ -92,6 +110,33 @@ void AdBlockManager::setEnabled(bool enabled)
     } else {
         m_matcher->clear();
     }
+
+    updateElementHidingScript();
+}
+
+quint64 AdBlockManager::decisionCacheHits() const
+{
+    QMutexLocker locker(const_cast<QMutex*>(&m_mutex));
+    return m_decisionCacheHits;
+}
+
+quint64 AdBlockManager::decisionCacheMisses() const
+{
+    QMutexLocker locker(const_cast<QMutex*>(&m_mutex));
+    return m_decisionCacheMisses;
+}
+
+bool AdBlockManager::canBeBlockedCached(const QUrl &firstPartyUrl, quint64 generation)
+{
+    // Document exception rules may match the full first party url
+    const Decision* decision = m_firstPartyCache.object(firstPartyUrl);
+    if (decision && decision->generation == generation) {
+        return decision->canBeBlocked;
+    }
+
+    const bool result = canBeBlocked(firstPartyUrl);
+    m_firstPartyCache.insert(firstPartyUrl, new Decision{nullptr, result, generation});
+    return result;
 }
 
 QList<AdBlockSubscription*> AdBlockManager::subscriptions() const
@@ -111,15 +156,53 @@ bool AdBlockManager::block(QWebEngineUrlRequestInfo &request, QString &ruleFilte
     QElapsedTimer timer;
     timer.start();
 #endif
-    const QString urlString = request.requestUrl().toEncoded().toLower();
-    const QString urlDomain = request.requestUrl().host().toLower();
-    const QString urlScheme = request.requestUrl().scheme().toLower();
+    const QUrl requestUrl = request.requestUrl();
+    const QString urlScheme = requestUrl.scheme().toLower();
+
+    if (!canRunOnScheme(urlScheme)) {
+        return false;
+    }
 
-    if (!canRunOnScheme(urlScheme) || !canBeBlocked(request.firstPartyUrl())) {
+    // The same resources are requested repeatedly, so cache the matcher decisions.
+    // Matching depends only on the url, first party host and resource type.
+    const quint64 generation = m_matcher->generation();
+
+    if (!canBeBlockedCached(request.firstPartyUrl(), generation)) {
         return false;
     }
 
-    const AdBlockRule* blockedRule = m_matcher->match(request, urlDomain, urlString);
+    const QString urlString = requestUrl.toEncoded().toLower();
+
+    // Full url is part of the key, long (data) urls are not worth keeping in memory
+    const bool cacheable = urlString.size() <= maxCachedUrlLength;
+
+    DecisionKey key;
+    if (cacheable) {
+        key.url = urlString;
+        key.firstPartyHost = request.firstPartyUrl().host().toLower();
+        key.resourceType = request.resourceType();
+    }
+
+    const AdBlockRule* blockedRule;
+    const Decision* decision = cacheable ? m_decisionCache.object(key) : nullptr;
+
+    if (decision && decision->generation == generation) {
+        blockedRule = decision->rule;
+        ++m_decisionCacheHits;
+    }
+    else {
+        const QString urlDomain = requestUrl.host().toLower();
+        blockedRule = m_matcher->match(request, urlDomain, urlString);
+        if (cacheable) {
+            m_decisionCache.insert(key, new Decision{blockedRule, true, generation});
+        }
+        ++m_decisionCacheMisses;
+    }
+
+    const quint64 lookups = m_decisionCacheHits + m_decisionCacheMisses;
+    if (lookups % 1024 == 0 && TraceRecorder::instance()->isEnabled()) {
+        TraceRecorder::instance()->counterEvent("AdBlock decision cache hit rate", qint64(m_decisionCacheHits * 100 / lookups));
+    }
 
     if (blockedRule) {
         ruleFilter = blockedRule->filter();
@@ -141,8 +224,15 @@ QVector<AdBlockedRequest> AdBlockManager::blockedRequestsForUrl(const QUrl &url)
     return m_blockedRequests.value(url);
 }
 
+int AdBlockManager::blockedRequestsCount(const QUrl &url) const
+{
+    return m_blockedRequestsCount.value(url);
+}
+
 void AdBlockManager::clearBlockedRequestsForUrl(const QUrl &url)
 {
+    m_blockedRequestsCount.remove(url);
+
     if (m_blockedRequests.remove(url)) {
         emit blockedRequestsChanged(url);
     }
@@ -235,6 +325,7 @@ bool AdBlockManager::removeSubscription(AdBlockSubscription* subscription)
     m_subscriptions.removeOne(subscription);
 
     m_matcher->update();
+    updateElementHidingScript();
     delete subscription;
 
     return true;
@@ -255,6 +346,8 @@ AdBlockCustomList* AdBlockManager::customList() const
 
 void AdBlockManager::load()
 {
+    TraceScope trace("AdBlockManager::load", "adblock");
+
     QMutexLocker locker(&m_mutex);
 
     if (m_loaded) {
@@ -274,6 +367,7 @@ void AdBlockManager::load()
     settings.endGroup();
 
     if (!m_enabled) {
+        AdBlockSubscription::clearPreloadedSubscriptions();
         return;
     }
 
@@ -328,7 +422,7 @@ void AdBlockManager::load()
     AdBlockCustomList* customList = new AdBlockCustomList(this);
     m_subscriptions.append(customList);
 
-    // Load all subscriptions
+    // Load all subscriptions, files are usually already parsed by ParseAdBlock startup stage
     foreach (AdBlockSubscription* subscription, m_subscriptions) {
         subscription->loadSubscription(m_disabledRules);
 
@@ -344,29 +438,17 @@ void AdBlockManager::load()
     qDebug() << "AdBlock loaded in" << timer.elapsed();
 #endif
 
+    // Files removed or not matching any subscription
+    AdBlockSubscription::clearPreloadedSubscriptions();
+
     m_matcher->update();
+    updateElementHidingScript();
     m_loaded = true;
 
-    connect(m_interceptor, &AdBlockUrlInterceptor::requestBlocked, this, [this](const AdBlockedRequest &request) {
-        m_blockedRequests[request.firstPartyUrl].append(request);
-
-        // Limit blocked requests per URL for memory optimization (webOS)
-        const int maxRequestsPerUrl = 50;
-        if (m_blockedRequests[request.firstPartyUrl].size() > maxRequestsPerUrl) {
-            m_blockedRequests[request.firstPartyUrl].remove(0);
-        }
-
-        // Limit total number of URLs tracked
-        const int maxUrls = 100;
-        if (m_blockedRequests.size() > maxUrls) {
-            // Remove oldest URL (first key)
-            auto it = m_blockedRequests.begin();
-            if (it != m_blockedRequests.end()) {
-                m_blockedRequests.erase(it);
-            }
+    connect(m_interceptor, &AdBlockUrlInterceptor::requestsBlocked, this, [this]() {
+        if (!m_drainTimer->isActive()) {
+            m_drainTimer->start();
         }
-
-        emit blockedRequestsChanged(request.firstPartyUrl);
     });
 
     mApp->networkManager()->installUrlInterceptor(m_interceptor);
@@ -377,6 +459,42 @@ void AdBlockManager::updateMatcher()
     QMutexLocker locker(&m_mutex);
 
     m_matcher->update();
+    updateElementHidingScript();
+}
+
+void AdBlockManager::drainBlockedRequests()
+{
+    const QVector<AdBlockedRequest> requests = m_interceptor->takeBlockedRequests();
+    if (requests.isEmpty()) {
+        return;
+    }
+
+    // Limit blocked requests per URL and number of tracked URLs for memory optimization (webOS)
+    const int maxRequestsPerUrl = 50;
+    const int maxUrls = 100;
+
+    QSet<QUrl> changedUrls;
+
+    foreach (const AdBlockedRequest &request, requests) {
+        QVector<AdBlockedRequest> &list = m_blockedRequests[request.firstPartyUrl];
+        list.append(request);
+        if (list.size() > maxRequestsPerUrl) {
+            list.remove(0);
+        }
+
+        ++m_blockedRequestsCount[request.firstPartyUrl];
+        changedUrls.insert(request.firstPartyUrl);
+    }
+
+    while (m_blockedRequests.size() > maxUrls) {
+        auto it = m_blockedRequests.begin();
+        m_blockedRequestsCount.remove(it.key());
+        m_blockedRequests.erase(it);
+    }
+
+    foreach (const QUrl &url, changedUrls) {
+        emit blockedRequestsChanged(url);
+    }
 }
 
 void AdBlockManager::updateAllSubscriptions()
@@ -424,6 +542,11 @@ bool AdBlockManager::canBeBlocked(const QUrl &url) const
     return !m_matcher->adBlockDisabledForUrl(url);
 }
 
+bool AdBlockManager::elementHidingEnabledForUrl(const QUrl &url) const
+{
+    return isEnabled() && canRunOnScheme(url.scheme()) && !m_matcher->elemHideDisabledForUrl(url);
+}
+
 QString AdBlockManager::elementHidingRules(const QUrl &url) const
 {
     if (!isEnabled() || !canRunOnScheme(url.scheme()) || !canBeBlocked(url))
@@ -440,6 +563,38 @@ QString AdBlockManager::elementHidingRulesForDomain(const QUrl &url) const
     return m_matcher->elementHidingRulesForDomain(url.host());
 }
 
+void AdBlockManager::updateElementHidingScript()
+{
+    // Generic element hiding rules are the same for all pages, so they are
+    // injected with profile script instead of sending them to each page
+    const QString name = QSL("_qupzilla_adblock_css");
+
+    QWebEngineScriptCollection* scripts = mApp->webProfile()->scripts();
+    QWebEngineScript oldScript = scripts->findScript(name);
+    if (!oldScript.isNull()) {
+        scripts->remove(oldScript);
+    }
+
+    const QString css = m_enabled ? m_matcher->elementHidingRules() : QString();
+    if (css.isEmpty()) {
+        return;
+    }
+
+    QWebEngineScript script;
+    script.setName(name);
+    script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+    script.setWorldId(WebPage::SafeJsWorld);
+    // Element hiding is only applied to the main frame, parsing the
+    // stylesheet again in every iframe is too expensive
+    script.setRunsOnSubFrames(false);
+    script.setSourceCode(Scripts::setupElementHiding(css, m_matcher->elementHidingDisabledDomains()));
+    scripts->insert(script);
+
+#ifdef ADBLOCK_DEBUG
+    qDebug() << "AdBlock: generic element hiding script updated," << css.size() << "chars";
+#endif
+}
+
 AdBlockSubscription* AdBlockManager::subscriptionByName(const QString &name) const
 {
     foreach (AdBlockSubscription* subscription, m_subscriptions) {
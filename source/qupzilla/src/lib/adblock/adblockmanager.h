@@ -22,6 +22,7 @@
 #include <QStringList>
 #include <QPointer>
 #include <QMutex>
+#include <QCache>
 #include <QUrl>
 #include <QWebEngineUrlRequestInfo>
 
@@ -30,6 +31,8 @@
 #define ADBLOCK_EASYLIST_URL "https://easylist-downloads.adblockplus.org/easylist.txt"
 #define ADBLOCK_NOCOINLIST_URL "https://raw.githubusercontent.com/hoshsadiq/adblock-nocoin-list/master/nocoin.txt"
 
+class QTimer;
+
 class AdBlockRule;
 class AdBlockDialog;
 class AdBlockMatcher;
@@ -63,6 +66,8 @@ public:
     bool canRunOnScheme(const QString &scheme) const;
     bool canBeBlocked(const QUrl &url) const;
 
+    bool elementHidingEnabledForUrl(const QUrl &url) const;
+
     QString elementHidingRules(const QUrl &url) const;
     QString elementHidingRulesForDomain(const QUrl &url) const;
 
@@ -71,7 +76,11 @@ public:
 
     bool block(QWebEngineUrlRequestInfo &request, QString &ruleFilter, QString &ruleSubscription);
 
+    quint64 decisionCacheHits() const;
+    quint64 decisionCacheMisses() const;
+
     QVector<AdBlockedRequest> blockedRequestsForUrl(const QUrl &url) const;
+    int blockedRequestsCount(const QUrl &url) const;
     void clearBlockedRequestsForUrl(const QUrl &url);
 
     QStringList disabledRules() const;
@@ -101,6 +110,32 @@ public slots:
     AdBlockDialog* showDialog();
 
 private:
+    struct DecisionKey {
+        QString url;
+        QString firstPartyHost;
+        int resourceType;
+
+        bool operator==(const DecisionKey &other) const {
+            return resourceType == other.resourceType && url == other.url && firstPartyHost == other.firstPartyHost;
+        }
+
+        friend uint qHash(const DecisionKey &key, uint seed = 0) {
+            return qHash(key.url, seed) ^ qHash(key.firstPartyHost, seed) ^ uint(key.resourceType);
+        }
+    };
+
+    // Rule is only valid while generation matches the matcher generation
+    struct Decision {
+        const AdBlockRule* rule;
+        bool canBeBlocked;
+        quint64 generation;
+    };
+
+    bool canBeBlockedCached(const QUrl &firstPartyUrl, quint64 generation);
+
+    void updateElementHidingScript();
+    void drainBlockedRequests();
+
     bool m_loaded;
     bool m_enabled;
 
@@ -112,6 +147,15 @@ private:
     QPointer<AdBlockDialog> m_adBlockDialog;
     QMutex m_mutex;
     QHash<QUrl, QVector<AdBlockedRequest>> m_blockedRequests;
+    QHash<QUrl, int> m_blockedRequestsCount;
+
+    // Protected by m_mutex
+    QCache<DecisionKey, Decision> m_decisionCache;
+    QCache<QUrl, Decision> m_firstPartyCache;
+    quint64 m_decisionCacheHits;
+    quint64 m_decisionCacheMisses;
+
+    QTimer* m_drainTimer;
 };
 
 #endif // ADBLOCKMANAGER_H
@@ -23,6 +23,7 @@
 AdBlockMatcher::AdBlockMatcher(AdBlockManager* manager)
     : QObject(manager)
     , m_manager(manager)
+    , m_generation(0)
 {
 }
 
@@ -88,6 +89,19 @@ QString AdBlockMatcher::elementHidingRules() const
     return m_elementHidingRules;
 }
 
+QStringList AdBlockMatcher::elementHidingDisabledDomains() const
+{
+    QStringList domains;
+
+    foreach (const AdBlockRule* rule, m_documentRules + m_elemhideRules) {
+        const QString domain = rule->matchedDomain();
+        if (!domain.isEmpty() && !domains.contains(domain))
+            domains.append(domain);
+    }
+
+    return domains;
+}
+
 QString AdBlockMatcher::elementHidingRulesForDomain(const QString &domain) const
 {
     QString rules;
@@ -118,6 +132,11 @@ QString AdBlockMatcher::elementHidingRulesForDomain(const QString &domain) const
     return rules;
 }
 
+quint64 AdBlockMatcher::generation() const
+{
+    return m_generation;
+}
+
 void AdBlockMatcher::update()
 {
     clear();
@@ -206,6 +225,8 @@ void AdBlockMatcher::update()
 
 void AdBlockMatcher::clear()
 {
+    ++m_generation;
+
     m_networkExceptionTree.clear();
     m_networkExceptionRules.clear();
     m_networkBlockTree.clear();
@@ -44,12 +44,19 @@ public:
     QString elementHidingRules() const;
     QString elementHidingRulesForDomain(const QString &domain) const;
 
+    // Domains of document and elemhide exceptions that can be matched without url
+    QStringList elementHidingDisabledDomains() const;
+
+    // Incremented each time the rules are rebuilt or cleared
+    quint64 generation() const;
+
 public slots:
     void update();
     void clear();
 
 private:
     AdBlockManager* m_manager;
+    quint64 m_generation;
 
     QVector<AdBlockRule*> m_createdRules;
     QVector<const AdBlockRule*> m_networkExceptionRules;
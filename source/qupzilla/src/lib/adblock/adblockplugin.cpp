@@ -28,6 +28,8 @@
 #include "mainapplication.h"
 #include "statusbar.h"
 
+//#define ADBLOCK_DEBUG
+
 AdBlockPlugin::AdBlockPlugin()
     : QObject()
 {
@@ -60,21 +62,29 @@ bool AdBlockPlugin::testPlugin()
 
 void AdBlockPlugin::webPageCreated(WebPage *page)
 {
+    // Generic element hiding rules are injected by profile script (see AdBlockManager),
+    // only the page specific changes are sent here
     connect(page, &WebPage::loadFinished, this, [=]() {
         AdBlockManager *manager = AdBlockManager::instance();
-        if (!manager->isEnabled()) {
+        if (!manager->isEnabled() || !manager->canRunOnScheme(page->url().scheme())) {
             return;
         }
-        // Apply global element hiding rules
-        const QString elementHiding = manager->elementHidingRules(page->url());
-        if (!elementHiding.isEmpty()) {
-            page->runJavaScript(Scripts::setCss(elementHiding), WebPage::SafeJsWorld);
+
+        // Exceptions that can't be matched by domain in the element hiding script
+        if (!manager->elementHidingEnabledForUrl(page->url())) {
+            page->runJavaScript(Scripts::removeElementHiding(), WebPage::SafeJsWorld);
+            return;
         }
+
         // Apply domain-specific element hiding rules
         const QString siteElementHiding = manager->elementHidingRulesForDomain(page->url());
         if (!siteElementHiding.isEmpty()) {
             page->runJavaScript(Scripts::setCss(siteElementHiding), WebPage::SafeJsWorld);
         }
+
+#ifdef ADBLOCK_DEBUG
+        qDebug() << "AdBlock: sent" << siteElementHiding.size() << "chars of element hiding CSS to" << page->url().host();
+#endif
     });
 }
 
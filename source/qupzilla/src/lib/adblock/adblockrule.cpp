@@ -160,6 +160,11 @@ bool AdBlockRule::isElemhide() const
     return hasOption(ElementHideOption);
 }
 
+QString AdBlockRule::matchedDomain() const
+{
+    return m_type == DomainMatchRule ? m_matchString : QString();
+}
+
 bool AdBlockRule::isDomainRestricted() const
 {
     return hasOption(DomainRestrictedOption);
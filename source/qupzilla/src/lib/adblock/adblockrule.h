@@ -80,6 +80,9 @@ public:
     bool isDocument() const;
     bool isElemhide() const;
 
+    // Domain matched by ||domain^ rules, empty for other rule types
+    QString matchedDomain() const;
+
     bool isDomainRestricted() const;
     bool isException() const;
 
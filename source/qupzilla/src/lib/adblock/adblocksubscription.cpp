@@ -50,11 +50,50 @@
 #include "datapaths.h"
 #include "qztools.h"
 
+#include <QDir>
 #include <QFile>
+#include <QHash>
+#include <QMutex>
 #include <QTimer>
 #include <QNetworkReply>
 #include <QSaveFile>
 
+Q_GLOBAL_STATIC(QMutex, s_preloadMutex)
+static QHash<QString, QVector<AdBlockRule*> > s_preloadedRules;
+
+static void deletePreloadedRules()
+{
+    foreach (const QVector<AdBlockRule*> &rules, s_preloadedRules) {
+        qDeleteAll(rules);
+    }
+    s_preloadedRules.clear();
+}
+
+// Returns false when file is not a valid subscription, rules have no subscription set
+static bool parseSubscriptionFile(QFile &file, QVector<AdBlockRule*> &rules)
+{
+    QTextStream textStream(&file);
+    textStream.setCodec("UTF-8");
+    // Header is on 3rd line
+    textStream.readLine(1024);
+    textStream.readLine(1024);
+    QString header = textStream.readLine(1024);
+
+    if (!header.startsWith(QLatin1String("[Adblock"))) {
+        return false;
+    }
+
+    while (!textStream.atEnd()) {
+        const QString line = textStream.readLine().trimmed();
+        if (line.isEmpty()) {
+            continue;
+        }
+        rules.append(new AdBlockRule(line));
+    }
+
+    return true;
+}
+
 AdBlockSubscription::AdBlockSubscription(const QString &title, QObject* parent)
     : QObject(parent)
     , m_reply(0)
@@ -90,40 +129,50 @@ void AdBlockSubscription::setUrl(const QUrl &url)
 
 void AdBlockSubscription::loadSubscription(const QStringList &disabledRules)
 {
+    QMutexLocker locker(s_preloadMutex());
+    QVector<AdBlockRule*> rules = s_preloadedRules.take(m_filePath);
+    const bool preloaded = !rules.isEmpty();
+    locker.unlock();
+
+    if (preloaded && !m_title.isEmpty()) {
+        m_rules.clear();
+
+        foreach (AdBlockRule* rule, rules) {
+            rule->setSubscription(this);
+            if (disabledRules.contains(rule->filter())) {
+                rule->setEnabled(false);
+            }
+            m_rules.append(rule);
+        }
+        return;
+    }
+
+    qDeleteAll(rules);
+
     QFile file(m_filePath);
 
     if (!file.exists()) {
-        QTimer::singleShot(0, this, SLOT(updateSubscription()));
+        QMetaObject::invokeMethod(this, "updateSubscription", Qt::QueuedConnection);
         return;
     }
 
     if (!file.open(QFile::ReadOnly)) {
         qWarning() << "AdBlockSubscription::" << __FUNCTION__ << "Unable to open adblock file for reading" << m_filePath;
-        QTimer::singleShot(0, this, SLOT(updateSubscription()));
+        QMetaObject::invokeMethod(this, "updateSubscription", Qt::QueuedConnection);
         return;
     }
 
-    QTextStream textStream(&file);
-    textStream.setCodec("UTF-8");
-    // Header is on 3rd line
-    textStream.readLine(1024);
-    textStream.readLine(1024);
-    QString header = textStream.readLine(1024);
-
-    if (!header.startsWith(QLatin1String("[Adblock")) || m_title.isEmpty()) {
+    if (!parseSubscriptionFile(file, rules) || m_title.isEmpty()) {
         qWarning() << "AdBlockSubscription::" << __FUNCTION__ << "invalid format of adblock file" << m_filePath;
-        QTimer::singleShot(0, this, SLOT(updateSubscription()));
+        qDeleteAll(rules);
+        QMetaObject::invokeMethod(this, "updateSubscription", Qt::QueuedConnection);
         return;
     }
 
     m_rules.clear();
 
-    while (!textStream.atEnd()) {
-        const QString line = textStream.readLine().trimmed();
-        if (line.isEmpty()) {
-            continue;
-        }
-        AdBlockRule *rule = new AdBlockRule(line, this);
+    foreach (AdBlockRule* rule, rules) {
+        rule->setSubscription(this);
         if (disabledRules.contains(rule->filter())) {
             rule->setEnabled(false);
         }
@@ -132,7 +181,7 @@ void AdBlockSubscription::loadSubscription(const QStringList &disabledRules)
 
     // Initial update
     if (m_rules.isEmpty() && !m_updated) {
-        QTimer::singleShot(0, this, SLOT(updateSubscription()));
+        QMetaObject::invokeMethod(this, "updateSubscription", Qt::QueuedConnection);
     }
 }
 
@@ -140,6 +189,42 @@ void AdBlockSubscription::saveSubscription()
 {
 }
 
+// static
+void AdBlockSubscription::preloadSubscriptions()
+{
+    const QDir adblockDir(DataPaths::currentProfilePath() + QLatin1String("/adblock"));
+
+    QHash<QString, QVector<AdBlockRule*> > preloaded;
+
+    foreach (const QString &fileName, adblockDir.entryList(QStringList(QSL("*.txt")), QDir::Files)) {
+        // Custom list may still be changed before it is loaded
+        if (fileName == QLatin1String("customlist.txt")) {
+            continue;
+        }
+
+        QFile file(adblockDir.absoluteFilePath(fileName));
+        QVector<AdBlockRule*> rules;
+
+        if (file.open(QFile::ReadOnly) && parseSubscriptionFile(file, rules) && !rules.isEmpty()) {
+            preloaded.insert(file.fileName(), rules);
+        }
+        else {
+            qDeleteAll(rules);
+        }
+    }
+
+    QMutexLocker locker(s_preloadMutex());
+    deletePreloadedRules();
+    s_preloadedRules = preloaded;
+}
+
+// static
+void AdBlockSubscription::clearPreloadedSubscriptions()
+{
+    QMutexLocker locker(s_preloadMutex());
+    deletePreloadedRules();
+}
+
 void AdBlockSubscription::updateSubscription()
 {
     if (m_reply || !m_url.isValid()) {
@@ -74,6 +74,11 @@ public:
     virtual void loadSubscription(const QStringList &disabledRules);
     virtual void saveSubscription();
 
+    // Parses subscription files from profile in worker thread, rules are
+    // then taken by loadSubscription() instead of parsing the file again
+    static void preloadSubscriptions();
+    static void clearPreloadedSubscriptions();
+
     const AdBlockRule* rule(int offset) const;
     QVector<AdBlockRule*> allRules() const;
 
@@ -21,11 +21,18 @@
 #include "qztools.h"
 
 #include <QUrlQuery>
+#include <QDebug>
 
 AdBlockUrlInterceptor::AdBlockUrlInterceptor(AdBlockManager *manager)
     : UrlInterceptor(manager)
     , m_manager(manager)
 {
+    // Everything except the rule is the same for all blocked pages
+    m_blockedPageTemplate = QzTools::readAllFileContents(QSL(":adblock/data/adblock.html"));
+    m_blockedPageTemplate.replace(QSL("%FAVICON%"), QSL("qrc:adblock/data/adblock_big.png"));
+    m_blockedPageTemplate.replace(QSL("%IMAGE%"), QSL("qrc:adblock/data/adblock_big.png"));
+    m_blockedPageTemplate.replace(QSL("%TITLE%"), tr("Blocked content"));
+    m_blockedPageTemplate = QzTools::applyDirectionToPage(m_blockedPageTemplate);
 }
 
 void AdBlockUrlInterceptor::interceptRequest(QWebEngineUrlRequestInfo &request)
@@ -37,13 +44,7 @@ void AdBlockUrlInterceptor::interceptRequest(QWebEngineUrlRequestInfo &request)
     }
 
     if (request.resourceType() == QWebEngineUrlRequestInfo::ResourceTypeMainFrame) {
-        QString page;
-        page.append(QzTools::readAllFileContents(QSL(":adblock/data/adblock.html")));
-        page.replace(QSL("%FAVICON%"), QSL("qrc:adblock/data/adblock_big.png"));
-        page.replace(QSL("%IMAGE%"), QSL("qrc:adblock/data/adblock_big.png"));
-        page.replace(QSL("%TITLE%"), tr("Blocked content"));
-        page.replace(QSL("%RULE%"), tr("Blocked by <i>%1 (%2)</i>").arg(ruleFilter, ruleSubscription));
-        page = QzTools::applyDirectionToPage(page);
+        const QString page = blockedPage(ruleFilter, ruleSubscription);
         request.redirect(QUrl(QString::fromUtf8(QByteArray("data:text/html;base64,") + page.toUtf8().toBase64())));
     } else {
         request.block(true);
@@ -56,5 +57,39 @@ void AdBlockUrlInterceptor::interceptRequest(QWebEngineUrlRequestInfo &request)
     r.resourceType = request.resourceType();
     r.navigationType = request.navigationType();
     r.rule = ruleFilter;
-    emit requestBlocked(r);
+
+    if (!m_blockedRequests.push(r)) {
+        m_droppedRequests.ref();
+    }
+
+    // Only notify main thread when it is not already going to drain the buffer
+    if (m_notifyPending.testAndSetOrdered(0, 1)) {
+        emit requestsBlocked();
+    }
+}
+
+QVector<AdBlockedRequest> AdBlockUrlInterceptor::takeBlockedRequests()
+{
+    // Reset before draining, so requests pushed meanwhile will notify again
+    m_notifyPending.storeRelease(0);
+
+    QVector<AdBlockedRequest> requests;
+    AdBlockedRequest request;
+    while (m_blockedRequests.pop(request)) {
+        requests.append(request);
+    }
+
+    const int dropped = m_droppedRequests.fetchAndStoreOrdered(0);
+    if (dropped > 0) {
+        qWarning() << "AdBlock: Dropped" << dropped << "blocked requests, buffer is full";
+    }
+
+    return requests;
+}
+
+QString AdBlockUrlInterceptor::blockedPage(const QString &ruleFilter, const QString &ruleSubscription) const
+{
+    QString page = m_blockedPageTemplate;
+    page.replace(QSL("%RULE%"), tr("Blocked by <i>%1 (%2)</i>").arg(ruleFilter.toHtmlEscaped(), ruleSubscription.toHtmlEscaped()));
+    return page;
 }
@@ -22,6 +22,9 @@
 #include "qzcommon.h"
 #include "urlinterceptor.h"
 #include "adblockmanager.h"
+#include "spscringbuffer.h"
+
+#include <QAtomicInt>
 
 class AdBlockManager;
 
@@ -34,11 +37,23 @@ public:
 
     void interceptRequest(QWebEngineUrlRequestInfo &request);
 
+    // Must be called from main thread, returns requests blocked since last call
+    QVector<AdBlockedRequest> takeBlockedRequests();
+
 signals:
-    void requestBlocked(const AdBlockedRequest &request);
+    // Emitted once for each batch of blocked requests
+    void requestsBlocked();
 
 private:
+    QString blockedPage(const QString &ruleFilter, const QString &ruleSubscription) const;
+
     AdBlockManager *m_manager;
+    QString m_blockedPageTemplate;
+
+    // Requests are only intercepted on IO thread, so there is a single producer
+    SpscRingBuffer<AdBlockedRequest, 512> m_blockedRequests;
+    QAtomicInt m_notifyPending;
+    QAtomicInt m_droppedRequests;
 };
 
 #endif // ADBLOCKURLINTERCEPTOR_H
@@ -23,9 +23,20 @@
 
 AutoSaver::AutoSaver(QObject* parent)
     : QObject(parent)
+    , m_saveDelay(SAVE_DELAY)
 {
 }
 
+int AutoSaver::saveDelay() const
+{
+    return m_saveDelay;
+}
+
+void AutoSaver::setSaveDelay(int delay)
+{
+    m_saveDelay = delay;
+}
+
 void AutoSaver::saveIfNecessary()
 {
     if (m_timer.isActive()) {
@@ -37,7 +48,7 @@ void AutoSaver::saveIfNecessary()
 void AutoSaver::changeOccurred()
 {
     if (!m_timer.isActive()) {
-        m_timer.start(SAVE_DELAY, this);
+        m_timer.start(m_saveDelay, this);
     }
 }
 
@@ -30,6 +30,9 @@ class QUPZILLA_EXPORT AutoSaver : public QObject
 public:
     explicit AutoSaver(QObject* parent = 0);
 
+    int saveDelay() const;
+    void setSaveDelay(int delay);
+
     // Emits save() if timer is running. Call this from destructor.
     void saveIfNecessary();
 
@@ -44,6 +47,7 @@ private:
     void timerEvent(QTimerEvent* event);
 
     QBasicTimer m_timer;
+    int m_saveDelay;
 };
 
 #endif // AUTOSAVER_H
@@ -79,20 +79,6 @@
 #include <QCollator>
 #include <QTemporaryFile>
 
-#include <cstdio>
-#include <sys/stat.h>
-
-static bool bwLoggingEnabled() {
-    struct stat st;
-    return (stat("/media/internal/qupzilla/enable_logging", &st) == 0);
-}
-
-static void bwLog(const char* msg) {
-    if (!bwLoggingEnabled()) return;
-    FILE* f = fopen("/media/internal/qupzilla/startup.log", "a");
-    if (f) { fprintf(f, "%s\n", msg); fflush(f); fclose(f); }
-}
-
 static const int savedWindowVersion = 2;
 
 BrowserWindow::SavedWindow::SavedWindow()
@@ -237,6 +237,8 @@ private:
     QTimer* m_hideNavigationTimer;
 
     QList<QPointer<QWidget> > m_deleteOnCloseWidgets;
+
+    friend class SessionStore;
 };
 
 #endif // QUPZILLA_H
@@ -17,26 +17,6 @@
 * ============================================================ */
 #include "mainapplication.h"
 #include "history.h"
-#include <iostream>
-#include <cstdio>
-#include <sys/stat.h>
-
-// Check if logging is enabled via flag file
-static bool isLoggingEnabled() {
-    struct stat st;
-    return (stat("/media/internal/qupzilla/enable_logging", &st) == 0);
-}
-
-// Helper to log to both stderr and file (only if logging enabled)
-static void appLog(const char* msg) {
-    if (!isLoggingEnabled()) return;
-    std::cerr << msg << std::endl;
-    FILE* f = fopen("/media/internal/qupzilla/startup.log", "a");
-    if (f) {
-        fprintf(f, "%s\n", msg);
-        fclose(f);
-    }
-}
 #include "qztools.h"
 #include "updater.h"
 #include "autofill.h"
@@ -66,7 +46,14 @@ static void appLog(const char* msg) {
 #include "html5permissions/html5permissionsmanager.h"
 #include "scripts.h"
 #include "sessionmanager.h"
+#include "sessionstore.h"
 #include "closedwindowsmanager.h"
+#include "tracerecorder.h"
+#include "startupscheduler.h"
+#include "themecompiler.h"
+#include "databasemaintenance.h"
+#include "tabbedwebview.h"
+#include "adblocksubscription.h"
 
 #include <QWebEngineSettings>
 #include <QDesktopServices>
@@ -83,10 +70,12 @@ static void appLog(const char* msg) {
 #include <QDir>
 #include <QStandardPaths>
 #include <QWebEngineProfile>
+#include <QWebEnginePage>
 #include <QWebEngineDownloadItem>
 #include <QWebEngineScriptCollection>
 
 #include <iostream>
+#include <memory>
 
 static bool s_testMode = false;
 QString MainApplication::s_pendingLaunchUrl;
@@ -106,6 +95,7 @@ MainApplication::MainApplication(int &argc, char** argv)
     , m_networkManager(0)
     , m_restoreManager(0)
     , m_sessionManager(0)
+    , m_sessionStore(0)
     , m_downloadManager(0)
     , m_userAgentManager(0)
     , m_searchEnginesManager(0)
@@ -113,8 +103,11 @@ MainApplication::MainApplication(int &argc, char** argv)
     , m_html5PermissionsManager(0)
     , m_desktopNotifications(0)
     , m_webProfile(0)
+    , m_startupScheduler(new StartupScheduler(this))
     , m_autoSaver(0)
 {
+    TraceScope trace("MainApplication::MainApplication", "startup");
+
     std::cerr << "[MAINAPPLICATION] Constructor started" << std::endl;
     setAttribute(Qt::AA_UseHighDpiPixmaps);
     setAttribute(Qt::AA_DontCreateNativeWidgetSiblings);
@@ -250,9 +243,7 @@ MainApplication::MainApplication(int &argc, char** argv)
     if (isRunning()) {
         std::cerr << "[MAINAPPLICATION] Already running, sending messages and closing" << std::endl;
         m_isClosing = true;
-        foreach (const QString &message, messages) {
-            sendMessage(message);
-        }
+        sendMessages(messages);
         return;
     }
     std::cerr << "[MAINAPPLICATION] Not already running, continuing startup" << std::endl;
@@ -266,6 +257,7 @@ MainApplication::MainApplication(int &argc, char** argv)
     QDesktopServices::setUrlHandler(QSL("ftp"), this, "addNewTab");
 
     std::cerr << "[MAINAPPLICATION] Initializing ProfileManager" << std::endl;
+    TraceRecorder::instance()->beginEvent("ProfileManager::init", "startup");
     ProfileManager profileManager;
     profileManager.initConfigDir();
     std::cerr << "[MAINAPPLICATION] initConfigDir done" << std::endl;
@@ -274,56 +266,48 @@ MainApplication::MainApplication(int &argc, char** argv)
 
     std::cerr << "[MAINAPPLICATION] Creating Settings" << std::endl;
     Settings::createSettings(DataPaths::currentProfilePath() + QLatin1String("/settings.ini"));
+    TraceRecorder::instance()->endEvent("ProfileManager::init", "startup");
 
 #ifdef PORTABLE_BUILD
     // Clean up QtWebEngine directories that might have stale state causing IPC crashes
-    appLog("[MAINAPPLICATION] Cleaning QtWebEngine directories");
+    TraceRecorder::instance()->beginEvent("CleanWebEngineDirs", "startup");
     QString profilePath = DataPaths::currentProfilePath();
-    appLog(qPrintable(QSL("[MAINAPPLICATION] Profile path: ") + profilePath));
     QDir webEngineDir(profilePath + "/QtWebEngine");
     if (webEngineDir.exists()) {
-        appLog(qPrintable(QSL("[MAINAPPLICATION] Removing QtWebEngine dir: ") + webEngineDir.absolutePath()));
         webEngineDir.removeRecursively();
     }
     QDir webEngineDefaultDir(profilePath + "/QtWebEngine/Default");
     if (webEngineDefaultDir.exists()) {
-        appLog("[MAINAPPLICATION] Removing QtWebEngine/Default dir");
         webEngineDefaultDir.removeRecursively();
     }
     // Also check for cache directories
     QDir cacheDir(DataPaths::path(DataPaths::Cache) + "/QtWebEngine");
     if (cacheDir.exists()) {
-        appLog(qPrintable(QSL("[MAINAPPLICATION] Removing cache QtWebEngine dir: ") + cacheDir.absolutePath()));
         cacheDir.removeRecursively();
     }
+    TraceRecorder::instance()->endEvent("CleanWebEngineDirs", "startup");
 #endif
 
 #ifdef PORTABLE_BUILD
     // PORTABLE_BUILD: Defer QWebEngineProfile creation until event loop is running
     // Creating it before event loop causes Chromium IPC channel corruption on relaunch
-    appLog("[MAINAPPLICATION] PORTABLE_BUILD: Deferring QWebEngineProfile creation to event loop");
     m_webProfile = nullptr;  // Will be created after event loop starts
 #else
-    appLog("[MAINAPPLICATION] Creating QWebEngineProfile");
+    TraceRecorder::instance()->beginEvent("CreateWebEngineProfile", "startup");
     m_webProfile = isPrivate() ? new QWebEngineProfile(this) : QWebEngineProfile::defaultProfile();
-    appLog("[MAINAPPLICATION] QWebEngineProfile created");
+    TraceRecorder::instance()->endEvent("CreateWebEngineProfile", "startup");
     connect(m_webProfile, &QWebEngineProfile::downloadRequested, this, &MainApplication::downloadRequested);
 #endif
 
 #ifndef PORTABLE_BUILD
-    appLog("[MAINAPPLICATION] Creating NetworkManager");
     m_networkManager = new NetworkManager(this);
-#else
-    appLog("[MAINAPPLICATION] PORTABLE_BUILD: Deferring NetworkManager (needs webProfile)");
 #endif
 
     // Force IconProvider initialization in main thread to prevent QPixmap threading issues
     // when LocationCompleterRefreshJob or other background threads access it first
-    appLog("[MAINAPPLICATION] Initializing IconProvider");
     IconProvider::instance();
 
 #ifndef PORTABLE_BUILD
-    appLog("[MAINAPPLICATION] Setting up user scripts");
     setupUserScripts();
 #endif
 
@@ -354,72 +338,60 @@ MainApplication::MainApplication(int &argc, char** argv)
         if (!m_isStartingAfterCrash && afterLaunch() == SelectSession)
             m_restoreManager = new RestoreManager(sessionManager()->askSessionFromUser());
     }
+#else
+    if (!isPrivate() && !isTestModeEnabled()) {
+        // Session is saved incrementally, so it is cheap enough to save shortly after every change
+        m_sessionStore = new SessionStore(DataPaths::currentProfilePath() + QL1S("/sessionstore"), this);
+        m_autoSaver = new AutoSaver(this);
+        m_autoSaver->setSaveDelay(3 * 1000);
+        connect(m_autoSaver, &AutoSaver::save, m_sessionStore, &SessionStore::save);
+
+        Settings settings;
+        settings.beginGroup(QSL("SessionRestore"));
+        const bool wasRunning = settings.value(QSL("isRunning"), false).toBool();
+        settings.setValue(QSL("isRunning"), true);
+        settings.endGroup();
+        settings.sync();
+
+        // Previous run did not quit cleanly, offer to restore its tabs
+        if (wasRunning) {
+            m_restoreManager = new RestoreManager(m_sessionStore->restoreData());
+            destroyRestoreManager();
+            m_isStartingAfterCrash = m_restoreManager != nullptr;
+        } else {
+            m_sessionStore->releasePreviousSession();
+        }
+    }
 #endif
 
-    appLog("[MAINAPPLICATION] Translating app");
     translateApp();
 #ifndef PORTABLE_BUILD
-    appLog("[MAINAPPLICATION] Loading settings");
     loadSettings();
-    appLog("[MAINAPPLICATION] Settings loaded");
-#else
-    appLog("[MAINAPPLICATION] PORTABLE_BUILD: Deferring loadSettings (needs webProfile)");
 #endif
 
-    appLog("[MAINAPPLICATION] Creating PluginProxy");
     m_plugins = new PluginProxy(this);
 #ifndef PORTABLE_BUILD
-    appLog("[MAINAPPLICATION] Creating AutoFill");
     m_autoFill = new AutoFill(this);
-#else
-    appLog("[MAINAPPLICATION] PORTABLE_BUILD: Deferring AutoFill (needs webProfile)");
 #endif
 
 #ifndef PORTABLE_BUILD
     if (!noAddons) {
-        appLog("[MAINAPPLICATION] Loading plugins");
         m_plugins->loadPlugins();
-        appLog("[MAINAPPLICATION] Plugins loaded");
     }
 #else
-    appLog("[MAINAPPLICATION] PORTABLE_BUILD: Deferring loadPlugins (needs networkManager)");
     Q_UNUSED(noAddons);
 #endif
 
-    appLog("[MAINAPPLICATION] Creating browser window");
 #ifdef PORTABLE_BUILD
-    // Defer ALL WebEngine initialization until event loop is running to avoid Chromium IPC crashes
-    // Creating QWebEngineProfile before event loop causes "Invalid node channel message" on relaunch
-    appLog("[MAINAPPLICATION] PORTABLE_BUILD: Deferring WebEngine init");
-    // Stage 1: Create QWebEngineProfile (starts Chromium subprocess)
-    // Minimal delay - just let event loop start
-    QTimer::singleShot(100, this, [this]() {
-        appLog("[MAINAPPLICATION] Stage1: Creating QWebEngineProfile");
-        m_webProfile = new QWebEngineProfile(this);
-        connect(m_webProfile, &QWebEngineProfile::downloadRequested, this, &MainApplication::downloadRequested);
-
-        // Stage 2: Brief wait for Chromium to initialize
-        QTimer::singleShot(500, this, [this]() {
-            appLog("[MAINAPPLICATION] Stage2: Initializing components");
-
-            m_networkManager = new NetworkManager(this);
-            m_autoFill = new AutoFill(this);
-            m_plugins->loadPlugins();
-            loadSettings();
-            setupUserScripts();
-
-            appLog("[MAINAPPLICATION] Stage2: Creating browser window");
-            BrowserWindow* window = createWindow(Qz::BW_FirstAppWindow);
-            connect(window, SIGNAL(startingCompleted()), this, SLOT(restoreOverrideCursor()));
-            connect(window, SIGNAL(startingCompleted()), this, SLOT(onWindowStartingCompleted()));
-        });
-    });
+    // WebEngine initialization is done in startup stages once event loop is running
+    BrowserWindow* window = nullptr;
 #else
     BrowserWindow* window = createWindow(Qz::BW_FirstAppWindow, startUrl);
-    appLog("[MAINAPPLICATION] Browser window created");
     connect(window, SIGNAL(startingCompleted()), this, SLOT(restoreOverrideCursor()));
 #endif
 
+    setupStartupStages(window);
+
     connect(this, SIGNAL(focusChanged(QWidget*,QWidget*)), this, SLOT(onFocusChanged()));
 
     if (!isPrivate() && !isTestModeEnabled()) {
@@ -448,8 +420,7 @@ MainApplication::MainApplication(int &argc, char** argv)
 #endif
     }
 
-    appLog("[MAINAPPLICATION] Constructor completed, scheduling postLaunch");
-    QTimer::singleShot(0, this, SLOT(postLaunch()));
+    m_startupScheduler->start();
 }
 
 MainApplication::~MainApplication()
@@ -517,10 +488,17 @@ BrowserWindow* MainApplication::createWindow(Qz::BrowserWindowType type, const Q
         type = Qz::BW_FirstAppWindow;
     }
 
+    TraceScope trace("MainApplication::createWindow");
+
     BrowserWindow* window = new BrowserWindow(type, startUrl);
     connect(window, SIGNAL(destroyed(QObject*)), this, SLOT(windowDestroyed(QObject*)));
 
+    if (type == Qz::BW_FirstAppWindow) {
+        TraceRecorder::instance()->traceFirstPaint(window, "FirstWindowPaint");
+    }
+
     m_windows.prepend(window);
+    TraceRecorder::instance()->counterEvent("Windows", m_windows.count());
     return window;
 }
 
@@ -538,6 +516,24 @@ void MainApplication::openSession(BrowserWindow* window, RestoreData &restoreDat
 {
     setOverrideCursor(Qt::BusyCursor);
 
+#ifdef PORTABLE_BUILD
+    // Opening new windows is not supported on webOS, restore all tabs into current window
+    if (!window)
+        window = getWindow();
+
+    if (window) {
+        for (const BrowserWindow::SavedWindow &data : qAsConst(restoreData.windows)) {
+            window->tabWidget()->restoreState(data.tabs, data.currentTab);
+        }
+
+        if (m_closedWindowsManager)
+            m_closedWindowsManager->restoreState(restoreData.closedWindows);
+
+        restoreOverrideCursor();
+        return;
+    }
+#endif
+
     if (!window)
         window = createWindow(Qz::BW_OtherRestoredWindow);
 
@@ -581,6 +577,11 @@ void MainApplication::destroyRestoreManager()
 
     delete m_restoreManager;
     m_restoreManager = 0;
+
+    // Session restored or discarded, records of previous run can be replaced now
+    if (m_sessionStore) {
+        m_sessionStore->releasePreviousSession();
+    }
 }
 
 void MainApplication::reloadSettings()
@@ -673,6 +674,11 @@ SessionManager* MainApplication::sessionManager()
     return m_sessionManager;
 }
 
+SessionStore* MainApplication::sessionStore()
+{
+    return m_sessionStore;
+}
+
 DownloadManager* MainApplication::downloadManager()
 {
     if (!m_downloadManager) {
@@ -731,7 +737,11 @@ QWebEngineSettings *MainApplication::webSettings() const
     return m_webProfile->settings();
 }
 
-// static
+StartupScheduler* MainApplication::startupScheduler() const
+{
+    return m_startupScheduler;
+}
+
 MainApplication* MainApplication::instance()
 {
     return static_cast<MainApplication*>(QCoreApplication::instance());
@@ -774,7 +784,7 @@ void MainApplication::onWindowStartingCompleted()
 {
     // Open pending launch URL if one was provided via command line (webOS PDK launch params)
     if (!s_pendingLaunchUrl.isEmpty()) {
-        appLog(QSL("[MAINAPPLICATION] Opening pending launch URL: %1").arg(s_pendingLaunchUrl).toUtf8().constData());
+        TraceRecorder::instance()->instantEvent("OpenPendingLaunchUrl", "startup", s_pendingLaunchUrl);
         BrowserWindow* window = getWindow();
         if (window) {
             // Navigate the current tab to the launch URL
@@ -858,7 +868,7 @@ void MainApplication::quitApplication()
 
 void MainApplication::postLaunch()
 {
-    appLog("[MAINAPPLICATION] postLaunch() started");
+    TraceScope trace("MainApplication::postLaunch", "startup");
 
     if (m_postLaunchActions.contains(OpenDownloadManager)) {
         downloadManager()->show();
@@ -877,13 +887,120 @@ void MainApplication::postLaunch()
     connect(this, SIGNAL(messageReceived(QString)), this, SLOT(messageReceived(QString)));
     connect(this, SIGNAL(aboutToQuit()), this, SLOT(saveSettings()));
 
-    appLog("[MAINAPPLICATION] postLaunch() creating jump list");
     createJumpList();
-    appLog("[MAINAPPLICATION] postLaunch() init pulse support");
     initPulseSupport();
 
-    appLog("[MAINAPPLICATION] postLaunch() completed");
-    QTimer::singleShot(5000, this, &MainApplication::runDeferredPostLaunchActions);
+    // Startup is done, write recorded events
+    TraceRecorder::instance()->flush();
+}
+
+void MainApplication::setupStartupStages(BrowserWindow* window)
+{
+    // Stages run as soon as their dependencies are finished, independent stages
+    // overlap and worker stages run in parallel with main thread stages
+
+#ifdef PORTABLE_BUILD
+    // Creating QWebEngineProfile before event loop is running causes
+    // "Invalid node channel message" Chromium IPC crashes on relaunch
+    m_startupScheduler->addStage("WebEngineProfile", {}, StartupScheduler::MainThreadStage, [this]() {
+        m_webProfile = new QWebEngineProfile(this);
+        connect(m_webProfile, &QWebEngineProfile::downloadRequested, this, &MainApplication::downloadRequested);
+    });
+
+    // Chromium is ready once it loads a blank page, timeout is only a safety net
+    m_startupScheduler->addStage("WebEngineReady", {"WebEngineProfile"}, StartupScheduler::ReadinessStage, [this]() {
+        QWebEnginePage* probe = new QWebEnginePage(m_webProfile, this);
+        connect(probe, &QWebEnginePage::loadFinished, this, [this, probe]() {
+            probe->deleteLater();
+            m_startupScheduler->markReady("WebEngineReady");
+        });
+        connect(m_startupScheduler, &StartupScheduler::stageFinished, probe, [probe](const QString &name) {
+            if (name == QLatin1String("WebEngineReady")) {
+                probe->deleteLater();
+            }
+        });
+        probe->load(QUrl(QSL("about:blank")));
+    });
+    m_startupScheduler->setStageTimeout("WebEngineReady", 5000);
+
+    m_startupScheduler->addStage("ParseBookmarks", {}, StartupScheduler::WorkerStage, []() {
+        Bookmarks::preloadBookmarks();
+    });
+
+    m_startupScheduler->addStage("Bookmarks", {"ParseBookmarks"}, StartupScheduler::MainThreadStage, [this]() {
+        bookmarks();
+    });
+
+    // Search engines are loaded with their icons, QIcon can only be created in main thread
+    m_startupScheduler->addStage("SearchEngines", {}, StartupScheduler::MainThreadStage, [this]() {
+        searchEnginesManager();
+    });
+
+    // Subscriptions are parsed while Chromium starts, AdBlockManager is created with plugins
+    m_startupScheduler->addStage("ParseAdBlock", {}, StartupScheduler::WorkerStage, []() {
+        AdBlockSubscription::preloadSubscriptions();
+    });
+
+    m_startupScheduler->addStage("Components", {"WebEngineReady", "ParseAdBlock"}, StartupScheduler::MainThreadStage, [this]() {
+        m_networkManager = new NetworkManager(this);
+        m_autoFill = new AutoFill(this);
+        m_plugins->loadPlugins();
+        loadSettings();
+        setupUserScripts();
+    });
+
+    m_startupScheduler->addStage("Window", {"Components", "Bookmarks", "SearchEngines"}, StartupScheduler::MainThreadStage, [this]() {
+        BrowserWindow* window = createWindow(Qz::BW_FirstAppWindow);
+        connect(window, SIGNAL(startingCompleted()), this, SLOT(restoreOverrideCursor()));
+        connect(window, SIGNAL(startingCompleted()), this, SLOT(onWindowStartingCompleted()));
+        connect(window, &BrowserWindow::startingCompleted, this, [this]() {
+            m_startupScheduler->markReady("WindowStarted");
+        });
+    });
+
+    const QList<const char*> windowCreated = {"Window"};
+    Q_UNUSED(window);
+#else
+    connect(window, &BrowserWindow::startingCompleted, this, [this]() {
+        m_startupScheduler->markReady("WindowStarted");
+    });
+
+    const QList<const char*> windowCreated;
+#endif
+
+    // Icons of recently visited pages are needed by tabs, menus and completer of first window
+    m_startupScheduler->addStage("WarmUpIcons", {}, StartupScheduler::WorkerStage, []() {
+        IconProvider::instance()->warmUpIconCache();
+    });
+
+    m_startupScheduler->addStage("PostLaunch", windowCreated, StartupScheduler::MainThreadStage, [this]() {
+        postLaunch();
+    });
+
+    // Tabs can be restored only after the window finished starting
+    m_startupScheduler->addStage("WindowStarted", windowCreated, StartupScheduler::ReadinessStage);
+
+    // Deferred actions would only slow down loading of the first page
+    m_startupScheduler->addStage("FirstPageLoaded", {"WindowStarted"}, StartupScheduler::ReadinessStage, [this]() {
+        BrowserWindow* window = getWindow();
+        TabbedWebView* view = window ? window->weView() : nullptr;
+
+        if (!view || !view->isLoading()) {
+            m_startupScheduler->markReady("FirstPageLoaded");
+            return;
+        }
+
+        auto connection = std::make_shared<QMetaObject::Connection>();
+        *connection = connect(view, &WebView::loadFinished, m_startupScheduler, [this, connection]() {
+            disconnect(*connection);
+            m_startupScheduler->markReady("FirstPageLoaded");
+        });
+    });
+    m_startupScheduler->setStageTimeout("FirstPageLoaded", 5000);
+
+    m_startupScheduler->addStage("DeferredPostLaunch", {"FirstPageLoaded"}, StartupScheduler::MainThreadStage, [this]() {
+        runDeferredPostLaunchActions();
+    });
 }
 
 QByteArray MainApplication::saveState() const
@@ -944,9 +1061,12 @@ void MainApplication::saveSettings()
         m_cookieJar->deleteAllCookies();
     }
     if (deleteCache) {
-        QzTools::removeDir(mApp->webProfile()->cachePath());
+        DatabaseMaintenance::instance()->removeDirectories(QStringList() << mApp->webProfile()->cachePath());
     }
 
+    // Cancels pending idle maintenance and finishes clearing data requested above
+    DatabaseMaintenance::instance()->shutdown();
+
     m_searchEnginesManager->saveSettings();
     m_plugins->shutdown();
     m_networkManager->shutdown();
@@ -1027,6 +1147,7 @@ void MainApplication::windowDestroyed(QObject* window)
     Q_ASSERT(m_windows.contains(static_cast<BrowserWindow*>(window)));
 
     m_windows.removeOne(static_cast<BrowserWindow*>(window));
+    TraceRecorder::instance()->counterEvent("Windows", m_windows.count());
 }
 
 void MainApplication::onFocusChanged()
@@ -1053,6 +1174,8 @@ void MainApplication::downloadRequested(QWebEngineDownloadItem *download)
 
 void MainApplication::loadSettings()
 {
+    TraceScope trace("MainApplication::loadSettings", "startup");
+
     std::cerr << "[MAINAPPLICATION] loadSettings() started" << std::endl;
     Settings settings;
     settings.beginGroup("Themes");
@@ -1181,24 +1304,27 @@ void MainApplication::loadTheme(const QString &name)
         activeThemePath = QString("%1/%2").arg(DataPaths::path(DataPaths::Themes), DEFAULT_THEME_NAME);
     }
 
-    QString qss = QzTools::readAllFileContents(activeThemePath + QLatin1String("/main.css"));
+    QStringList files;
+    files << activeThemePath + QLatin1String("/main.css");
 
     // webOS is Linux-based
-    qss.append(QzTools::readAllFileContents(activeThemePath + QLatin1String("/linux.css")));
+    files << activeThemePath + QLatin1String("/linux.css");
 
     if (isRightToLeft()) {
-        qss.append(QzTools::readAllFileContents(activeThemePath + QLatin1String("/rtl.css")));
+        files << activeThemePath + QLatin1String("/rtl.css");
     }
 
     if (isPrivate()) {
-        qss.append(QzTools::readAllFileContents(activeThemePath + QLatin1String("/private.css")));
+        files << activeThemePath + QLatin1String("/private.css");
     }
 
-    qss.append(QzTools::readAllFileContents(DataPaths::currentProfilePath() + QL1S("/userChrome.css")));
+    files << DataPaths::currentProfilePath() + QL1S("/userChrome.css");
+
+    if (!m_themeCompiler) {
+        m_themeCompiler = new ThemeCompiler(DataPaths::path(DataPaths::Cache) + QL1S("/themes"), this);
+    }
 
-    QString relativePath = QDir::current().relativeFilePath(activeThemePath);
-    qss.replace(QzRegExp(QSL("url\\s*\\(\\s*([^\\*:\\);]+)\\s*\\)"), Qt::CaseSensitive), QString("url(%1/\\1)").arg(relativePath));
-    setStyleSheet(qss);
+    m_themeCompiler->apply(m_themeCompiler->compile(activeThemePath, files));
 }
 
 void MainApplication::translateApp()
@@ -49,8 +49,11 @@ class SearchEnginesManager;
 class HTML5PermissionsManager;
 class DesktopNotificationsFactory;
 class ProxyStyle;
+class ThemeCompiler;
 class SessionManager;
+class SessionStore;
 class ClosedWindowsManager;
+class StartupScheduler;
 
 class QUPZILLA_EXPORT MainApplication : public QtSingleApplication
 {
@@ -104,6 +107,7 @@ public:
     NetworkManager* networkManager();
     RestoreManager* restoreManager();
     SessionManager* sessionManager();
+    SessionStore* sessionStore();
     DownloadManager* downloadManager();
     UserAgentManager* userAgentManager();
     SearchEnginesManager* searchEnginesManager();
@@ -112,6 +116,7 @@ public:
     DesktopNotificationsFactory* desktopNotifications();
     QWebEngineProfile* webProfile() const;
     QWebEngineSettings *webSettings() const;
+    StartupScheduler* startupScheduler() const;
 
     QByteArray saveState() const;
 
@@ -158,6 +163,8 @@ private:
         ToggleFullScreen
     };
 
+    void setupStartupStages(BrowserWindow* window);
+
     void loadSettings();
     void loadTheme(const QString &name);
 
@@ -185,6 +192,7 @@ private:
     NetworkManager* m_networkManager;
     RestoreManager* m_restoreManager;
     SessionManager* m_sessionManager;
+    SessionStore* m_sessionStore;
     DownloadManager* m_downloadManager;
     UserAgentManager* m_userAgentManager;
     SearchEnginesManager* m_searchEnginesManager;
@@ -192,9 +200,11 @@ private:
     HTML5PermissionsManager* m_html5PermissionsManager;
     DesktopNotificationsFactory* m_desktopNotifications;
     QWebEngineProfile* m_webProfile;
+    StartupScheduler* m_startupScheduler;
 
     AutoSaver* m_autoSaver;
     ProxyStyle *m_proxyStyle = nullptr;
+    ThemeCompiler* m_themeCompiler = nullptr;
 
     QList<BrowserWindow*> m_windows;
     QPointer<BrowserWindow> m_lastActiveWindow;
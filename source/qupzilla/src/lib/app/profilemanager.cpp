@@ -21,13 +21,19 @@
 #include "updater.h"
 #include "qztools.h"
 #include "sqldatabase.h"
+#include "tracerecorder.h"
 
 #include <QDir>
 #include <QSqlDatabase>
+#include <QSqlError>
+#include <QDebug>
 #include <QMessageBox>
 #include <QSettings>
 #include <iostream>
 
+// Bump when adding new step to updateDatabaseSchema()
+static const int s_databaseSchemaVersion = 1;
+
 ProfileManager::ProfileManager()
     : m_databaseConnected(false)
 {
@@ -256,6 +262,8 @@ void ProfileManager::copyDataToProfile()
 
 void ProfileManager::connectDatabase()
 {
+    TraceScope trace("ProfileManager::connectDatabase", "startup");
+
     const QString dbFile = DataPaths::currentProfilePath() + QLatin1String("/browsedata.db");
 
     // Reconnect
@@ -281,8 +289,55 @@ void ProfileManager::connectDatabase()
     if (!db.open()) {
         qWarning("Cannot open SQLite database! Continuing without database....");
     }
+    else if (!mApp->isPrivate()) {
+        updateDatabaseSchema();
+    }
 
     SqlDatabase::instance()->setDatabase(db);
 
     m_databaseConnected = true;
 }
+
+void ProfileManager::updateDatabaseSchema()
+{
+    // Schema version is stored in database, so it is also updated for
+    // profiles copied from older versions
+    QSqlDatabase db = SqlDatabase::instance()->database();
+    QSqlQuery query(db);
+    query.exec(QSL("PRAGMA user_version"));
+    const int version = query.next() ? query.value(0).toInt() : 0;
+    query.finish();
+
+    if (version >= s_databaseSchemaVersion) {
+        return;
+    }
+
+    QStringList steps;
+
+    if (version < 1) {
+        // Recent and most visited history lists
+        steps.append(QSL("CREATE INDEX IF NOT EXISTS historyDate ON history(date DESC)"));
+        steps.append(QSL("CREATE INDEX IF NOT EXISTS historyCount ON history(count DESC)"));
+    }
+
+    // Version is only bumped when all steps succeed, failed update is retried on next start
+    steps.append(QSL("PRAGMA user_version = %1").arg(s_databaseSchemaVersion));
+
+    if (!db.transaction()) {
+        qWarning() << "Cannot update database schema:" << db.lastError().text();
+        return;
+    }
+
+    foreach (const QString &step, steps) {
+        if (!query.exec(step)) {
+            qWarning() << "Cannot update database schema:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+    }
+
+    if (!db.commit()) {
+        qWarning() << "Cannot update database schema:" << db.lastError().text();
+        db.rollback();
+    }
+}
@@ -53,6 +53,7 @@ private:
     void copyDataToProfile();
 
     void connectDatabase();
+    void updateDatabaseSchema();
 
     bool m_databaseConnected;
 };
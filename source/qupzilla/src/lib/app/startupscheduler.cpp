@@ -0,0 +1,279 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "startupscheduler.h"
+#include "tracerecorder.h"
+
+#include <QDebug>
+#include <QFutureWatcher>
+#include <QTimer>
+#include <QtConcurrent/QtConcurrentRun>
+
+StartupScheduler::StartupScheduler(QObject* parent)
+    : QObject(parent)
+    , m_started(false)
+    , m_finished(false)
+    , m_advancing(false)
+    , m_advanceAgain(false)
+{
+}
+
+void StartupScheduler::addStage(const char* name, const QList<const char*> &dependencies, StageType type, const std::function<void()> &func)
+{
+    Q_ASSERT(stageIndex(name) == -1);
+
+    Stage stage;
+    stage.name = name;
+    stage.type = type;
+    stage.func = func;
+    stage.timeout = -1;
+    stage.state = Waiting;
+    stage.ready = false;
+    stage.traceStart = 0;
+
+    for (const char* dependency : dependencies) {
+        stage.dependencies.append(QByteArray(dependency));
+    }
+
+    m_stages.append(stage);
+
+    if (m_started) {
+        m_finished = false;
+        advance();
+    }
+}
+
+void StartupScheduler::setStageTimeout(const char* name, int msec)
+{
+    const int index = stageIndex(name);
+    if (index != -1) {
+        m_stages[index].timeout = msec;
+    }
+}
+
+void StartupScheduler::markReady(const char* name)
+{
+    const int index = stageIndex(name);
+    if (index == -1) {
+        qWarning() << "StartupScheduler: Unknown stage" << name;
+        return;
+    }
+
+    Stage &stage = m_stages[index];
+    Q_ASSERT(stage.type == ReadinessStage);
+
+    if (stage.state == Running) {
+        stageDone(index);
+    }
+    else if (stage.state == Waiting) {
+        stage.ready = true;
+    }
+}
+
+bool StartupScheduler::isStageFinished(const char* name) const
+{
+    const int index = stageIndex(name);
+    return index != -1 && m_stages.at(index).state == Done;
+}
+
+bool StartupScheduler::isFinished() const
+{
+    return m_finished;
+}
+
+void StartupScheduler::runAfterStage(const char* name, QObject* context, const std::function<void()> &func)
+{
+    const int index = stageIndex(name);
+
+    if (index == -1 || m_stages.at(index).state == Done) {
+        QTimer::singleShot(0, context, func);
+        return;
+    }
+
+    Waiter waiter;
+    waiter.context = context;
+    waiter.func = func;
+    m_stages[index].waiters.append(waiter);
+}
+
+void StartupScheduler::start()
+{
+    if (m_started) {
+        return;
+    }
+
+    m_started = true;
+
+    for (const Stage &stage : qAsConst(m_stages)) {
+        for (const QByteArray &dependency : stage.dependencies) {
+            if (stageIndex(dependency) == -1) {
+                qWarning() << "StartupScheduler: Stage" << stage.name << "depends on unknown stage" << dependency;
+            }
+        }
+    }
+
+    QTimer::singleShot(0, this, &StartupScheduler::advance);
+}
+
+int StartupScheduler::stageIndex(const QByteArray &name) const
+{
+    for (int i = 0; i < m_stages.count(); ++i) {
+        if (name == m_stages.at(i).name) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool StartupScheduler::canStart(const Stage &stage) const
+{
+    for (const QByteArray &dependency : stage.dependencies) {
+        const int index = stageIndex(dependency);
+        if (index != -1 && m_stages.at(index).state != Done) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void StartupScheduler::startStage(int index)
+{
+    Stage &stage = m_stages[index];
+    stage.state = Running;
+    stage.traceStart = TraceRecorder::instance()->timestamp();
+    stage.timer.start();
+
+    switch (stage.type) {
+    case MainThreadStage:
+        if (stage.func) {
+            stage.func();
+        }
+        stageDone(index);
+        break;
+
+    case WorkerStage: {
+        QFutureWatcher<void>* watcher = new QFutureWatcher<void>(this);
+        connect(watcher, &QFutureWatcher<void>::finished, this, [=]() {
+            watcher->deleteLater();
+            stageDone(index);
+        });
+        watcher->setFuture(QtConcurrent::run(stage.func));
+        break;
+    }
+
+    case ReadinessStage:
+        if (stage.timeout >= 0) {
+            QTimer::singleShot(stage.timeout, this, [=]() {
+                if (m_stages.at(index).state == Running) {
+                    TraceRecorder::instance()->instantEvent(m_stages.at(index).name, "startup", QSL("timeout"));
+                    stageDone(index);
+                }
+            });
+        }
+
+        if (stage.func) {
+            stage.func();
+        }
+
+        // Marked ready before it was started
+        if (m_stages.at(index).ready && m_stages.at(index).state == Running) {
+            stageDone(index);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void StartupScheduler::stageDone(int index)
+{
+    Stage &stage = m_stages[index];
+    if (stage.state == Done) {
+        return;
+    }
+
+    stage.state = Done;
+    const qint64 elapsed = stage.timer.elapsed();
+
+    TraceRecorder::instance()->completeEvent(stage.name, "startup", stage.traceStart);
+
+    const QVector<Waiter> waiters = stage.waiters;
+    stage.waiters.clear();
+
+    for (const Waiter &waiter : waiters) {
+        if (waiter.context) {
+            QTimer::singleShot(0, waiter.context.data(), waiter.func);
+        }
+    }
+
+    emit stageFinished(QString::fromLatin1(m_stages.at(index).name), elapsed);
+
+    advance();
+}
+
+void StartupScheduler::advance()
+{
+    if (!m_started) {
+        return;
+    }
+
+    // Stages finishing synchronously would otherwise recurse back here
+    if (m_advancing) {
+        m_advanceAgain = true;
+        return;
+    }
+
+    m_advancing = true;
+
+    do {
+        m_advanceAgain = false;
+
+        // Start worker stages first, so they run while main thread stages are blocking
+        for (int i = 0; i < m_stages.count(); ++i) {
+            if (m_stages.at(i).type == WorkerStage && m_stages.at(i).state == Waiting && canStart(m_stages.at(i))) {
+                startStage(i);
+            }
+        }
+
+        for (int i = 0; i < m_stages.count(); ++i) {
+            if (m_stages.at(i).state == Waiting && canStart(m_stages.at(i))) {
+                startStage(i);
+            }
+        }
+    } while (m_advanceAgain);
+
+    m_advancing = false;
+
+    bool allDone = true;
+    bool anyRunning = false;
+
+    for (const Stage &stage : qAsConst(m_stages)) {
+        allDone &= stage.state == Done;
+        anyRunning |= stage.state == Running;
+    }
+
+    if (allDone && !m_finished) {
+        m_finished = true;
+        emit finished();
+    }
+    else if (!allDone && !anyRunning) {
+        qWarning() << "StartupScheduler: Remaining stages have cyclic dependencies";
+    }
+}
@@ -0,0 +1,110 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef STARTUPSCHEDULER_H
+#define STARTUPSCHEDULER_H
+
+#include <QObject>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QVector>
+
+#include <functional>
+
+#include "qzcommon.h"
+
+// Runs startup stages in dependency order. A stage is started as soon as all
+// its dependencies are finished, so independent stages overlap instead of
+// waiting for fixed timer delays.
+class QUPZILLA_EXPORT StartupScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum StageType {
+        // Runs in main thread, finished when the function returns
+        MainThreadStage,
+        // Runs in global thread pool, finished when the function returns
+        WorkerStage,
+        // Function is called in main thread, finished with markReady()
+        ReadinessStage
+    };
+
+    explicit StartupScheduler(QObject* parent = 0);
+
+    // name must be a string literal (or otherwise outlive the scheduler)
+    void addStage(const char* name, const QList<const char*> &dependencies, StageType type,
+                  const std::function<void()> &func = std::function<void()>());
+
+    // ReadinessStage is finished after msec even if it was not marked ready
+    void setStageTimeout(const char* name, int msec);
+
+    // Marks ReadinessStage finished, can be called before the stage is started
+    void markReady(const char* name);
+
+    bool isStageFinished(const char* name) const;
+    bool isFinished() const;
+
+    // Calls func in next event loop iteration after the stage is finished
+    void runAfterStage(const char* name, QObject* context, const std::function<void()> &func);
+
+    // Starts running stages once event loop is running
+    void start();
+
+signals:
+    void stageFinished(const QString &name, qint64 msecs);
+    void finished();
+
+private:
+    enum StageState {
+        Waiting,
+        Running,
+        Done
+    };
+
+    struct Waiter {
+        QPointer<QObject> context;
+        std::function<void()> func;
+    };
+
+    struct Stage {
+        const char* name;
+        QList<QByteArray> dependencies;
+        StageType type;
+        std::function<void()> func;
+        int timeout;
+        StageState state;
+        bool ready;
+        qint64 traceStart;
+        QElapsedTimer timer;
+        QVector<Waiter> waiters;
+    };
+
+    int stageIndex(const QByteArray &name) const;
+    bool canStart(const Stage &stage) const;
+    void startStage(int index);
+    void stageDone(int index);
+    void advance();
+
+    QVector<Stage> m_stages;
+    bool m_started;
+    bool m_finished;
+    bool m_advancing;
+    bool m_advanceAgain;
+};
+
+#endif // STARTUPSCHEDULER_H
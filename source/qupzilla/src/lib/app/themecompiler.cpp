@@ -0,0 +1,343 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "themecompiler.h"
+#include "qztools.h"
+#include "qzregexp.h"
+
+#include <QApplication>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QEvent>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QWidget>
+
+static const quint32 s_cacheVersion = 1;
+static const char* s_scopedProperty = "_qz_theme_scoped";
+
+// Removes comments, quoted strings are kept untouched
+static QString stripComments(const QString &qss)
+{
+    QString out;
+    out.reserve(qss.size());
+
+    const int length = qss.size();
+    int i = 0;
+
+    while (i < length) {
+        const QChar c = qss.at(i);
+
+        if (c == QL1C('"') || c == QL1C('\'')) {
+            int end = qss.indexOf(c, i + 1);
+            end = end == -1 ? length : end + 1;
+            out.append(qss.midRef(i, end - i));
+            i = end;
+        }
+        else if (c == QL1C('/') && i + 1 < length && qss.at(i + 1) == QL1C('*')) {
+            const int end = qss.indexOf(QL1S("*/"), i + 2);
+            i = end == -1 ? length : end + 2;
+        }
+        else {
+            out.append(c);
+            ++i;
+        }
+    }
+
+    return out;
+}
+
+// Returns index of c outside of quoted strings, or -1
+static int findChar(const QString &text, QChar c, int from)
+{
+    for (int i = from; i < text.size(); ++i) {
+        const QChar ch = text.at(i);
+        if (ch == QL1C('"') || ch == QL1C('\'')) {
+            const int end = text.indexOf(ch, i + 1);
+            if (end == -1) {
+                return -1;
+            }
+            i = end;
+        }
+        else if (ch == c) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Returns QupZilla class name if all selectors start with it, empty string otherwise
+static QString selectorScope(const QString &selectors)
+{
+    QStringList parts;
+    int depth = 0;
+    int start = 0;
+
+    for (int i = 0; i < selectors.size(); ++i) {
+        const QChar c = selectors.at(i);
+        if (c == QL1C('[') || c == QL1C('(')) {
+            ++depth;
+        }
+        else if (c == QL1C(']') || c == QL1C(')')) {
+            --depth;
+        }
+        else if (c == QL1C(',') && depth == 0) {
+            parts.append(selectors.mid(start, i - start).trimmed());
+            start = i + 1;
+        }
+    }
+    parts.append(selectors.mid(start).trimmed());
+
+    QString scope;
+
+    foreach (const QString &selector, parts) {
+        int i = selector.startsWith(QL1C('.')) ? 1 : 0;
+        const int nameStart = i;
+        while (i < selector.size() && (selector.at(i).isLetterOrNumber() || selector.at(i) == QL1C('_'))) {
+            ++i;
+        }
+        const QString name = selector.mid(nameStart, i - nameStart);
+
+        // Qt classes are used everywhere, only QupZilla classes can be scoped
+        if (name.isEmpty() || !name.at(0).isUpper() || (name.size() > 1 && name.at(0) == QL1C('Q') && name.at(1).isUpper())) {
+            return QString();
+        }
+
+        if (!scope.isEmpty() && scope != name) {
+            return QString();
+        }
+        scope = name;
+    }
+
+    return scope;
+}
+
+ThemeCompiler::ThemeCompiler(const QString &cachePath, QObject* parent)
+    : QObject(parent)
+    , m_cachePath(cachePath)
+{
+}
+
+CompiledTheme ThemeCompiler::compile(const QString &themePath, const QStringList &files) const
+{
+    const QString relativePath = QDir::current().relativeFilePath(themePath);
+    const QString cacheFile = m_cachePath.isEmpty() ? QString() : cacheFileName(themePath, relativePath, files);
+
+    CompiledTheme theme;
+
+    if (!cacheFile.isEmpty()) {
+        QFile file(cacheFile);
+        if (file.open(QFile::ReadOnly)) {
+            QDataStream stream(&file);
+            quint32 version = 0;
+            stream >> version;
+            if (version == s_cacheVersion) {
+                stream >> theme.styleSheet >> theme.scopedStyleSheets;
+                if (stream.status() == QDataStream::Ok) {
+                    return theme;
+                }
+            }
+            theme = CompiledTheme();
+        }
+    }
+
+    QString qss;
+    foreach (const QString &fileName, files) {
+        qss.append(QzTools::readAllFileContents(fileName));
+    }
+
+    theme = process(qss, relativePath);
+
+    if (!cacheFile.isEmpty() && QDir().mkpath(m_cachePath)) {
+        QSaveFile file(cacheFile);
+        if (file.open(QFile::WriteOnly)) {
+            QDataStream stream(&file);
+            stream << s_cacheVersion << theme.styleSheet << theme.scopedStyleSheets;
+            if (file.commit()) {
+                pruneCache(cacheFile);
+            }
+        }
+    }
+
+    return theme;
+}
+
+void ThemeCompiler::apply(const CompiledTheme &theme)
+{
+    qApp->setStyleSheet(theme.styleSheet);
+
+    const bool hadScoped = !m_scopedStyleSheets.isEmpty();
+    m_scopedStyleSheets = theme.scopedStyleSheets;
+    m_scopedByClass.clear();
+
+    if (m_scopedStyleSheets.isEmpty()) {
+        qApp->removeEventFilter(this);
+    }
+    else if (!hadScoped) {
+        qApp->installEventFilter(this);
+    }
+
+    // Update already polished widgets, new widgets are handled in eventFilter
+    foreach (QWidget* widget, QApplication::allWidgets()) {
+        if (widget->testAttribute(Qt::WA_WState_Polished) || widget->property(s_scopedProperty).isValid()) {
+            applyScoped(widget);
+        }
+    }
+}
+
+CompiledTheme ThemeCompiler::process(const QString &qss, const QString &relativePath)
+{
+    QString source = stripComments(qss);
+    source.replace(QzRegExp(QSL("url\\s*\\(\\s*([^\\*:\\);]+)\\s*\\)"), Qt::CaseSensitive), QString("url(%1/\\1)").arg(relativePath));
+
+    CompiledTheme theme;
+    QHash<QString, int> scopeIndex;
+
+    const int length = source.size();
+    int i = 0;
+
+    while (i < length) {
+        const int open = findChar(source, QL1C('{'), i);
+        if (open == -1) {
+            break;
+        }
+
+        // Find matching brace, ignoring braces in quoted strings
+        int close = open + 1;
+        int depth = 1;
+        while (close < length && depth > 0) {
+            const QChar c = source.at(close);
+            if (c == QL1C('"') || c == QL1C('\'')) {
+                const int end = source.indexOf(c, close + 1);
+                close = end == -1 ? length : end + 1;
+                continue;
+            }
+            if (c == QL1C('{')) {
+                ++depth;
+            }
+            else if (c == QL1C('}')) {
+                --depth;
+            }
+            ++close;
+        }
+
+        const QString selectors = source.mid(i, open - i).simplified();
+        const QString body = source.mid(open + 1, close - open - 2).simplified();
+        i = close;
+
+        if (selectors.isEmpty()) {
+            continue;
+        }
+
+        const QString rule = selectors + QL1C('{') + body + QL1C('}');
+        const QString scope = selectors.startsWith(QL1C('@')) ? QString() : selectorScope(selectors);
+
+        if (scope.isEmpty()) {
+            theme.styleSheet.append(rule);
+        }
+        else if (scopeIndex.contains(scope)) {
+            theme.scopedStyleSheets[scopeIndex.value(scope)].second.append(rule);
+        }
+        else {
+            scopeIndex.insert(scope, theme.scopedStyleSheets.size());
+            theme.scopedStyleSheets.append(qMakePair(scope, rule));
+        }
+    }
+
+    return theme;
+}
+
+bool ThemeCompiler::eventFilter(QObject* obj, QEvent* event)
+{
+    if (event->type() == QEvent::Polish && obj->isWidgetType()) {
+        applyScoped(static_cast<QWidget*>(obj));
+    }
+
+    return QObject::eventFilter(obj, event);
+}
+
+QString ThemeCompiler::cacheFileName(const QString &themePath, const QString &relativePath, const QStringList &files) const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(themePath.toUtf8());
+    hash.addData(relativePath.toUtf8());
+
+    foreach (const QString &fileName, files) {
+        const QFileInfo info(fileName);
+        hash.addData(fileName.toUtf8());
+        hash.addData(QByteArray::number(info.exists() ? info.lastModified().toMSecsSinceEpoch() : -1));
+        hash.addData(QByteArray::number(info.size()));
+    }
+
+    return QSL("%1/%2.qss").arg(m_cachePath, QString::fromLatin1(hash.result().toHex()));
+}
+
+// Only the current theme is kept, files of modified or other themes are removed
+void ThemeCompiler::pruneCache(const QString &currentFile) const
+{
+    const QString currentName = QFileInfo(currentFile).fileName();
+    QDir dir(m_cachePath);
+
+    foreach (const QString &fileName, dir.entryList(QStringList(QSL("*.qss")), QDir::Files)) {
+        if (fileName != currentName) {
+            dir.remove(fileName);
+        }
+    }
+}
+
+QString ThemeCompiler::scopedStyleSheet(const QMetaObject* metaObject)
+{
+    QHash<const QMetaObject*, QString>::const_iterator it = m_scopedByClass.constFind(metaObject);
+    if (it != m_scopedByClass.constEnd()) {
+        return it.value();
+    }
+
+    QStringList classNames;
+    for (const QMetaObject* mo = metaObject; mo; mo = mo->superClass()) {
+        classNames.append(QString::fromLatin1(mo->className()));
+    }
+
+    QString scoped;
+    for (const auto &pair : m_scopedStyleSheets) {
+        if (classNames.contains(pair.first)) {
+            scoped.append(pair.second);
+        }
+    }
+
+    m_scopedByClass.insert(metaObject, scoped);
+    return scoped;
+}
+
+void ThemeCompiler::applyScoped(QWidget* widget)
+{
+    const QString scoped = scopedStyleSheet(widget->metaObject());
+    const QString previous = widget->property(s_scopedProperty).toString();
+    if (scoped == previous) {
+        return;
+    }
+
+    // Keep the widget's own style sheet after the theme rules
+    QString styleSheet = widget->styleSheet();
+    if (!previous.isEmpty() && styleSheet.startsWith(previous)) {
+        styleSheet.remove(0, previous.size());
+    }
+
+    widget->setProperty(s_scopedProperty, scoped);
+    widget->setStyleSheet(scoped + styleSheet);
+}
@@ -0,0 +1,75 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef THEMECOMPILER_H
+#define THEMECOMPILER_H
+
+#include <QHash>
+#include <QObject>
+#include <QPair>
+#include <QVector>
+
+#include "qzcommon.h"
+
+class QWidget;
+struct QMetaObject;
+
+struct CompiledTheme
+{
+    // Rules set as application style sheet
+    QString styleSheet;
+    // Rules that only apply to instances of QupZilla classes (class name, rules)
+    QVector<QPair<QString, QString> > scopedStyleSheets;
+};
+
+// Compiles theme style sheets and caches the result on disk.
+//
+// Application style sheet is matched against every widget on each polish, so rules
+// whose selectors start with QupZilla class (eg. "LocationBar QToolButton") are moved
+// to the style sheet of the instances of that class.
+class QUPZILLA_EXPORT ThemeCompiler : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Empty cachePath disables the cache
+    explicit ThemeCompiler(const QString &cachePath, QObject* parent = 0);
+
+    // Compiles files (in order) of theme in themePath, or loads them from the cache
+    CompiledTheme compile(const QString &themePath, const QStringList &files) const;
+
+    // Sets application style sheet and scoped style sheets to matching widgets
+    void apply(const CompiledTheme &theme);
+
+    static CompiledTheme process(const QString &qss, const QString &relativePath);
+
+protected:
+    bool eventFilter(QObject* obj, QEvent* event) Q_DECL_OVERRIDE;
+
+private:
+    QString cacheFileName(const QString &themePath, const QString &relativePath, const QStringList &files) const;
+    void pruneCache(const QString &currentFile) const;
+    QString scopedStyleSheet(const QMetaObject* metaObject);
+    void applyScoped(QWidget* widget);
+
+    QString m_cachePath;
+    QVector<QPair<QString, QString> > m_scopedStyleSheets;
+    // Scoped rules of already seen classes, rebuilt when theme is applied
+    QHash<const QMetaObject*, QString> m_scopedByClass;
+};
+
+#endif // THEMECOMPILER_H
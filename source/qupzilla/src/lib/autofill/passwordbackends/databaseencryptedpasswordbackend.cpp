@@ -24,6 +24,9 @@
 #include "ui_masterpassworddialog.h"
 #include "sqldatabase.h"
 
+#include <QHash>
+#include <QMutexLocker>
+#include <QThread>
 #include <QVector>
 #include <QMessageBox>
 
@@ -34,6 +37,7 @@ DatabaseEncryptedPasswordBackend::DatabaseEncryptedPasswordBackend()
     , m_stateOfMasterPassword(UnKnownState)
     , m_askPasswordDialogVisible(false)
     , m_askMasterPassword(false)
+    , m_aes(new AesInterface)
 {
     QSqlDatabase db = SqlDatabase::instance()->database();
     if (!db.tables().contains(QLatin1String("autofill_encrypted"))) {
@@ -45,6 +49,7 @@ DatabaseEncryptedPasswordBackend::DatabaseEncryptedPasswordBackend()
 
 DatabaseEncryptedPasswordBackend::~DatabaseEncryptedPasswordBackend()
 {
+    delete m_aes;
 }
 
 QStringList DatabaseEncryptedPasswordBackend::getUsernames(const QUrl &url)
@@ -69,8 +74,6 @@ QVector<PasswordEntry> DatabaseEncryptedPasswordBackend::getEntries(const QUrl &
 {
     QVector<PasswordEntry> list;
 
-    AesInterface aesDecryptor;
-
     const QString host = PasswordManager::createHost(url);
 
     QSqlQuery query(SqlDatabase::instance()->database());
@@ -87,12 +90,11 @@ QVector<PasswordEntry> DatabaseEncryptedPasswordBackend::getEntries(const QUrl &
             data.username = query.value(1).toString();
             data.password = query.value(2).toString();
             data.data = query.value(3).toByteArray();
-
-            if (decryptPasswordEntry(data, &aesDecryptor)) {
-                list.append(data);
-            }
+            list.append(data);
         }
         while (query.next());
+
+        decryptPasswordEntries(list);
     }
 
     return list;
@@ -102,8 +104,6 @@ QVector<PasswordEntry> DatabaseEncryptedPasswordBackend::getAllEntries()
 {
     QVector<PasswordEntry> list;
 
-    AesInterface aesDecryptor;
-
     QSqlQuery query(SqlDatabase::instance()->database());
     query.prepare("SELECT id, server, username_encrypted, password_encrypted, data_encrypted FROM autofill_encrypted");
     query.exec();
@@ -119,17 +119,98 @@ QVector<PasswordEntry> DatabaseEncryptedPasswordBackend::getAllEntries()
             data.username = query.value(2).toString();
             data.password = query.value(3).toString();
             data.data = query.value(4).toByteArray();
-
-            if (decryptPasswordEntry(data, &aesDecryptor)) {
-                list.append(data);
-            }
+            list.append(data);
         }
         while (query.next());
+
+        decryptPasswordEntries(list);
+    }
+
+    return list;
+}
+
+QVector<PasswordEntry> DatabaseEncryptedPasswordBackend::getAllHosts()
+{
+    QVector<PasswordEntry> list;
+
+    // server column is not encrypted, so listing doesn't need master password
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.prepare("SELECT id, server FROM autofill_encrypted WHERE server != ?");
+    query.addBindValue(INTERNAL_SERVER_ID);
+    query.exec();
+
+    while (query.next()) {
+        PasswordEntry data;
+        data.id = query.value(0);
+        data.host = query.value(1).toString();
+        list.append(data);
     }
 
     return list;
 }
 
+bool DatabaseEncryptedPasswordBackend::loadEntries(QVector<PasswordEntry> &entries, bool loadPassword, QString* errorString)
+{
+    if (entries.isEmpty()) {
+        return true;
+    }
+
+    QStringList placeholders;
+    for (int i = 0; i < entries.count(); ++i) {
+        placeholders.append(QSL("?"));
+    }
+
+    QSqlQuery query(SqlDatabase::instance()->database());
+    if (loadPassword) {
+        query.prepare(QSL("SELECT id, username_encrypted, password_encrypted, data_encrypted FROM autofill_encrypted WHERE id IN (%1)").arg(placeholders.join(QL1C(','))));
+    }
+    else {
+        query.prepare(QSL("SELECT id, username_encrypted FROM autofill_encrypted WHERE id IN (%1)").arg(placeholders.join(QL1C(','))));
+    }
+    foreach (const PasswordEntry &entry, entries) {
+        query.addBindValue(entry.id);
+    }
+    query.exec();
+
+    QHash<qint64, int> indexes;
+    for (int i = 0; i < entries.count(); ++i) {
+        indexes.insert(entries.at(i).id.toLongLong(), i);
+    }
+
+    QMutexLocker locker(&m_aesMutex);
+    const QByteArray password = m_masterPassword;
+    QString error;
+    bool ok = true;
+
+    while (query.next()) {
+        const int index = indexes.value(query.value(0).toLongLong(), -1);
+        if (index == -1) {
+            continue;
+        }
+
+        PasswordEntry &entry = entries[index];
+        entry.username = QString::fromUtf8(m_aes->decrypt(query.value(1).toByteArray(), password));
+        ok &= m_aes->isOk();
+
+        if (loadPassword) {
+            entry.password = QString::fromUtf8(m_aes->decrypt(query.value(2).toByteArray(), password));
+            ok &= m_aes->isOk();
+            entry.data = m_aes->decrypt(query.value(3).toByteArray(), password);
+            ok &= m_aes->isOk();
+        }
+
+        if (!m_aes->errorString().isEmpty()) {
+            error = m_aes->errorString();
+        }
+    }
+
+    if (errorString) {
+        *errorString = error;
+    }
+
+    return ok;
+}
+
 void DatabaseEncryptedPasswordBackend::setActive(bool active)
 {
     if (active == isActive()) {
@@ -149,7 +230,11 @@ void DatabaseEncryptedPasswordBackend::setActive(bool active)
         // maybe ask from user for decrypting data
 
         // remove password from memory
+        m_aesMutex.lock();
         m_masterPassword.clear();
+        m_aes->clearKey();
+        m_aesMutex.unlock();
+
         setAskMasterPasswordState(isMasterPasswordSetted());
     }
 }
@@ -170,9 +255,8 @@ void DatabaseEncryptedPasswordBackend::addEntry(const PasswordEntry &entry)
     }
 
     PasswordEntry encryptedEntry = entry;
-    AesInterface aesEncryptor;
 
-    if (hasPermission() && encryptPasswordEntry(encryptedEntry, &aesEncryptor)) {
+    if (hasPermission() && encryptPasswordEntry(encryptedEntry)) {
         QSqlQuery query(SqlDatabase::instance()->database());
         query.prepare("INSERT INTO autofill_encrypted (server, data_encrypted, username_encrypted, password_encrypted, last_used) "
                       "VALUES (?,?,?,?,strftime('%s', 'now'))");
@@ -186,10 +270,9 @@ void DatabaseEncryptedPasswordBackend::addEntry(const PasswordEntry &entry)
 
 bool DatabaseEncryptedPasswordBackend::updateEntry(const PasswordEntry &entry)
 {
-    AesInterface aesEncryptor;
     PasswordEntry encryptedEntry = entry;
 
-    if (hasPermission() && encryptPasswordEntry(encryptedEntry, &aesEncryptor)) {
+    if (hasPermission() && encryptPasswordEntry(encryptedEntry)) {
         QSqlQuery query(SqlDatabase::instance()->database());
 
         // Data is empty only for HTTP/FTP authorization
@@ -321,6 +404,7 @@ bool DatabaseEncryptedPasswordBackend::isPasswordVerified(const QByteArray &pass
         AesInterface aes;
         aes.decrypt(someDataFromDatabase(), password);
         if (aes.isOk()) {
+            QMutexLocker locker(&m_aesMutex);
             m_masterPassword = password;
             return true;
         }
@@ -347,6 +431,42 @@ bool DatabaseEncryptedPasswordBackend::encryptPasswordEntry(PasswordEntry &entry
     return aesInterface->isOk();
 }
 
+int DatabaseEncryptedPasswordBackend::decryptPasswordEntries(QVector<PasswordEntry> &entries)
+{
+    QMutexLocker locker(&m_aesMutex);
+
+    // All entries share one cipher context and key derived from master password
+    QString error;
+    int count = 0;
+    for (int i = 0; i < entries.count(); ++i) {
+        if (decryptPasswordEntry(entries[i], m_aes)) {
+            if (count != i) {
+                entries[count] = entries.at(i);
+            }
+            ++count;
+        }
+        else if (!m_aes->errorString().isEmpty()) {
+            error = m_aes->errorString();
+        }
+    }
+
+    locker.unlock();
+
+    entries.resize(count);
+
+    if (!error.isEmpty() && QThread::currentThread() == qApp->thread()) {
+        QMessageBox::information(0, AesInterface::tr("Warning!"), error);
+    }
+
+    return count;
+}
+
+bool DatabaseEncryptedPasswordBackend::encryptPasswordEntry(PasswordEntry &entry)
+{
+    QMutexLocker locker(&m_aesMutex);
+    return encryptPasswordEntry(entry, m_aes);
+}
+
 void DatabaseEncryptedPasswordBackend::showMasterPasswordDialog()
 {
     MasterPasswordDialog* masterPasswordDialog = new MasterPasswordDialog(this, mApp->getWindow());
@@ -367,8 +487,11 @@ void DatabaseEncryptedPasswordBackend::tryToChangeMasterPassword(const QByteArra
 
     encryptDataBaseTableOnFly(m_masterPassword, newPassword);
 
+    m_aesMutex.lock();
     m_masterPassword = newPassword;
-    updateSampleData(m_masterPassword);
+    m_aesMutex.unlock();
+
+    updateSampleData(newPassword);
 }
 
 void DatabaseEncryptedPasswordBackend::removeMasterPassword()
@@ -376,7 +499,11 @@ void DatabaseEncryptedPasswordBackend::removeMasterPassword()
     if (!m_masterPassword.isEmpty()) {
         encryptDataBaseTableOnFly(m_masterPassword, QByteArray());
 
+        m_aesMutex.lock();
         m_masterPassword.clear();
+        m_aes->clearKey();
+        m_aesMutex.unlock();
+
         updateSampleData(QByteArray());
     }
 }
@@ -23,6 +23,7 @@
 #include "qzcommon.h"
 
 #include <QDialog>
+#include <QMutex>
 
 class AesInterface;
 class MasterPasswordDialog;
@@ -44,6 +45,9 @@ public:
     QVector<PasswordEntry> getEntries(const QUrl &url);
     QVector<PasswordEntry> getAllEntries();
 
+    QVector<PasswordEntry> getAllHosts();
+    bool loadEntries(QVector<PasswordEntry> &entries, bool loadPassword, QString* errorString = 0);
+
     void setActive(bool active);
 
     void addEntry(const PasswordEntry &entry);
@@ -68,6 +72,10 @@ public:
     bool decryptPasswordEntry(PasswordEntry &entry, AesInterface* aesInterface);
     bool encryptPasswordEntry(PasswordEntry &entry, AesInterface* aesInterface);
 
+    // Decrypts entries with shared cipher context, entries that fail to decrypt are removed.
+    // Returns number of remaining entries
+    int decryptPasswordEntries(QVector<PasswordEntry> &entries);
+
     void tryToChangeMasterPassword(const QByteArray &newPassword);
     void removeMasterPassword();
 
@@ -82,13 +90,20 @@ public:
 
 private:
     QByteArray someDataFromDatabase();
+    bool encryptPasswordEntry(PasswordEntry &entry);
 
     MasterPasswordState m_stateOfMasterPassword;
     QByteArray m_someDataStoredOnDataBase;
 
     bool m_askPasswordDialogVisible;
     bool m_askMasterPassword;
+    // Written only with m_aesMutex locked, it is read from PasswordModel worker thread
     QByteArray m_masterPassword;
+
+    // Long-lived cipher contexts for the master password, also used from
+    // PasswordModel worker thread
+    AesInterface* m_aes;
+    QMutex m_aesMutex;
 };
 
 namespace Ui
@@ -32,6 +32,25 @@ QStringList PasswordBackend::getUsernames(const QUrl &url)
     return out;
 }
 
+QVector<PasswordEntry> PasswordBackend::getAllHosts()
+{
+    return getAllEntries();
+}
+
+bool PasswordBackend::loadEntries(QVector<PasswordEntry> &entries, bool loadPassword, QString* errorString)
+{
+    // Entries from getAllEntries() are already complete
+    Q_UNUSED(entries)
+    Q_UNUSED(loadPassword)
+    Q_UNUSED(errorString)
+    return true;
+}
+
+bool PasswordBackend::hasPermission()
+{
+    return true;
+}
+
 void PasswordBackend::setActive(bool active)
 {
     m_active = active;
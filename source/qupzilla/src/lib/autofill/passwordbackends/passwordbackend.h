@@ -35,6 +35,16 @@ public:
     virtual QVector<PasswordEntry> getEntries(const QUrl &url) = 0;
     virtual QVector<PasswordEntry> getAllEntries() = 0;
 
+    // Lists all entries without decrypting them, only id and host are guaranteed to be set.
+    // Default implementation returns getAllEntries()
+    virtual QVector<PasswordEntry> getAllHosts();
+    // Fills username (and password with data if loadPassword) of entries from getAllHosts().
+    // Called from worker thread, hasPermission() must be checked before.
+    // errorString is set to a message for user, which must be shown from main thread
+    virtual bool loadEntries(QVector<PasswordEntry> &entries, bool loadPassword, QString* errorString = 0);
+    // May ask user for permission, called from main thread
+    virtual bool hasPermission();
+
     virtual void addEntry(const PasswordEntry &entry) = 0;
     virtual bool updateEntry(const PasswordEntry &entry) = 0;
     virtual void updateLastUsed(PasswordEntry &entry) = 0;
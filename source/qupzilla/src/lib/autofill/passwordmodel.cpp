@@ -0,0 +1,350 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "passwordmodel.h"
+#include "passwordbackends/passwordbackend.h"
+
+#include <QTimer>
+#include <QMessageBox>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+// Rows decrypted in one worker job
+static const int s_batchSize = 50;
+
+PasswordModel::PasswordModel(QObject* parent)
+    : QAbstractTableModel(parent)
+    , m_backend(nullptr)
+    , m_passwordsShown(false)
+    , m_permissionAsked(false)
+    , m_permitted(false)
+    , m_errorShown(false)
+    , m_loadTimer(new QTimer(this))
+    , m_watcher(new QFutureWatcher<LoadResult>(this))
+    , m_loadingPasswords(false)
+    , m_generation(0)
+    , m_loadingGeneration(0)
+{
+    // Collects rows requested while the view is painting into one batch
+    m_loadTimer->setSingleShot(true);
+    m_loadTimer->setInterval(0);
+
+    connect(m_loadTimer, &QTimer::timeout, this, &PasswordModel::startLoading);
+    connect(m_watcher, &QFutureWatcher<LoadResult>::finished, this, &PasswordModel::loadingFinished);
+}
+
+void PasswordModel::reload(PasswordBackend* backend)
+{
+    beginResetModel();
+
+    m_backend = backend;
+    m_rows.clear();
+    m_permissionAsked = false;
+    m_permitted = false;
+    m_errorShown = false;
+    invalidateLoading();
+
+    if (m_backend) {
+        const QVector<PasswordEntry> entries = m_backend->getAllHosts();
+        m_rows.reserve(entries.count());
+
+        foreach (const PasswordEntry &entry, entries) {
+            Row row;
+            row.entry = entry;
+            m_rows.append(row);
+        }
+    }
+
+    endResetModel();
+}
+
+int PasswordModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.count();
+}
+
+int PasswordModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant PasswordModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.count()) {
+        return QVariant();
+    }
+
+    const Row &row = m_rows.at(index.row());
+
+    switch (role) {
+    case EntryRole:
+        return QVariant::fromValue(row.entry);
+
+    case SortRole:
+        switch (index.column()) {
+        case ServerColumn:
+            return row.entry.host;
+        case UsernameColumn:
+            return row.entry.username;
+        default:
+            return QVariant();
+        }
+
+    case Qt::DisplayRole:
+        switch (index.column()) {
+        case ServerColumn:
+            return row.entry.host;
+
+        case UsernameColumn:
+            if (!row.usernameLoaded) {
+                requestLoad(index.row());
+            }
+            return row.entry.username;
+
+        case PasswordColumn:
+            if (!m_passwordsShown) {
+                return QSL("*****");
+            }
+            if (!row.passwordLoaded) {
+                requestLoad(index.row());
+            }
+            return row.entry.password;
+
+        default:
+            return QVariant();
+        }
+
+    default:
+        return QVariant();
+    }
+}
+
+QVariant PasswordModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section) {
+    case ServerColumn:
+        return tr("Server");
+    case UsernameColumn:
+        return tr("Username");
+    case PasswordColumn:
+        return tr("Password");
+    default:
+        return QVariant();
+    }
+}
+
+bool PasswordModel::passwordsShown() const
+{
+    return m_passwordsShown;
+}
+
+void PasswordModel::setPasswordsShown(bool shown)
+{
+    if (m_passwordsShown == shown) {
+        return;
+    }
+
+    m_passwordsShown = shown;
+
+    // Don't keep decrypted passwords in memory once they are hidden
+    if (!m_passwordsShown) {
+        for (int i = 0; i < m_rows.count(); ++i) {
+            Row &row = m_rows[i];
+            row.entry.password.clear();
+            row.entry.data.clear();
+            row.passwordLoaded = false;
+        }
+    }
+
+    if (!m_rows.isEmpty()) {
+        emit dataChanged(index(0, PasswordColumn), index(m_rows.count() - 1, PasswordColumn));
+    }
+}
+
+PasswordEntry PasswordModel::entry(const QModelIndex &index)
+{
+    if (!index.isValid() || index.row() >= m_rows.count() || !m_backend) {
+        return PasswordEntry();
+    }
+
+    Row &row = m_rows[index.row()];
+
+    if (!row.usernameLoaded || !row.passwordLoaded) {
+        if (!m_backend->hasPermission()) {
+            return PasswordEntry();
+        }
+
+        QVector<PasswordEntry> entries;
+        entries.append(row.entry);
+
+        QString errorString;
+        m_backend->loadEntries(entries, true, &errorString);
+        showLoadError(errorString);
+
+        row.entry = entries.at(0);
+        row.usernameLoaded = true;
+        row.passwordLoaded = true;
+
+        emit dataChanged(this->index(index.row(), UsernameColumn), this->index(index.row(), PasswordColumn));
+    }
+
+    return row.entry;
+}
+
+void PasswordModel::updateEntry(const QModelIndex &index, const PasswordEntry &entry)
+{
+    if (!index.isValid() || index.row() >= m_rows.count()) {
+        return;
+    }
+
+    Row &row = m_rows[index.row()];
+    row.entry = entry;
+    row.usernameLoaded = true;
+    row.passwordLoaded = true;
+
+    emit dataChanged(this->index(index.row(), ServerColumn), this->index(index.row(), PasswordColumn));
+}
+
+void PasswordModel::removeEntry(const QModelIndex &index)
+{
+    if (!index.isValid() || index.row() >= m_rows.count()) {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), index.row(), index.row());
+    m_rows.remove(index.row());
+    invalidateLoading();
+    endRemoveRows();
+}
+
+void PasswordModel::clear()
+{
+    beginResetModel();
+    m_rows.clear();
+    invalidateLoading();
+    endResetModel();
+}
+
+void PasswordModel::startLoading()
+{
+    if (m_watcher->isRunning() || m_pendingRows.isEmpty() || !m_backend) {
+        return;
+    }
+
+    // Master password dialog must be shown from main thread
+    if (!m_permissionAsked) {
+        m_permissionAsked = true;
+        m_permitted = m_backend->hasPermission();
+    }
+
+    if (!m_permitted) {
+        m_pendingRows.clear();
+        return;
+    }
+
+    QVector<PasswordEntry> entries;
+    m_loadingRows.clear();
+
+    QSet<int>::iterator it = m_pendingRows.begin();
+    while (it != m_pendingRows.end() && m_loadingRows.count() < s_batchSize) {
+        m_loadingRows.append(*it);
+        entries.append(m_rows.at(*it).entry);
+        it = m_pendingRows.erase(it);
+    }
+
+    m_loadingPasswords = m_passwordsShown;
+    m_loadingGeneration = m_generation;
+
+    PasswordBackend* backend = m_backend;
+    const bool loadPassword = m_loadingPasswords;
+
+    m_watcher->setFuture(QtConcurrent::run([backend, entries, loadPassword]() {
+        LoadResult result;
+        result.entries = entries;
+        backend->loadEntries(result.entries, loadPassword, &result.errorString);
+        return result;
+    }));
+}
+
+void PasswordModel::loadingFinished()
+{
+    const LoadResult result = m_watcher->result();
+    const QVector<PasswordEntry> &entries = result.entries;
+
+    showLoadError(result.errorString);
+
+    // Rows were removed or the model was reset meanwhile
+    if (m_loadingGeneration == m_generation && entries.count() == m_loadingRows.count()) {
+        for (int i = 0; i < entries.count(); ++i) {
+            const int rowIndex = m_loadingRows.at(i);
+            Row &row = m_rows[rowIndex];
+
+            row.entry.username = entries.at(i).username;
+            row.usernameLoaded = true;
+
+            // Passwords could have been hidden meanwhile
+            if (m_loadingPasswords && m_passwordsShown) {
+                row.entry.password = entries.at(i).password;
+                row.entry.data = entries.at(i).data;
+                row.passwordLoaded = true;
+            }
+
+            emit dataChanged(index(rowIndex, UsernameColumn), index(rowIndex, PasswordColumn));
+        }
+    }
+
+    m_loadingRows.clear();
+
+    if (!m_pendingRows.isEmpty()) {
+        m_loadTimer->start();
+    }
+}
+
+void PasswordModel::requestLoad(int row) const
+{
+    if (m_pendingRows.contains(row) || m_loadingRows.contains(row)) {
+        return;
+    }
+
+    m_pendingRows.insert(row);
+
+    if (!m_loadTimer->isActive()) {
+        m_loadTimer->start();
+    }
+}
+
+void PasswordModel::showLoadError(const QString &errorString)
+{
+    // Every batch would fail with the same error
+    if (errorString.isEmpty() || m_errorShown) {
+        return;
+    }
+
+    m_errorShown = true;
+    QMessageBox::information(0, tr("Warning!"), errorString);
+}
+
+void PasswordModel::invalidateLoading()
+{
+    ++m_generation;
+    m_pendingRows.clear();
+    m_loadingRows.clear();
+}
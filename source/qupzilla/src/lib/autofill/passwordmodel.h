@@ -0,0 +1,112 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef PASSWORDMODEL_H
+#define PASSWORDMODEL_H
+
+#include <QAbstractTableModel>
+#include <QFutureWatcher>
+#include <QSet>
+#include <QVector>
+
+#include "qzcommon.h"
+#include "passwordmanager.h"
+
+class QTimer;
+
+class PasswordBackend;
+
+// Lists all saved passwords of a backend without decrypting them.
+// Usernames are decrypted in worker thread in small batches once their rows
+// get visible, passwords only after setPasswordsShown(true).
+class QUPZILLA_EXPORT PasswordModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Columns {
+        ServerColumn,
+        UsernameColumn,
+        PasswordColumn,
+        ColumnCount
+    };
+
+    enum Roles {
+        // Entry with only the loaded fields set, use entry() to get complete entry
+        EntryRole = Qt::UserRole + 10,
+        // Like DisplayRole, but never starts decrypting
+        SortRole = Qt::UserRole + 11
+    };
+
+    explicit PasswordModel(QObject* parent = nullptr);
+
+    void reload(PasswordBackend* backend);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    bool passwordsShown() const;
+    void setPasswordsShown(bool shown);
+
+    // Decrypts the entry in main thread if it is not loaded yet
+    PasswordEntry entry(const QModelIndex &index);
+
+    void updateEntry(const QModelIndex &index, const PasswordEntry &entry);
+    void removeEntry(const QModelIndex &index);
+    void clear();
+
+private slots:
+    void startLoading();
+    void loadingFinished();
+
+private:
+    struct Row {
+        PasswordEntry entry;
+        bool usernameLoaded = false;
+        bool passwordLoaded = false;
+    };
+
+    struct LoadResult {
+        QVector<PasswordEntry> entries;
+        QString errorString;
+    };
+
+    void requestLoad(int row) const;
+    void invalidateLoading();
+    void showLoadError(const QString &errorString);
+
+    QVector<Row> m_rows;
+    PasswordBackend* m_backend;
+    bool m_passwordsShown;
+    bool m_permissionAsked;
+    bool m_permitted;
+    bool m_errorShown;
+
+    // Rows are requested from const data()
+    mutable QSet<int> m_pendingRows;
+    QTimer* m_loadTimer;
+
+    QFutureWatcher<LoadResult>* m_watcher;
+    QVector<int> m_loadingRows;
+    bool m_loadingPasswords;
+    int m_generation;
+    int m_loadingGeneration;
+};
+
+#endif // PASSWORDMODEL_H
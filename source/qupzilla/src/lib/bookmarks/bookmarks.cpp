@@ -24,6 +24,8 @@
 #include "settings.h"
 #include "qztools.h"
 
+#include <QMutex>
+#include <QMutexLocker>
 #include <QSaveFile>
 #include <QJsonDocument>
 
@@ -226,16 +228,56 @@ void Bookmarks::init()
     m_model = new BookmarksModel(m_root, this, this);
 }
 
+Q_GLOBAL_STATIC(QMutex, s_preloadMutex)
+static QVariant s_preloadedBookmarks;
+static bool s_preloadedBookmarksOk = false;
+static bool s_hasPreloadedBookmarks = false;
+
+void Bookmarks::preloadBookmarks()
+{
+    bool ok;
+    const QVariant res = parseBookmarksFile(DataPaths::currentProfilePath() + QLatin1String("/bookmarks.json"), &ok);
+
+    QMutexLocker locker(s_preloadMutex());
+    s_preloadedBookmarks = res;
+    s_preloadedBookmarksOk = ok;
+    s_hasPreloadedBookmarks = true;
+}
+
+QVariant Bookmarks::parseBookmarksFile(const QString &fileName, bool* ok)
+{
+    QJsonParseError err;
+    const QJsonDocument json = QJsonDocument::fromJson(QzTools::readAllFileByteContents(fileName), &err);
+    const QVariant res = json.toVariant();
+
+    *ok = err.error == QJsonParseError::NoError && res.type() == QVariant::Map;
+    return res;
+}
+
 void Bookmarks::loadBookmarks()
 {
     const QString bookmarksFile = DataPaths::currentProfilePath() + QLatin1String("/bookmarks.json");
     const QString backupFile = bookmarksFile + QLatin1String(".old");
 
-    QJsonParseError err;
-    QJsonDocument json = QJsonDocument::fromJson(QzTools::readAllFileByteContents(bookmarksFile), &err);
-    const QVariant res = json.toVariant();
+    bool ok = false;
+    bool preloaded = false;
+    QVariant res;
+
+    QMutexLocker locker(s_preloadMutex());
+    if (s_hasPreloadedBookmarks) {
+        res = s_preloadedBookmarks;
+        ok = s_preloadedBookmarksOk;
+        preloaded = true;
+        s_preloadedBookmarks.clear();
+        s_hasPreloadedBookmarks = false;
+    }
+    locker.unlock();
+
+    if (!preloaded) {
+        res = parseBookmarksFile(bookmarksFile, &ok);
+    }
 
-    if (err.error != QJsonParseError::NoError || res.type() != QVariant::Map) {
+    if (!ok) {
         if (QFile(bookmarksFile).exists()) {
             qWarning() << "Bookmarks::init() Error parsing bookmarks! Using default bookmarks!";
             qWarning() << "Bookmarks::init() Your bookmarks have been backed up in" << backupFile;
@@ -246,11 +288,8 @@ void Bookmarks::loadBookmarks()
         }
 
         // Load default bookmarks
-        json = QJsonDocument::fromJson(QzTools::readAllFileByteContents(QSL(":data/bookmarks.json")), &err);
-        const QVariant data = json.toVariant();
-
-        Q_ASSERT(err.error == QJsonParseError::NoError);
-        Q_ASSERT(data.type() == QVariant::Map);
+        const QVariant data = parseBookmarksFile(QSL(":data/bookmarks.json"), &ok);
+        Q_ASSERT(ok);
 
         loadBookmarksFromMap(data.toMap().value("roots").toMap());
 
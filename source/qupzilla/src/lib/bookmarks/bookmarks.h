@@ -38,6 +38,9 @@ public:
 
     void loadSettings();
 
+    // Reads and parses bookmarks file ahead of time, can be called from any thread
+    static void preloadBookmarks();
+
     bool showOnlyIconsInToolbar() const;
     bool showOnlyTextInToolbar() const;
 
@@ -87,6 +90,8 @@ private:
     void loadBookmarks();
     void saveBookmarks();
 
+    static QVariant parseBookmarksFile(const QString &fileName, bool* ok);
+
     void loadBookmarksFromMap(const QVariantMap &map);
     void readBookmarks(const QVariantList &list, BookmarkItem* parent);
     QVariantList writeBookmarks(BookmarkItem* parent);
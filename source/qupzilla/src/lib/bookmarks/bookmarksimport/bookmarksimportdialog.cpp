@@ -28,6 +28,7 @@
 #include "mainapplication.h"
 
 #include <QMessageBox>
+#include <QtConcurrent/QtConcurrentRun>
 
 BookmarksImportDialog::BookmarksImportDialog(QWidget* parent)
     : QDialog(parent)
@@ -36,10 +37,14 @@ BookmarksImportDialog::BookmarksImportDialog(QWidget* parent)
     , m_importer(0)
     , m_importedFolder(0)
     , m_model(0)
+    , m_importWatcher(new QFutureWatcher<BookmarkItem*>(this))
 {
     setAttribute(Qt::WA_DeleteOnClose);
     ui->setupUi(this);
 
+    ui->progressBar->hide();
+    connect(m_importWatcher, &QFutureWatcher<BookmarkItem*>::finished, this, &BookmarksImportDialog::importFinished);
+
     ui->browserList->setCurrentRow(0);
     ui->treeView->setItemDelegate(new BookmarksItemDelegate(ui->treeView));
 
@@ -54,6 +59,12 @@ BookmarksImportDialog::BookmarksImportDialog(QWidget* parent)
 
 BookmarksImportDialog::~BookmarksImportDialog()
 {
+    // Importer is used by the worker thread
+    if (m_importWatcher->isRunning()) {
+        m_importWatcher->waitForFinished();
+        delete m_importWatcher->result();
+    }
+
     ui->treeView->setModel(0);
     delete m_model;
     delete m_importedFolder;
@@ -103,25 +114,12 @@ void BookmarksImportDialog::nextPage()
             return;
         }
 
-        if (m_importer->prepareImport()) {
-            m_importedFolder = m_importer->importBookmarks();
-        }
-
-        if (m_importer->error()) {
+        if (!m_importer->prepareImport()) {
             QMessageBox::critical(this, tr("Error!"), m_importer->errorString());
             return;
         }
 
-        if (!m_importedFolder || m_importedFolder->children().isEmpty()) {
-            QMessageBox::warning(this, tr("Error!"), tr("No bookmarks were found."));
-            return;
-        }
-
-        Q_ASSERT(m_importedFolder->isFolder());
-
-        ui->stackedWidget->setCurrentIndex(++m_currentPage);
-        ui->nextButton->setText(tr("Finish"));
-        showExportedBookmarks();
+        startImport();
         break;
 
     case 2:
@@ -134,6 +132,56 @@ void BookmarksImportDialog::nextPage()
     }
 }
 
+void BookmarksImportDialog::startImport()
+{
+    ui->nextButton->setEnabled(false);
+    ui->backButton->setEnabled(false);
+    ui->chooseFile->setEnabled(false);
+    ui->progressBar->setValue(0);
+    ui->progressBar->show();
+
+    connect(m_importer, &BookmarksImporter::progress, this, [this](int value, int maximum) {
+        ui->progressBar->setMaximum(maximum);
+        ui->progressBar->setValue(value);
+    });
+
+    BookmarksImporter* importer = m_importer;
+    m_importWatcher->setFuture(QtConcurrent::run([importer]() {
+        return importer->importBookmarks();
+    }));
+}
+
+void BookmarksImportDialog::importFinished()
+{
+    m_importedFolder = m_importWatcher->result();
+
+    disconnect(m_importer, &BookmarksImporter::progress, this, 0);
+    ui->progressBar->hide();
+    ui->nextButton->setEnabled(true);
+    ui->backButton->setEnabled(true);
+    ui->chooseFile->setEnabled(true);
+
+    if (m_importer->error()) {
+        QMessageBox::critical(this, tr("Error!"), m_importer->errorString());
+        delete m_importedFolder;
+        m_importedFolder = 0;
+        return;
+    }
+
+    if (!m_importedFolder || m_importedFolder->children().isEmpty()) {
+        QMessageBox::warning(this, tr("Error!"), tr("No bookmarks were found."));
+        delete m_importedFolder;
+        m_importedFolder = 0;
+        return;
+    }
+
+    Q_ASSERT(m_importedFolder->isFolder());
+
+    ui->stackedWidget->setCurrentIndex(++m_currentPage);
+    ui->nextButton->setText(tr("Finish"));
+    showExportedBookmarks();
+}
+
 void BookmarksImportDialog::previousPage()
 {
     switch (m_currentPage) {
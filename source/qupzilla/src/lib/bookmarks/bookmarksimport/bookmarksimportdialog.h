@@ -19,6 +19,7 @@
 #define BOOKMARKSIMPORTDIALOG_H
 
 #include <QDialog>
+#include <QFutureWatcher>
 
 #include "qzcommon.h"
 
@@ -53,6 +54,9 @@ private:
         Html = 4
     };
 
+    void startImport();
+    void importFinished();
+
     void showImporterPage();
     void showExportedBookmarks();
     void addExportedBookmarks();
@@ -63,6 +67,7 @@ private:
     BookmarksImporter* m_importer;
     BookmarkItem* m_importedFolder;
     BookmarksModel* m_model;
+    QFutureWatcher<BookmarkItem*>* m_importWatcher;
 };
 
 #endif // BOOKMARKSIMPORTDIALOG_H
@@ -47,8 +47,13 @@ public:
     virtual bool prepareImport() = 0;
 
     // Import bookmarks (it must return root folder)
+    // Called from worker thread, so it must not use widgets
     virtual BookmarkItem* importBookmarks() = 0;
 
+signals:
+    // May be emitted from worker thread while importing
+    void progress(int value, int maximum);
+
 protected:
     // Empty error = no error
     void setError(const QString &error);
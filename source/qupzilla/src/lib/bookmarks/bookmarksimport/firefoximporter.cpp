@@ -22,6 +22,7 @@
 #include <QVariant>
 #include <QSqlError>
 #include <QFileDialog>
+#include <QHash>
 #include <QSqlQuery>
 #include <QSqlDatabase>
 
@@ -32,11 +33,6 @@ FirefoxImporter::FirefoxImporter(QObject* parent)
 {
 }
 
-FirefoxImporter::~FirefoxImporter()
-{
-    QSqlDatabase::removeDatabase(CONNECTION);
-}
-
 QString FirefoxImporter::description() const
 {
     return BookmarksImporter::tr("Mozilla Firefox stores its bookmarks in <b>places.sqlite</b> SQLite "
@@ -55,82 +51,89 @@ QString FirefoxImporter::getPath(QWidget* parent)
     return m_path;
 }
 
-bool FirefoxImporter::prepareImport()
+void FirefoxImporter::setPath(const QString &path)
 {
-    // Make sure this connection is properly closed if already opened
-    QSqlDatabase::removeDatabase(CONNECTION);
-
-    // Create new connection
-    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", CONNECTION);
+    m_path = path;
+}
 
+bool FirefoxImporter::prepareImport()
+{
     if (!QFile::exists(m_path)) {
         setError(BookmarksImportDialog::tr("File does not exist."));
         return false;
     }
 
-    db.setDatabaseName(m_path);
-
-    if (!db.open()) {
-        setError(BookmarksImportDialog::tr("Unable to open database. Is Firefox running?"));
-        return false;
-    }
-
     return true;
 }
 
 BookmarkItem* FirefoxImporter::importBookmarks()
 {
-    QList<Item> items;
+    // Database connection can be used only in thread that created it
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", CONNECTION);
+        db.setDatabaseName(m_path);
+
+        if (!db.open()) {
+            setError(BookmarksImportDialog::tr("Unable to open database. Is Firefox running?"));
+        }
+    }
+
+    BookmarkItem* root = error() ? 0 : importFromDatabase(QSqlDatabase::database(CONNECTION, false));
 
+    QSqlDatabase::removeDatabase(CONNECTION);
+
+    return root;
+}
+
+BookmarkItem* FirefoxImporter::importFromDatabase(const QSqlDatabase &db)
+{
     BookmarkItem* root = new BookmarkItem(BookmarkItem::Folder);
     root->setTitle("Firefox Import");
 
-    QSqlQuery query(QSqlDatabase::database(CONNECTION));
-    query.prepare("SELECT id, parent, type, title, fk FROM moz_bookmarks WHERE fk NOT NULL OR type = 3");
-    query.exec();
+    QSqlQuery countQuery(db);
+    countQuery.exec("SELECT COUNT(*) FROM moz_bookmarks WHERE fk NOT NULL OR type = 3");
+    const int count = countQuery.next() ? countQuery.value(0).toInt() : 0;
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.exec("SELECT b.id, b.parent, b.type, b.title, p.url FROM moz_bookmarks b "
+               "LEFT JOIN moz_places p ON p.id = b.fk "
+               "WHERE b.fk NOT NULL OR b.type = 3");
+
+    QHash<int, BookmarkItem*> hash;
+    const int progressStep = qMax(1, count / 100);
+    int row = 0;
 
     while (query.next()) {
-        Item item;
-        item.id = query.value(0).toInt();
-        item.parent = query.value(1).toInt();
-        item.type = typeFromValue(query.value(2).toInt());
-        item.title = query.value(3).toString();
-        int fk = query.value(4).toInt();
-
-        if (item.type == BookmarkItem::Invalid) {
-            continue;
+        if (row++ % progressStep == 0) {
+            emit progress(row, count);
         }
 
-        QSqlQuery query(QSqlDatabase::database(CONNECTION));
-        query.prepare("SELECT url FROM moz_places WHERE id=?");
-        query.addBindValue(fk);
-        query.exec();
-
-        if (query.next()) {
-            item.url = query.value(0).toUrl();
+        const BookmarkItem::Type type = typeFromValue(query.value(2).toInt());
+        if (type == BookmarkItem::Invalid) {
+            continue;
         }
 
-        if (item.url.scheme() == QLatin1String("place")) {
+        const QUrl url = query.value(4).toUrl();
+        if (url.scheme() == QLatin1String("place")) {
             continue;
         }
 
-        items.append(item);
+        const QString title = query.value(3).toString();
+
+        BookmarkItem* parent = hash.value(query.value(1).toInt());
+        BookmarkItem* bookmark = new BookmarkItem(type, parent ? parent : root);
+        bookmark->setTitle(title.isEmpty() ? url.toString() : title);
+        bookmark->setUrl(url);
+
+        hash.insert(query.value(0).toInt(), bookmark);
     }
 
     if (query.lastError().isValid()) {
         setError(query.lastError().text());
     }
 
-    QHash<int, BookmarkItem*> hash;
-
-    foreach (const Item &item, items) {
-        BookmarkItem* parent = hash.value(item.parent);
-        BookmarkItem* bookmark = new BookmarkItem(item.type, parent ? parent : root);
-        bookmark->setTitle(item.title.isEmpty() ? item.url.toString() : item.title);
-        bookmark->setUrl(item.url);
-
-        hash.insert(item.id, bookmark);
-    }
+    emit progress(count, count);
 
     return root;
 }
@@ -23,16 +23,18 @@
 #include "bookmarksimporter.h"
 #include "bookmarkitem.h"
 
+class QSqlDatabase;
+
 class QUPZILLA_EXPORT FirefoxImporter : public BookmarksImporter
 {
 public:
     explicit FirefoxImporter(QObject* parent = 0);
-    ~FirefoxImporter();
 
     QString description() const;
     QString standardPath() const;
 
     QString getPath(QWidget* parent);
+    void setPath(const QString &path);
     bool prepareImport();
 
     BookmarkItem* importBookmarks();
@@ -45,14 +47,7 @@ private:
         Invalid
     };
 
-    struct Item {
-        int id;
-        int parent;
-        BookmarkItem::Type type;
-        QString title;
-        QUrl url;
-    };
-
+    BookmarkItem* importFromDatabase(const QSqlDatabase &db);
     BookmarkItem::Type typeFromValue(int value);
 
     QString m_path;
@@ -17,7 +17,6 @@
 * ============================================================ */
 #include "htmlimporter.h"
 #include "bookmarkitem.h"
-#include "qzregexp.h"
 
 #include <QUrl>
 #include <QFileDialog>
@@ -45,6 +44,11 @@ QString HtmlImporter::getPath(QWidget* parent)
     return m_path;
 }
 
+void HtmlImporter::setPath(const QString &path)
+{
+    m_path = path;
+}
+
 bool HtmlImporter::prepareImport()
 {
     m_file.setFileName(m_path);
@@ -57,109 +61,149 @@ bool HtmlImporter::prepareImport()
     return true;
 }
 
-static int qzMin(int a, int b)
+// Decodes entities escaped by browsers when exporting bookmarks
+static QString decodeEntities(const QString &text)
 {
-    if (a > -1 && b > -1) {
-        return qMin(a, b);
+    if (!text.contains(QL1C('&'))) {
+        return text;
     }
 
-    if (a > -1) {
-        return a;
-    }
-    else {
-        return b;
-    }
+    QString out = text;
+    out.replace(QL1S("&lt;"), QL1S("<"));
+    out.replace(QL1S("&gt;"), QL1S(">"));
+    out.replace(QL1S("&quot;"), QL1S("\""));
+    out.replace(QL1S("&#39;"), QL1S("'"));
+    out.replace(QL1S("&amp;"), QL1S("&"));
+    return out;
 }
 
-BookmarkItem* HtmlImporter::importBookmarks()
+// Returns value of attribute in tag (text between '<' and '>')
+static QString attributeValue(const QStringRef &tag, const QString &name)
 {
-    QString bookmarks = QString::fromUtf8(m_file.readAll());
-    m_file.close();
+    int pos = 0;
+    while ((pos = tag.indexOf(name, pos, Qt::CaseInsensitive)) != -1) {
+        // Must be whole attribute name followed by '='
+        const bool nameStart = pos > 0 && tag.at(pos - 1).isSpace();
+        pos += name.size();
+        if (!nameStart || pos >= tag.size() || tag.at(pos) != QL1C('=')) {
+            continue;
+        }
+
+        ++pos;
+        if (pos < tag.size() && (tag.at(pos) == QL1C('"') || tag.at(pos) == QL1C('\''))) {
+            const QChar quote = tag.at(pos);
+            int end = tag.indexOf(quote, pos + 1);
+            if (end == -1) {
+                end = tag.size();
+            }
+            return tag.mid(pos + 1, end - pos - 1).toString();
+        }
 
-    // Converting tags to lower case -,-
-    // For some reason Qt::CaseInsensitive is not everytime insensitive :-D
+        int end = pos;
+        while (end < tag.size() && !tag.at(end).isSpace()) {
+            ++end;
+        }
+        return tag.mid(pos, end - pos).toString();
+    }
 
-    bookmarks.replace(QLatin1String("<DL"), QLatin1String("<dl"));
-    bookmarks.replace(QLatin1String("</DL"), QLatin1String("</dl"));
-    bookmarks.replace(QLatin1String("<DT"), QLatin1String("<dt"));
-    bookmarks.replace(QLatin1String("</DT"), QLatin1String("</dt"));
-    bookmarks.replace(QLatin1String("<P"), QLatin1String("<p"));
-    bookmarks.replace(QLatin1String("</P"), QLatin1String("</p"));
-    bookmarks.replace(QLatin1String("<A"), QLatin1String("<a"));
-    bookmarks.replace(QLatin1String("</A"), QLatin1String("</a"));
-    bookmarks.replace(QLatin1String("HREF="), QLatin1String("href="));
-    bookmarks.replace(QLatin1String("<H3"), QLatin1String("<h3"));
-    bookmarks.replace(QLatin1String("</H3"), QLatin1String("</h3"));
+    return QString();
+}
 
-    bookmarks = bookmarks.left(bookmarks.lastIndexOf(QLatin1String("</dl><p>")));
-    int start = bookmarks.indexOf(QLatin1String("<dl><p>"));
+BookmarkItem* HtmlImporter::importBookmarks()
+{
+    const QString bookmarks = QString::fromUtf8(m_file.readAll());
+    m_file.close();
 
     BookmarkItem* root = new BookmarkItem(BookmarkItem::Folder);
     root->setTitle("HTML Import");
 
+    // Netscape bookmark format:
+    // <DT><H3>Folder</H3>
+    // <DL><p>
+    //     <DT><A HREF="url">Title</A>
+    // </DL><p>
     QList<BookmarkItem*> folders;
-    folders.append(root);
+    BookmarkItem* pendingFolder = 0;
 
-    while (start > 0) {
-        QString string = bookmarks.mid(start);
+    const int length = bookmarks.size();
+    const int progressStep = qMax(1, length / 100);
+    int nextProgress = 0;
+    int pos = bookmarks.indexOf(QL1C('<'));
 
-        int posOfFolder = string.indexOf(QLatin1String("<dt><h3"));
-        int posOfEndFolder = string.indexOf(QLatin1String("</dl><p>"));
-        int posOfLink = string.indexOf(QLatin1String("<dt><a"));
+    while (pos != -1 && pos < length) {
+        if (pos >= nextProgress) {
+            emit progress(pos, length);
+            nextProgress = pos + progressStep;
+        }
 
-        int nearest = qzMin(posOfLink, qzMin(posOfFolder, posOfEndFolder));
-        if (nearest == -1) {
-            break;
+        // Comments and doctype
+        if (bookmarks.midRef(pos, 4) == QL1S("<!--")) {
+            const int end = bookmarks.indexOf(QL1S("-->"), pos + 4);
+            pos = end == -1 ? -1 : bookmarks.indexOf(QL1C('<'), end + 3);
+            continue;
         }
 
-        if (nearest == posOfFolder) {
-            // Next is folder
-            QzRegExp rx("<dt><h3(.*)>(.*)</h3>");
-            rx.setMinimal(true);
-            rx.indexIn(string);
+        const int tagEnd = bookmarks.indexOf(QL1C('>'), pos);
+        if (tagEnd == -1) {
+            break;
+        }
 
-//            QString arguments = rx.cap(1);
-            QString folderName = rx.cap(2).trimmed();
+        const QStringRef tag = bookmarks.midRef(pos + 1, tagEnd - pos - 1);
+        int nameEnd = 0;
+        while (nameEnd < tag.size() && !tag.at(nameEnd).isSpace()) {
+            ++nameEnd;
+        }
+        const QStringRef name = tag.left(nameEnd);
 
-            BookmarkItem* folder = new BookmarkItem(BookmarkItem::Folder, folders.isEmpty() ? root : folders.last());
-            folder->setTitle(folderName);
-            folders.append(folder);
+        int next = tagEnd + 1;
 
-            start += posOfFolder + rx.cap(0).size();
+        if (name.compare(QL1S("dl"), Qt::CaseInsensitive) == 0) {
+            if (pendingFolder) {
+                folders.append(pendingFolder);
+                pendingFolder = 0;
+            }
+            else {
+                folders.append(folders.isEmpty() ? root : folders.last());
+            }
         }
-        else if (nearest == posOfEndFolder) {
-            // Next is end of folder
+        else if (name.compare(QL1S("/dl"), Qt::CaseInsensitive) == 0) {
             if (!folders.isEmpty()) {
                 folders.removeLast();
             }
-
-            start += posOfEndFolder + 8;
         }
-        else {
-            // Next is link
-            QzRegExp rx("<dt><a(.*)>(.*)</a>");
-            rx.setMinimal(true);
-            rx.indexIn(string);
-
-            QString arguments = rx.cap(1);
-            QString linkName = rx.cap(2).trimmed();
-
-            QzRegExp rx2("href=\"(.*)\"");
-            rx2.setMinimal(true);
-            rx2.indexIn(arguments);
-
-            QUrl url = QUrl::fromEncoded(rx2.cap(1).trimmed().toUtf8());
-
-            start += posOfLink + rx.cap(0).size();
+        else if (name.compare(QL1S("h3"), Qt::CaseInsensitive) == 0 || name.compare(QL1S("a"), Qt::CaseInsensitive) == 0) {
+            const bool isFolder = name.size() == 2;
+            int end = bookmarks.indexOf(isFolder ? QL1S("</h3") : QL1S("</a"), next, Qt::CaseInsensitive);
+            if (end == -1) {
+                end = length;
+            }
+            const QString title = decodeEntities(bookmarks.mid(next, end - next).trimmed());
+            next = end;
 
-            if (url.isEmpty() || url.scheme() == QL1S("place") || url.scheme() == QL1S("about"))
-                continue;
+            BookmarkItem* parent = folders.isEmpty() ? root : folders.last();
 
-            BookmarkItem* b = new BookmarkItem(BookmarkItem::Url, folders.isEmpty() ? root : folders.last());
-            b->setTitle(linkName.isEmpty() ? url.toString() : linkName);
-            b->setUrl(url);
+            if (isFolder) {
+                pendingFolder = new BookmarkItem(BookmarkItem::Folder, parent);
+                pendingFolder->setTitle(title);
+            }
+            else {
+                const QUrl url = QUrl::fromEncoded(decodeEntities(attributeValue(tag, QSL("href"))).trimmed().toUtf8());
+
+                if (!url.isEmpty() && url.scheme() != QL1S("place") && url.scheme() != QL1S("about")) {
+                    BookmarkItem* b = new BookmarkItem(BookmarkItem::Url, parent);
+                    b->setTitle(title.isEmpty() ? url.toString() : title);
+                    b->setUrl(url);
+                }
+            }
+        }
+        else if (name.compare(QL1S("hr"), Qt::CaseInsensitive) == 0 && !folders.isEmpty()) {
+            new BookmarkItem(BookmarkItem::Separator, folders.last());
         }
+
+        pos = bookmarks.indexOf(QL1C('<'), next);
     }
 
+    emit progress(length, length);
+
     return root;
 }
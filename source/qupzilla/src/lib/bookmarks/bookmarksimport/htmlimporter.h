@@ -31,6 +31,7 @@ public:
     QString standardPath() const;
 
     QString getPath(QWidget* parent);
+    void setPath(const QString &path);
     bool prepareImport();
 
     BookmarkItem* importBookmarks();
@@ -0,0 +1,48 @@
+// Helper functions available to proxy auto-config scripts
+// See https://developer.mozilla.org/en-US/docs/Web/HTTP/Proxy_servers_and_tunneling/Proxy_Auto-Configuration_(PAC)_file
+
+function isPlainHostName(host) {
+    return host.indexOf('.') < 0;
+}
+
+function dnsDomainIs(host, domain) {
+    return host.length >= domain.length && host.substring(host.length - domain.length) == domain;
+}
+
+function localHostOrDomainIs(host, hostdom) {
+    return host == hostdom || hostdom.lastIndexOf(host + '.', 0) == 0;
+}
+
+function dnsDomainLevels(host) {
+    return host.split('.').length - 1;
+}
+
+function shExpMatch(str, shexp) {
+    var re = shexp.replace(/[.+^${}()|[\]\\]/g, '\\$&').replace(/\*/g, '.*').replace(/\?/g, '.');
+    return new RegExp('^' + re + '$').test(str);
+}
+
+function dnsResolve(host) {
+    var ip = _qz_pac.dnsResolve(host);
+    return ip ? ip : null;
+}
+
+function isResolvable(host) {
+    return dnsResolve(host) !== null;
+}
+
+function myIpAddress() {
+    return _qz_pac.myIpAddress();
+}
+
+function _qz_convertAddr(ip) {
+    var b = ip.split('.');
+    return ((b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3]) >>> 0;
+}
+
+function isInNet(host, pattern, mask) {
+    var ip = /^\d+\.\d+\.\d+\.\d+$/.test(host) ? host : dnsResolve(host);
+    if (!ip)
+        return false;
+    return (_qz_convertAddr(ip) & _qz_convertAddr(mask)) == (_qz_convertAddr(pattern) & _qz_convertAddr(mask));
+}
@@ -16,137 +16,119 @@
 * along with this program.  If not, see <http://www.gnu.org/licenses/>.
 * ============================================================ */
 #include "downloaditem.h"
-#include "ui_downloaditem.h"
-#include "mainapplication.h"
-#include "browserwindow.h"
-#include "tabwidget.h"
-#include "webpage.h"
-#include "downloadmanager.h"
-#include "networkmanager.h"
 #include "qztools.h"
-#include "datapaths.h"
 
-#include <QMenu>
-#include <QClipboard>
-#include <QListWidgetItem>
-#include <QMouseEvent>
-#include <QTimer>
+#include <QDateTime>
 #include <QFileInfo>
-#include <QMessageBox>
-#include <QFileIconProvider>
 #include <QDesktopServices>
 #include <QWebEngineDownloadItem>
 
-#ifdef Q_OS_WIN
-#include "Shlwapi.h"
-#endif
-
 //#define DOWNMANAGER_DEBUG
 
-DownloadItem::DownloadItem(QListWidgetItem *item, QWebEngineDownloadItem* downloadItem, const QString &path, const QString &fileName, bool openFile, DownloadManager* manager)
-    : QWidget()
-    , ui(new Ui::DownloadItem)
-    , m_item(item)
+DownloadItem::DownloadItem(QWebEngineDownloadItem* downloadItem, const QString &path, const QString &fileName, bool openFile, QObject* parent)
+    : QObject(parent)
     , m_download(downloadItem)
     , m_path(path)
     , m_fileName(fileName)
     , m_downUrl(downloadItem->url())
     , m_openFile(openFile)
-    , m_downloading(false)
-    , m_downloadStopped(false)
+    , m_state(Downloading)
     , m_currSpeed(0)
     , m_received(downloadItem->receivedBytes())
     , m_total(downloadItem->totalBytes())
 {
 #ifdef DOWNMANAGER_DEBUG
-    qDebug() << __FUNCTION__ << item << reply << path << fileName;
+    qDebug() << __FUNCTION__ << downloadItem << path << fileName;
 #endif
 
-    ui->setupUi(this);
-    setMaximumWidth(525);
-
-    ui->button->setPixmap(QIcon::fromTheme(QSL("process-stop")).pixmap(20, 20));
-    ui->fileName->setText(m_fileName);
-    ui->downloadInfo->setText(tr("Remaining time unavailable"));
+    connect(m_download, &QWebEngineDownloadItem::finished, this, &DownloadItem::finished);
+    connect(m_download, &QWebEngineDownloadItem::downloadProgress, this, &DownloadItem::downloadProgress);
 
-    setContextMenuPolicy(Qt::CustomContextMenu);
-    connect(this, SIGNAL(customContextMenuRequested(QPoint)), this, SLOT(customContextMenuRequested(QPoint)));
-    connect(ui->button, SIGNAL(clicked(QPoint)), this, SLOT(stop()));
-    connect(manager, SIGNAL(resized(QSize)), this, SLOT(parentResized(QSize)));
+    m_downTimer.start();
+}
 
-    startDownloading();
+QString DownloadItem::path() const
+{
+    return m_path;
 }
 
-void DownloadItem::startDownloading()
+QString DownloadItem::fileName() const
 {
-    connect(m_download, &QWebEngineDownloadItem::finished, this, &DownloadItem::finished);
-    connect(m_download, &QWebEngineDownloadItem::downloadProgress, this, &DownloadItem::downloadProgress);
+    return m_fileName;
+}
 
-    m_downloading = true;
-    m_downTimer.start();
+QUrl DownloadItem::url() const
+{
+    return m_downUrl;
+}
 
-    updateDownloadInfo(0, m_download->receivedBytes(), m_download->totalBytes());
+DownloadItem::State DownloadItem::state() const
+{
+    return m_state;
+}
 
-#ifdef Q_OS_LINUX
-    // QFileIconProvider uses only suffix on Linux
-    QFileIconProvider iconProvider;
-    QIcon fileIcon = iconProvider.icon(QFileInfo(m_fileName));
-    if (!fileIcon.isNull()) {
-        ui->fileIcon->setPixmap(fileIcon.pixmap(30));
-    } else {
-        ui->fileIcon->setPixmap(style()->standardIcon(QStyle::SP_FileIcon).pixmap(30));
+QTime DownloadItem::remainingTime() const
+{
+    if (m_currSpeed <= 0 || m_total <= 0) {
+        return QTime(0, 0, 0);
     }
-#else
-    ui->fileIcon->hide();
-#endif
+    return QTime(0, 0, 0).addSecs((m_total - m_received) / m_currSpeed);
 }
 
-void DownloadItem::parentResized(const QSize &size)
+int DownloadItem::progress() const
 {
-    if (size.width() < 200) {
+    return m_total > 0 ? m_received * 100 / m_total : 0;
+}
+
+void DownloadItem::cancel()
+{
+#ifdef DOWNMANAGER_DEBUG
+    qDebug() << __FUNCTION__;
+#endif
+    if (m_state != Downloading) {
         return;
     }
-    setMaximumWidth(size.width());
+
+    m_state = Cancelled;
+    m_download->cancel();
+
+    emit downloadFinished(false);
 }
 
 void DownloadItem::finished()
 {
 #ifdef DOWNMANAGER_DEBUG
-    qDebug() << __FUNCTION__ << m_reply;
+    qDebug() << __FUNCTION__ << m_download;
 #endif
 
+    // Already handled in cancel()
+    if (m_state == Cancelled) {
+        return;
+    }
+
     bool success = false;
-    QString host = m_download->url().host();
 
     switch (m_download->state()) {
     case QWebEngineDownloadItem::DownloadCompleted:
         success = true;
-        ui->downloadInfo->setText(tr("Done - %1 (%2)").arg(host, QDateTime::currentDateTime().toString(Qt::DefaultLocaleShortDate)));
-        break;
-
-    case QWebEngineDownloadItem::DownloadInterrupted:
-        ui->downloadInfo->setText(tr("Error - %1").arg(host));
+        m_state = Completed;
+        m_received = m_total = m_download->receivedBytes();
         break;
 
     case QWebEngineDownloadItem::DownloadCancelled:
-        ui->downloadInfo->setText(tr("Cancelled - %1").arg(host));
+        m_state = Cancelled;
         break;
 
     default:
+        m_state = Error;
         break;
     }
 
-    ui->progressBar->hide();
-    ui->button->hide();
-    ui->frame->hide();
-
-    m_item->setSizeHint(sizeHint());
-    m_downloading = false;
-
-    if (success && m_openFile)
-        openFile();
+    if (success && m_openFile) {
+        QDesktopServices::openUrl(QUrl::fromLocalFile(QFileInfo(m_path, m_fileName).absoluteFilePath()));
+    }
 
-    emit downloadFinished(true);
+    emit downloadFinished(success);
 }
 
 void DownloadItem::downloadProgress(qint64 received, qint64 total)
@@ -154,29 +136,12 @@ void DownloadItem::downloadProgress(qint64 received, qint64 total)
 #ifdef DOWNMANAGER_DEBUG
     qDebug() << __FUNCTION__ << received << total;
 #endif
-    qint64 currentValue = 0;
-    qint64 totalValue = 0;
-    if (total > 0) {
-        currentValue = received * 100 / total;
-        totalValue = 100;
-    }
-    ui->progressBar->setValue(currentValue);
-    ui->progressBar->setMaximum(totalValue);
-    m_currSpeed = received * 1000.0 / m_downTimer.elapsed();
+    const int elapsed = m_downTimer.elapsed();
+    m_currSpeed = elapsed > 0 ? received * 1000.0 / elapsed : 0;
     m_received = received;
     m_total = total;
 
-    updateDownloadInfo(m_currSpeed, m_received, m_total);
-}
-
-int DownloadItem::progress()
-{
-    return ui->progressBar->value();
-}
-
-bool DownloadItem::isCancelled()
-{
-    return ui->downloadInfo->text().startsWith(tr("Cancelled"));
+    emit progressChanged();
 }
 
 QString DownloadItem::remaingTimeToString(QTime time)
@@ -215,121 +180,41 @@ QString DownloadItem::currentSpeedToString(double speed)
     return QString::number(speed, 'f', 2) + QLatin1String(" ") + tr("GB/s");
 }
 
-void DownloadItem::updateDownloadInfo(double currSpeed, qint64 received, qint64 total)
+QString DownloadItem::downloadInfoText(State state, const QUrl &url, const QDateTime &date, qint64 received, qint64 total, double speed)
 {
-#ifdef DOWNMANAGER_DEBUG
-    qDebug() << __FUNCTION__ << currSpeed << received << total;
-#endif
     //            QString          QString       QString     QString
     //          | m_remTime |   |m_currSize|  |m_fileSize|  |m_speed|
     // Remaining 26 minutes -     339MB of      693 MB        (350kB/s)
 
-    int estimatedTime = ((total - received) / 1024) / (currSpeed / 1024);
-    QString speed = currentSpeedToString(currSpeed);
-    // We have QString speed now
+    switch (state) {
+    case Completed:
+        return tr("Done - %1 (%2)").arg(url.host(), date.toString(Qt::DefaultLocaleShortDate));
 
-    QTime time(0, 0, 0);
-    time = time.addSecs(estimatedTime);
-    QString remTime = remaingTimeToString(time);
-    m_remTime = time;
+    case Cancelled:
+        return tr("Cancelled - %1").arg(url.host());
 
-    QString currSize = QzTools::fileSizeToString(received);
-    QString fileSize = QzTools::fileSizeToString(total);
+    case Error:
+        return tr("Error - %1").arg(url.host());
 
-    if (fileSize == tr("Unknown size")) {
-        ui->downloadInfo->setText(tr("%2 - unknown size (%3)").arg(currSize, speed));
-    }
-    else {
-        ui->downloadInfo->setText(tr("Remaining %1 - %2 of %3 (%4)").arg(remTime, currSize, fileSize, speed));
-    }
-}
-
-void DownloadItem::stop()
-{
-#ifdef DOWNMANAGER_DEBUG
-    qDebug() << __FUNCTION__;
-#endif
-    if (m_downloadStopped) {
-        return;
+    default:
+        break;
     }
-    m_downloadStopped = true;
-    ui->progressBar->hide();
-    ui->button->hide();
-    m_item->setSizeHint(sizeHint());
-    ui->downloadInfo->setText(tr("Cancelled - %1").arg(m_download->url().host()));
-    m_download->cancel();
-    m_downloading = false;
-
-    emit downloadFinished(false);
-}
-
-void DownloadItem::mouseDoubleClickEvent(QMouseEvent* e)
-{
-    openFile();
-    e->accept();
-}
 
-void DownloadItem::customContextMenuRequested(const QPoint &pos)
-{
-    QMenu menu;
-    menu.addAction(QIcon::fromTheme("document-open"), tr("Open File"), this, SLOT(openFile()));
-
-    menu.addAction(tr("Open Folder"), this, SLOT(openFolder()));
-    menu.addSeparator();
-    menu.addAction(QIcon::fromTheme("edit-copy"), tr("Copy Download Link"), this, SLOT(copyDownloadLink()));
-    menu.addSeparator();
-    menu.addAction(QIcon::fromTheme("process-stop"), tr("Cancel downloading"), this, SLOT(stop()))->setEnabled(m_downloading);
-    menu.addAction(QIcon::fromTheme("list-remove"), tr("Remove From List"), this, SLOT(clear()))->setEnabled(!m_downloading);
-
-    if (m_downloading || ui->downloadInfo->text().startsWith(tr("Cancelled")) || ui->downloadInfo->text().startsWith(tr("Error"))) {
-        menu.actions().at(0)->setEnabled(false);
+    if (received == 0 && speed <= 0) {
+        return tr("Remaining time unavailable");
     }
-    menu.exec(mapToGlobal(pos));
-}
-
-void DownloadItem::copyDownloadLink()
-{
-    QApplication::clipboard()->setText(m_downUrl.toString());
-}
 
-void DownloadItem::clear()
-{
-    emit deleteItem(this);
-}
-
-void DownloadItem::openFile()
-{
-    if (m_downloading) {
-        return;
-    }
-    QFileInfo info(m_path, m_fileName);
-    if (info.exists()) {
-        QDesktopServices::openUrl(QUrl::fromLocalFile(info.absoluteFilePath()));
-    }
-    else {
-        QMessageBox::warning(m_item->listWidget()->parentWidget(), tr("Not found"), tr("Sorry, the file \n %1 \n was not found!").arg(info.absoluteFilePath()));
+    QTime time(0, 0, 0);
+    if (speed > 0 && total > 0) {
+        time = time.addSecs((total - received) / speed);
     }
-}
 
-void DownloadItem::openFolder()
-{
-#ifdef Q_OS_WIN
-    QString winFileName = QSL("%1/%2").arg(m_path, m_fileName);
+    const QString currSize = QzTools::fileSizeToString(received);
+    const QString fileSize = QzTools::fileSizeToString(total);
 
-    if (m_downloading) {
-        winFileName.append(QSL(".download"));
+    if (total <= 0) {
+        return tr("%2 - unknown size (%3)").arg(currSize, currentSpeedToString(speed));
     }
 
-    winFileName.replace(QLatin1Char('/'), "\\");
-    QString shExArg = "/e,/select,\"" + winFileName + "\"";
-    ShellExecute(NULL, NULL, TEXT("explorer.exe"), shExArg.toStdWString().c_str(), NULL, SW_SHOW);
-#else
-    QDesktopServices::openUrl(QUrl::fromLocalFile(m_path));
-#endif
-}
-
-DownloadItem::~DownloadItem()
-{
-    delete ui;
-    delete m_item;
+    return tr("Remaining %1 - %2 of %3 (%4)").arg(remaingTimeToString(time), currSize, fileSize, currentSpeedToString(speed));
 }
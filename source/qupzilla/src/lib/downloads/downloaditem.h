@@ -18,77 +18,68 @@
 #ifndef DOWNLOADITEM_H
 #define DOWNLOADITEM_H
 
-#include <QWidget>
-#include <QFile>
-#include <QBasicTimer>
-#include <QUrl>
-#include <QNetworkReply>
+#include <QObject>
 #include <QTime>
+#include <QUrl>
 
 #include "qzcommon.h"
 
-namespace Ui
-{
-class DownloadItem;
-}
-
-class QListWidgetItem;
 class QWebEngineDownloadItem;
 
-class DownloadManager;
-
-class QUPZILLA_EXPORT DownloadItem : public QWidget
+// Tracks progress of one active download, finished downloads
+// are only kept as rows in DownloadsModel
+class QUPZILLA_EXPORT DownloadItem : public QObject
 {
     Q_OBJECT
 
 public:
-    explicit DownloadItem(QListWidgetItem* item, QWebEngineDownloadItem* downloadItem, const QString &path, const QString &fileName, bool openFile, DownloadManager* manager);
-    bool isDownloading() { return m_downloading; }
-    bool isCancelled();
-    QTime remainingTime() { return m_remTime; }
-    double currentSpeed() { return m_currSpeed; }
-    int progress();
-    ~DownloadItem();
+    enum State {
+        Downloading = 0,
+        Completed = 1,
+        Cancelled = 2,
+        Error = 3
+    };
+
+    explicit DownloadItem(QWebEngineDownloadItem* downloadItem, const QString &path, const QString &fileName, bool openFile, QObject* parent = nullptr);
+
+    QString path() const;
+    QString fileName() const;
+    QUrl url() const;
+    State state() const;
+
+    bool isDownloading() const { return m_state == Downloading; }
+    bool isCancelled() const { return m_state == Cancelled; }
+    bool openFileOnFinish() const { return m_openFile; }
+
+    qint64 receivedBytes() const { return m_received; }
+    qint64 totalBytes() const { return m_total; }
+    double currentSpeed() const { return m_currSpeed; }
+    QTime remainingTime() const;
+    int progress() const;
+
+    void cancel();
 
     static QString remaingTimeToString(QTime time);
     static QString currentSpeedToString(double speed);
+    static QString downloadInfoText(State state, const QUrl &url, const QDateTime &date, qint64 received, qint64 total, double speed);
 
 signals:
-    void deleteItem(DownloadItem*);
+    void progressChanged();
     void downloadFinished(bool success);
 
 private slots:
-    void parentResized(const QSize &size);
     void finished();
     void downloadProgress(qint64 received, qint64 total);
-    void stop();
-    void openFile();
-    void openFolder();
-    void customContextMenuRequested(const QPoint &pos);
-    void clear();
-
-    void copyDownloadLink();
 
 private:
-    void startDownloading();
-
-    void updateDownloadInfo(double currSpeed, qint64 received, qint64 total);
-    void mouseDoubleClickEvent(QMouseEvent* e);
-
-    Ui::DownloadItem* ui;
-
-    QListWidgetItem* m_item;
     QWebEngineDownloadItem* m_download;
     QString m_path;
     QString m_fileName;
-    QTime m_downTimer;
-    QTime m_remTime;
-    QBasicTimer m_timer;
     QUrl m_downUrl;
+    QTime m_downTimer;
     bool m_openFile;
 
-    bool m_downloading;
-    bool m_downloadStopped;
+    State m_state;
     double m_currSpeed;
     qint64 m_received;
     qint64 m_total;
@@ -0,0 +1,110 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "downloaditemdelegate.h"
+#include "downloadsmodel.h"
+
+#include <QApplication>
+#include <QFileInfo>
+#include <QPainter>
+#include <QStyle>
+
+DownloadItemDelegate::DownloadItemDelegate(QObject* parent)
+    : QStyledItemDelegate(parent)
+    , m_padding(4)
+    , m_iconSize(30)
+{
+}
+
+void DownloadItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    QStyleOptionViewItem opt = option;
+    initStyleOption(&opt, index);
+
+    const QWidget* w = opt.widget;
+    const QStyle* style = w ? w->style() : QApplication::style();
+
+    // Draw background
+    opt.text.clear();
+    opt.icon = QIcon();
+    style->drawControl(QStyle::CE_ItemViewItem, &opt, painter, w);
+
+    const QPalette::ColorRole colorRole = opt.state & QStyle::State_Selected ? QPalette::HighlightedText : QPalette::Text;
+    const QRect rect = opt.rect.adjusted(m_padding, m_padding, -m_padding, -m_padding);
+
+    // Draw icon
+    const QString fileName = index.data(DownloadsModel::FileNameRole).toString();
+    const QRect iconRect(rect.x(), rect.y() + (rect.height() - m_iconSize) / 2, m_iconSize, m_iconSize);
+    fileIcon(fileName).paint(painter, iconRect);
+
+    const int textLeft = iconRect.right() + m_padding * 2;
+    const int textWidth = rect.right() - textLeft;
+    const int lineHeight = opt.fontMetrics.height();
+
+    // Draw file name
+    QFont boldFont = opt.font;
+    boldFont.setBold(true);
+    painter->setFont(boldFont);
+    const QRect nameRect(textLeft, rect.y(), textWidth, lineHeight);
+    const QString elidedName = QFontMetrics(boldFont).elidedText(fileName, Qt::ElideMiddle, textWidth);
+    style->drawItemText(painter, nameRect, Qt::AlignLeft | Qt::AlignVCenter, opt.palette, true, elidedName, colorRole);
+    painter->setFont(opt.font);
+
+    // Draw progress bar for active downloads
+    int infoTop = nameRect.bottom() + m_padding;
+    if (index.data(DownloadsModel::StateRole).toInt() == DownloadItem::Downloading) {
+        QStyleOptionProgressBar bar;
+        bar.rect = QRect(textLeft, infoTop, textWidth, lineHeight);
+        bar.minimum = 0;
+        bar.maximum = index.data(DownloadsModel::TotalBytesRole).toLongLong() > 0 ? 100 : 0;
+        bar.progress = index.data(DownloadsModel::ProgressRole).toInt();
+        bar.state = QStyle::State_Enabled | QStyle::State_Horizontal;
+        bar.palette = opt.palette;
+        style->drawControl(QStyle::CE_ProgressBar, &bar, painter, w);
+        infoTop = bar.rect.bottom() + m_padding;
+    }
+
+    // Draw download info
+    const QRect infoRect(textLeft, infoTop, textWidth, lineHeight);
+    const QString info = opt.fontMetrics.elidedText(index.data(DownloadsModel::InfoTextRole).toString(), Qt::ElideRight, textWidth);
+    style->drawItemText(painter, infoRect, Qt::AlignLeft | Qt::AlignVCenter, opt.palette, true, info, colorRole);
+}
+
+QSize DownloadItemDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    Q_UNUSED(index)
+
+    // All rows have the same height, so the view can lay out rows without asking for each one
+    const int lineHeight = option.fontMetrics.height();
+    return QSize(200, qMax(m_iconSize, lineHeight * 3 + m_padding * 2) + m_padding * 2);
+}
+
+QIcon DownloadItemDelegate::fileIcon(const QString &fileName) const
+{
+    const QString suffix = QFileInfo(fileName).suffix();
+
+    if (!m_iconCache.contains(suffix)) {
+        // QFileIconProvider uses only suffix on Linux
+        QIcon icon = m_iconProvider.icon(QFileInfo(fileName));
+        if (icon.isNull()) {
+            icon = QApplication::style()->standardIcon(QStyle::SP_FileIcon);
+        }
+        m_iconCache.insert(suffix, icon);
+    }
+
+    return m_iconCache.value(suffix);
+}
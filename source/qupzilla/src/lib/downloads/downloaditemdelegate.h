@@ -0,0 +1,48 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef DOWNLOADITEMDELEGATE_H
+#define DOWNLOADITEMDELEGATE_H
+
+#include <QStyledItemDelegate>
+#include <QFileIconProvider>
+#include <QHash>
+
+#include "qzcommon.h"
+
+class QUPZILLA_EXPORT DownloadItemDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    explicit DownloadItemDelegate(QObject* parent = nullptr);
+
+    void paint(QPainter* painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    QIcon fileIcon(const QString &fileName) const;
+
+    int m_padding;
+    int m_iconSize;
+
+    // Icons are cached by file suffix
+    mutable QFileIconProvider m_iconProvider;
+    mutable QHash<QString, QIcon> m_iconCache;
+};
+
+#endif // DOWNLOADITEMDELEGATE_H
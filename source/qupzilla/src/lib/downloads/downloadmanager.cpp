@@ -21,6 +21,8 @@
 #include "mainapplication.h"
 #include "downloadoptionsdialog.h"
 #include "downloaditem.h"
+#include "downloadsmodel.h"
+#include "downloaditemdelegate.h"
 #include "networkmanager.h"
 #include "desktopnotificationsfactory.h"
 #include "qztools.h"
@@ -35,7 +37,10 @@
 
 #include <QMessageBox>
 #include <QCloseEvent>
+#include <QClipboard>
+#include <QDesktopServices>
 #include <QDir>
+#include <QMenu>
 #include <QShortcut>
 #include <QStandardPaths>
 #include <QWebEngineHistory>
@@ -44,15 +49,25 @@
 DownloadManager::DownloadManager(QWidget* parent)
     : QWidget(parent)
     , ui(new Ui::DownloadManager)
+    , m_model(new DownloadsModel(this))
     , m_isClosing(false)
     , m_lastDownloadOption(NoOption)
 {
     setWindowFlags(windowFlags() ^ Qt::WindowMaximizeButtonHint);
     ui->setupUi(this);
     ui->clearButton->setIcon(QIcon::fromTheme("edit-clear"));
+    ui->list->setModel(m_model);
+    ui->list->setItemDelegate(new DownloadItemDelegate(ui->list));
     QzTools::centerWidgetOnScreen(this);
 
     connect(ui->clearButton, SIGNAL(clicked()), this, SLOT(clearList()));
+    connect(ui->list, &QListView::activated, this, &DownloadManager::itemActivated);
+    connect(ui->list, &QListView::customContextMenuRequested, this, &DownloadManager::customContextMenuRequested);
+    connect(m_model, &DownloadsModel::progressChanged, this, &DownloadManager::updateProgress);
+    connect(m_model, &DownloadsModel::downloadFinished, this, &DownloadManager::downloadFinished);
+    connect(m_model, &DownloadsModel::rowsInserted, this, &DownloadManager::downloadsCountChanged);
+    connect(m_model, &DownloadsModel::rowsRemoved, this, &DownloadManager::downloadsCountChanged);
+    connect(m_model, &DownloadsModel::modelReset, this, &DownloadManager::downloadsCountChanged);
 
     QShortcut* clearShortcut = new QShortcut(QKeySequence("CTRL+L"), this);
     connect(clearShortcut, SIGNAL(activated()), this, SLOT(clearList()));
@@ -83,8 +98,6 @@ void DownloadManager::loadSettings()
 
 void DownloadManager::show()
 {
-    m_timer.start(500, this);
-
     QWidget::show();
     raise();
     activateWindow();
@@ -154,73 +167,25 @@ void DownloadManager::startExternalManager(const QUrl &url)
     m_lastDownloadOption = ExternalManager;
 }
 
-void DownloadManager::timerEvent(QTimerEvent* e)
+void DownloadManager::updateProgress()
 {
-    QVector<QTime> remTimes;
-    QVector<int> progresses;
-    QVector<double> speeds;
-
-    if (e->timerId() == m_timer.timerId()) {
-        if (!ui->list->count()) {
-            ui->speedLabel->clear();
-            setWindowTitle(tr("Download Manager"));
-            return;
-        }
-        for (int i = 0; i < ui->list->count(); i++) {
-            DownloadItem* downItem = qobject_cast<DownloadItem*>(ui->list->itemWidget(ui->list->item(i)));
-            if (!downItem || downItem->isCancelled() || !downItem->isDownloading()) {
-                continue;
-            }
-            progresses.append(downItem->progress());
-            remTimes.append(downItem->remainingTime());
-            speeds.append(downItem->currentSpeed());
-        }
-        if (remTimes.isEmpty()) {
-            return;
-        }
-
-        QTime remaining;
-        foreach (const QTime &time, remTimes) {
-            if (time > remaining) {
-                remaining = time;
-            }
-        }
-
-        int progress = 0;
-        foreach (int prog, progresses) {
-            progress += prog;
-        }
-        progress = progress / progresses.count();
-
-        double speed = 0.00;
-        foreach (double spee, speeds) {
-            speed += spee;
-        }
-
-        ui->speedLabel->setText(tr("%1% of %2 files (%3) %4 remaining").arg(QString::number(progress), QString::number(progresses.count()),
-                                DownloadItem::currentSpeedToString(speed),
-                                DownloadItem::remaingTimeToString(remaining)));
-        setWindowTitle(tr("%1% - Download Manager").arg(progress));
+    if (m_model->activeDownloadsCount() == 0) {
+        ui->speedLabel->clear();
+        setWindowTitle(tr("Download Manager"));
+        return;
     }
 
-    QWidget::timerEvent(e);
+    const int progress = m_model->totalProgress();
+
+    ui->speedLabel->setText(tr("%1% of %2 files (%3) %4 remaining").arg(QString::number(progress), QString::number(m_model->activeDownloadsCount()),
+                            DownloadItem::currentSpeedToString(m_model->totalSpeed()),
+                            DownloadItem::remaingTimeToString(m_model->totalRemainingTime())));
+    setWindowTitle(tr("%1% - Download Manager").arg(progress));
 }
 
 void DownloadManager::clearList()
 {
-    QList<DownloadItem*> items;
-    for (int i = 0; i < ui->list->count(); i++) {
-        DownloadItem* downItem = qobject_cast<DownloadItem*>(ui->list->itemWidget(ui->list->item(i)));
-        if (!downItem) {
-            continue;
-        }
-        if (downItem->isDownloading()) {
-            continue;
-        }
-        items.append(downItem);
-    }
-    qDeleteAll(items);
-    emit downloadsCountChanged();
+    m_model->clearFinished();
 }
 
 void DownloadManager::download(QWebEngineDownloadItem *downloadItem)
@@ -330,49 +295,28 @@ void DownloadManager::download(QWebEngineDownloadItem *downloadItem)
     downloadItem->accept();
 
     // Create download item
-    QListWidgetItem* listItem = new QListWidgetItem(ui->list);
-    DownloadItem* downItem = new DownloadItem(listItem, downloadItem, QFileInfo(downloadPath).absolutePath(), QFileInfo(downloadPath).fileName(), openFile, this);
-    connect(downItem, SIGNAL(deleteItem(DownloadItem*)), this, SLOT(deleteItem(DownloadItem*)));
-    connect(downItem, SIGNAL(downloadFinished(bool)), this, SLOT(downloadFinished(bool)));
-    ui->list->setItemWidget(listItem, downItem);
-    listItem->setSizeHint(downItem->sizeHint());
-    downItem->show();
-
-    m_activeDownloadsCount++;
+    DownloadItem* downItem = new DownloadItem(downloadItem, QFileInfo(downloadPath).absolutePath(), QFileInfo(downloadPath).fileName(), openFile, this);
+    m_model->addDownload(downItem);
+    ui->list->scrollToTop();
+
     emit downloadsCountChanged();
 }
 
 int DownloadManager::downloadsCount() const
 {
-    return ui->list->count();
+    return m_model->sessionDownloadsCount();
 }
 
 int DownloadManager::activeDownloadsCount() const
 {
-    return m_activeDownloadsCount;
+    return m_model->activeDownloadsCount();
 }
 
 void DownloadManager::downloadFinished(bool success)
 {
-    m_activeDownloadsCount = 0;
-    bool downloadingAllFilesFinished = true;
-    for (int i = 0; i < ui->list->count(); i++) {
-        DownloadItem* downItem = qobject_cast<DownloadItem*>(ui->list->itemWidget(ui->list->item(i)));
-        if (!downItem) {
-            continue;
-        }
-        if (downItem->isDownloading()) {
-            m_activeDownloadsCount++;
-        }
-        if (downItem->isCancelled() || !downItem->isDownloading()) {
-            continue;
-        }
-        downloadingAllFilesFinished = false;
-    }
-
     emit downloadsCountChanged();
 
-    if (downloadingAllFilesFinished) {
+    if (m_model->activeDownloadsCount() == 0) {
         if (success && qApp->activeWindow() != this) {
             mApp->desktopNotifications()->showNotification(QIcon::fromTheme(QSL("download"), QIcon(QSL(":icons/other/download.svg"))).pixmap(48), tr("QupZilla: Download Finished"), tr("All files have been successfully downloaded."));
             if (!m_closeOnFinish) {
@@ -388,37 +332,89 @@ void DownloadManager::downloadFinished(bool success)
     }
 }
 
-void DownloadManager::showEvent(QShowEvent *event)
+void DownloadManager::itemActivated(const QModelIndex &index)
+{
+    openFile(index);
+}
+
+void DownloadManager::customContextMenuRequested(const QPoint &pos)
+{
+    const QModelIndex index = ui->list->indexAt(pos);
+    if (!index.isValid()) {
+        return;
+    }
+
+    ui->list->setCurrentIndex(index);
+
+    const int state = index.data(DownloadsModel::StateRole).toInt();
+    const bool downloading = state == DownloadItem::Downloading;
+
+    QMenu menu;
+    menu.addAction(QIcon::fromTheme("document-open"), tr("Open File"), this, SLOT(openFile()))->setEnabled(state == DownloadItem::Completed);
+    menu.addAction(tr("Open Folder"), this, SLOT(openFolder()));
+    menu.addSeparator();
+    menu.addAction(QIcon::fromTheme("edit-copy"), tr("Copy Download Link"), this, SLOT(copyDownloadLink()));
+    menu.addSeparator();
+    menu.addAction(QIcon::fromTheme("process-stop"), tr("Cancel downloading"), this, SLOT(cancelDownload()))->setEnabled(downloading);
+    menu.addAction(QIcon::fromTheme("list-remove"), tr("Remove From List"), this, SLOT(removeFromList()))->setEnabled(!downloading);
+    menu.exec(ui->list->viewport()->mapToGlobal(pos));
+}
+
+void DownloadManager::openFile()
+{
+    openFile(ui->list->currentIndex());
+}
+
+void DownloadManager::openFile(const QModelIndex &index)
+{
+    if (!index.isValid() || index.data(DownloadsModel::StateRole).toInt() != DownloadItem::Completed) {
+        return;
+    }
+
+    QFileInfo info(index.data(DownloadsModel::PathRole).toString(), index.data(DownloadsModel::FileNameRole).toString());
+    if (info.exists()) {
+        QDesktopServices::openUrl(QUrl::fromLocalFile(info.absoluteFilePath()));
+    }
+    else {
+        QMessageBox::warning(this, tr("Not found"), tr("Sorry, the file \n %1 \n was not found!").arg(info.absoluteFilePath()));
+    }
+}
+
+void DownloadManager::openFolder()
+{
+    const QModelIndex index = ui->list->currentIndex();
+    if (index.isValid()) {
+        QDesktopServices::openUrl(QUrl::fromLocalFile(index.data(DownloadsModel::PathRole).toString()));
+    }
+}
+
+void DownloadManager::copyDownloadLink()
 {
-    QWidget::showEvent(event);
+    const QModelIndex index = ui->list->currentIndex();
+    if (index.isValid()) {
+        QApplication::clipboard()->setText(index.data(DownloadsModel::UrlRole).toUrl().toString());
+    }
 }
 
-void DownloadManager::deleteItem(DownloadItem* item)
+void DownloadManager::cancelDownload()
 {
-    if (item && !item->isDownloading()) {
-        delete item;
+    if (DownloadItem* item = m_model->downloadItem(ui->list->currentIndex())) {
+        item->cancel();
     }
 }
 
+void DownloadManager::removeFromList()
+{
+    m_model->removeDownload(ui->list->currentIndex());
+}
+
 bool DownloadManager::canClose()
 {
     if (m_isClosing) {
         return true;
     }
 
-    bool isDownloading = false;
-    for (int i = 0; i < ui->list->count(); i++) {
-        DownloadItem* downItem = qobject_cast<DownloadItem*>(ui->list->itemWidget(ui->list->item(i)));
-        if (!downItem) {
-            continue;
-        }
-        if (downItem->isDownloading()) {
-            isDownloading = true;
-            break;
-        }
-    }
-
-    return !isDownloading;
+    return m_model->activeDownloadsCount() == 0;
 }
 
 bool DownloadManager::useExternalManager() const
@@ -19,7 +19,7 @@
 #define DOWNLOADMANAGER_H
 
 #include <QWidget>
-#include <QBasicTimer>
+#include <QModelIndex>
 
 #include "qzcommon.h"
 
@@ -29,11 +29,9 @@ class DownloadManager;
 }
 
 class QUrl;
-class QNetworkAccessManager;
-class QListWidgetItem;
 class QWebEngineDownloadItem;
 
-class DownloadItem;
+class DownloadsModel;
 class WebPage;
 
 class QUPZILLA_EXPORT DownloadManager : public QWidget
@@ -80,31 +78,37 @@ public slots:
 
 private slots:
     void clearList();
-    void deleteItem(DownloadItem* item);
+    void updateProgress();
     void downloadFinished(bool success);
 
+    void itemActivated(const QModelIndex &index);
+    void customContextMenuRequested(const QPoint &pos);
+    void openFile();
+    void openFolder();
+    void copyDownloadLink();
+    void cancelDownload();
+    void removeFromList();
+
 signals:
     void resized(QSize);
     void downloadsCountChanged();
 
 private:
-    void showEvent(QShowEvent *event) override;
-    void timerEvent(QTimerEvent* e);
     void closeEvent(QCloseEvent* e);
     void resizeEvent(QResizeEvent* e);
     void keyPressEvent(QKeyEvent* e);
 
     void closeDownloadTab(const QUrl &url) const;
+    void openFile(const QModelIndex &index);
 
     Ui::DownloadManager* ui;
-    QBasicTimer m_timer;
+    DownloadsModel* m_model;
 
     QString m_lastDownloadPath;
     QString m_downloadPath;
     bool m_useNativeDialog;
     bool m_isClosing;
     bool m_closeOnFinish;
-    int m_activeDownloadsCount = 0;
 
     bool m_useExternalManager;
     QString m_externalExecutable;
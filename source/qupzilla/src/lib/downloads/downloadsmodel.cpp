@@ -0,0 +1,341 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "downloadsmodel.h"
+#include "sqldatabase.h"
+
+#include <QSqlQuery>
+#include <QFileInfo>
+
+// Number of history entries loaded at once
+static const int fetchChunkSize = 100;
+
+DownloadsModel::DownloadsModel(QObject* parent)
+    : QAbstractListModel(parent)
+    , m_oldestLoadedId(0)
+    , m_canFetchMore(true)
+    , m_sessionCount(0)
+    , m_activeCount(0)
+    , m_activeReceived(0)
+    , m_activeTotal(0)
+    , m_activeSpeed(0)
+{
+    QSqlDatabase db = SqlDatabase::instance()->database();
+    if (!db.tables().contains(QLatin1String("downloads"))) {
+        db.exec("CREATE TABLE downloads (id INTEGER PRIMARY KEY, url TEXT, path TEXT, filename TEXT,"
+                "date NUMERIC, state NUMERIC, size NUMERIC)");
+    }
+
+    QSqlQuery query(db);
+    query.exec(QSL("SELECT MAX(id) FROM downloads"));
+    m_oldestLoadedId = query.next() ? query.value(0).toLongLong() + 1 : 1;
+    m_canFetchMore = m_oldestLoadedId > 1;
+}
+
+int DownloadsModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_downloads.count();
+}
+
+QVariant DownloadsModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_downloads.count()) {
+        return QVariant();
+    }
+
+    const Download &download = m_downloads.at(index.row());
+
+    switch (role) {
+    case IdRole:
+        return download.id;
+    case Qt::DisplayRole:
+    case FileNameRole:
+        return download.fileName;
+    case PathRole:
+        return download.path;
+    case UrlRole:
+        return download.url;
+    case StateRole:
+        return download.state;
+    case DateRole:
+        return download.date;
+    case ReceivedBytesRole:
+        return download.received;
+    case TotalBytesRole:
+        return download.total;
+    case ProgressRole:
+        return download.total > 0 ? int(download.received * 100 / download.total) : 0;
+    case Qt::ToolTipRole:
+        return download.url.toString();
+    case InfoTextRole:
+        return DownloadItem::downloadInfoText(download.state, download.url, download.date, download.received, download.total, download.speed);
+    default:
+        return QVariant();
+    }
+}
+
+bool DownloadsModel::canFetchMore(const QModelIndex &parent) const
+{
+    return !parent.isValid() && m_canFetchMore;
+}
+
+void DownloadsModel::fetchMore(const QModelIndex &parent)
+{
+    if (parent.isValid() || !m_canFetchMore) {
+        return;
+    }
+
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.prepare(QSL("SELECT id, url, path, filename, date, state, size FROM downloads WHERE id < ? ORDER BY id DESC LIMIT ?"));
+    query.addBindValue(m_oldestLoadedId);
+    query.addBindValue(fetchChunkSize);
+    query.exec();
+
+    QVector<Download> downloads;
+    downloads.reserve(fetchChunkSize);
+
+    while (query.next()) {
+        Download download;
+        download.id = query.value(0).toLongLong();
+        download.url = QUrl(query.value(1).toString());
+        download.path = query.value(2).toString();
+        download.fileName = query.value(3).toString();
+        download.date = QDateTime::fromMSecsSinceEpoch(query.value(4).toLongLong());
+        download.state = static_cast<DownloadItem::State>(query.value(5).toInt());
+        download.received = download.total = query.value(6).toLongLong();
+        downloads.append(download);
+    }
+
+    m_canFetchMore = downloads.count() == fetchChunkSize;
+
+    if (downloads.isEmpty()) {
+        return;
+    }
+
+    m_oldestLoadedId = downloads.last().id;
+
+    beginInsertRows(QModelIndex(), m_downloads.count(), m_downloads.count() + downloads.count() - 1);
+    m_downloads.append(downloads);
+    endInsertRows();
+}
+
+void DownloadsModel::addDownload(DownloadItem* item)
+{
+    Download download;
+    download.fileName = item->fileName();
+    download.path = item->path();
+    download.url = item->url();
+    download.date = QDateTime::currentDateTime();
+    download.state = DownloadItem::Downloading;
+    download.received = item->receivedBytes();
+    download.total = item->totalBytes();
+    download.session = true;
+    download.item = item;
+
+    connect(item, &DownloadItem::progressChanged, this, &DownloadsModel::itemProgressChanged);
+    connect(item, &DownloadItem::downloadFinished, this, &DownloadsModel::itemFinished);
+
+    beginInsertRows(QModelIndex(), 0, 0);
+    m_downloads.prepend(download);
+    endInsertRows();
+
+    m_sessionCount++;
+    m_activeCount++;
+    m_activeReceived += download.received;
+    m_activeTotal += qMax<qint64>(0, download.total);
+
+    emit progressChanged();
+}
+
+DownloadItem* DownloadsModel::downloadItem(const QModelIndex &index) const
+{
+    if (!index.isValid() || index.row() >= m_downloads.count()) {
+        return nullptr;
+    }
+    return m_downloads.at(index.row()).item.data();
+}
+
+void DownloadsModel::removeDownload(const QModelIndex &index)
+{
+    if (!index.isValid() || index.row() >= m_downloads.count()) {
+        return;
+    }
+
+    const Download &download = m_downloads.at(index.row());
+    if (download.state == DownloadItem::Downloading) {
+        return;
+    }
+
+    if (download.id > 0) {
+        QSqlQuery query(SqlDatabase::instance()->database());
+        query.prepare(QSL("DELETE FROM downloads WHERE id = ?"));
+        query.addBindValue(download.id);
+        query.exec();
+    }
+
+    if (download.session) {
+        m_sessionCount--;
+    }
+
+    beginRemoveRows(QModelIndex(), index.row(), index.row());
+    m_downloads.remove(index.row());
+    endRemoveRows();
+}
+
+void DownloadsModel::clearFinished()
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.exec(QSL("DELETE FROM downloads"));
+
+    QVector<Download> active;
+    for (const Download &download : qAsConst(m_downloads)) {
+        if (download.state == DownloadItem::Downloading) {
+            active.append(download);
+        }
+    }
+
+    if (active.count() != m_downloads.count()) {
+        beginResetModel();
+        m_downloads = active;
+        endResetModel();
+    }
+
+    m_sessionCount = active.count();
+    m_canFetchMore = false;
+}
+
+int DownloadsModel::activeDownloadsCount() const
+{
+    return m_activeCount;
+}
+
+int DownloadsModel::sessionDownloadsCount() const
+{
+    return m_sessionCount;
+}
+
+int DownloadsModel::totalProgress() const
+{
+    return m_activeTotal > 0 ? int(m_activeReceived * 100 / m_activeTotal) : 0;
+}
+
+double DownloadsModel::totalSpeed() const
+{
+    return m_activeSpeed;
+}
+
+QTime DownloadsModel::totalRemainingTime() const
+{
+    if (m_activeSpeed <= 0 || m_activeTotal <= 0) {
+        return QTime(0, 0, 0);
+    }
+    return QTime(0, 0, 0).addSecs((m_activeTotal - m_activeReceived) / m_activeSpeed);
+}
+
+void DownloadsModel::itemProgressChanged()
+{
+    DownloadItem* item = qobject_cast<DownloadItem*>(sender());
+    const int row = rowForItem(item);
+    if (row < 0) {
+        return;
+    }
+
+    Download &download = m_downloads[row];
+
+    // Update aggregated values only with difference to previous state
+    m_activeReceived += item->receivedBytes() - download.received;
+    m_activeTotal += qMax<qint64>(0, item->totalBytes()) - qMax<qint64>(0, download.total);
+    m_activeSpeed += item->currentSpeed() - download.speed;
+
+    download.received = item->receivedBytes();
+    download.total = item->totalBytes();
+    download.speed = item->currentSpeed();
+
+    const QModelIndex idx = index(row);
+    emit dataChanged(idx, idx, {ReceivedBytesRole, TotalBytesRole, ProgressRole, InfoTextRole});
+    emit progressChanged();
+}
+
+void DownloadsModel::itemFinished(bool success)
+{
+    DownloadItem* item = qobject_cast<DownloadItem*>(sender());
+    const int row = rowForItem(item);
+    if (row < 0) {
+        return;
+    }
+
+    Download &download = m_downloads[row];
+
+    m_activeCount--;
+    m_activeReceived -= download.received;
+    m_activeTotal -= qMax<qint64>(0, download.total);
+    m_activeSpeed -= download.speed;
+
+    if (m_activeCount == 0) {
+        // Avoid accumulating rounding errors
+        m_activeReceived = 0;
+        m_activeTotal = 0;
+        m_activeSpeed = 0;
+    }
+
+    download.state = item->state();
+    download.received = item->receivedBytes();
+    download.total = item->totalBytes();
+    download.speed = 0;
+    download.date = QDateTime::currentDateTime();
+    download.item.clear();
+
+    saveDownload(download);
+
+    const QModelIndex idx = index(row);
+    emit dataChanged(idx, idx);
+    emit progressChanged();
+    emit downloadFinished(success);
+
+    item->deleteLater();
+}
+
+int DownloadsModel::rowForItem(DownloadItem* item) const
+{
+    if (!item) {
+        return -1;
+    }
+
+    // Active downloads are usually at the beginning of the list
+    for (int i = 0; i < m_downloads.count(); ++i) {
+        if (m_downloads.at(i).item == item) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void DownloadsModel::saveDownload(Download &download)
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.prepare(QSL("INSERT INTO downloads (url, path, filename, date, state, size) VALUES (?, ?, ?, ?, ?, ?)"));
+    query.addBindValue(download.url.toString());
+    query.addBindValue(download.path);
+    query.addBindValue(download.fileName);
+    query.addBindValue(download.date.toMSecsSinceEpoch());
+    query.addBindValue(download.state);
+    query.addBindValue(download.total);
+
+    if (query.exec()) {
+        download.id = query.lastInsertId().toLongLong();
+    }
+}
@@ -0,0 +1,114 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef DOWNLOADSMODEL_H
+#define DOWNLOADSMODEL_H
+
+#include <QAbstractListModel>
+#include <QDateTime>
+#include <QPointer>
+#include <QVector>
+
+#include "qzcommon.h"
+#include "downloaditem.h"
+
+// List of active downloads followed by download history.
+// Finished downloads are persisted in database and history is loaded
+// lazily in chunks, so the list can hold thousands of entries.
+class QUPZILLA_EXPORT DownloadsModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        IdRole = Qt::UserRole + 1,
+        FileNameRole = Qt::UserRole + 2,
+        PathRole = Qt::UserRole + 3,
+        UrlRole = Qt::UserRole + 4,
+        StateRole = Qt::UserRole + 5,
+        DateRole = Qt::UserRole + 6,
+        ReceivedBytesRole = Qt::UserRole + 7,
+        TotalBytesRole = Qt::UserRole + 8,
+        ProgressRole = Qt::UserRole + 9,
+        InfoTextRole = Qt::UserRole + 10,
+        MaxRole = InfoTextRole
+    };
+
+    explicit DownloadsModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+
+    void addDownload(DownloadItem* item);
+    DownloadItem* downloadItem(const QModelIndex &index) const;
+
+    void removeDownload(const QModelIndex &index);
+    // Removes all finished downloads, also from history
+    void clearFinished();
+
+    int activeDownloadsCount() const;
+    // Active downloads and downloads finished in this session, without loaded history
+    int sessionDownloadsCount() const;
+
+    // Aggregated over all active downloads
+    int totalProgress() const;
+    double totalSpeed() const;
+    QTime totalRemainingTime() const;
+
+signals:
+    void progressChanged();
+    void downloadFinished(bool success);
+
+private slots:
+    void itemProgressChanged();
+    void itemFinished(bool success);
+
+private:
+    struct Download {
+        qint64 id = 0;
+        QString fileName;
+        QString path;
+        QUrl url;
+        QDateTime date;
+        DownloadItem::State state = DownloadItem::Completed;
+        qint64 received = 0;
+        qint64 total = 0;
+        double speed = 0;
+        bool session = false;
+        QPointer<DownloadItem> item;
+    };
+
+    int rowForItem(DownloadItem* item) const;
+    void saveDownload(Download &download);
+
+    QVector<Download> m_downloads;
+
+    // History rows saved after model creation are already in the list
+    qint64 m_oldestLoadedId;
+    bool m_canFetchMore;
+
+    int m_sessionCount;
+    int m_activeCount;
+    qint64 m_activeReceived;
+    qint64 m_activeTotal;
+    double m_activeSpeed;
+};
+
+#endif // DOWNLOADSMODEL_H
@@ -22,17 +22,30 @@
 #include "settings.h"
 #include "mainapplication.h"
 #include "sqldatabase.h"
+#include "databasemaintenance.h"
 #include "webview.h"
+#include "opensearchengine.h"
 
 #include <QWebEngineProfile>
 
+// Size of in-memory recent and most visited lists
+static const int s_cachedEntriesCount = 20;
+
 History::History(QObject* parent)
     : QObject(parent)
     , m_isSaving(true)
     , m_model(0)
+    , m_cachedListsValid(false)
 {
     loadSettings();
 
+    connect(this, &History::historyEntryAdded, this, &History::cachedEntryAdded);
+    connect(this, &History::historyEntryEdited, this, &History::cachedEntryEdited);
+    connect(this, &History::historyEntryDeleted, this, &History::cachedEntryDeleted);
+    connect(this, &History::resetHistory, this, &History::invalidateCachedLists);
+
+    connect(DatabaseMaintenance::instance(), &DatabaseMaintenance::jobFinished, this, &History::maintenanceJobFinished);
+
     // Prune old history on startup for memory optimization (webOS)
     pruneOldHistory();
 }
@@ -43,10 +56,19 @@ void History::pruneOldHistory()
     const int retentionDays = 30;
     const qint64 cutoffDate = QDateTime::currentDateTime().addDays(-retentionDays).toMSecsSinceEpoch();
 
-    QSqlQuery query(SqlDatabase::instance()->database());
-    query.prepare(QSL("DELETE FROM history WHERE date < ?"));
-    query.addBindValue(cutoffDate);
-    query.exec();
+    // Deleting whole table at once blocks startup, let it run in idle time
+    m_maintenanceJobs.insert(DatabaseMaintenance::instance()->deleteRows(QSL("history"), QSL("date < ?"), {cutoffDate}, DatabaseMaintenance::Idle));
+}
+
+void History::maintenanceJobFinished(int id, int result)
+{
+    if (!m_maintenanceJobs.remove(id)) {
+        return;
+    }
+
+    if (result > 0) {
+        emit resetHistory();
+    }
 }
 
 HistoryModel* History::model()
@@ -194,6 +216,7 @@ void History::deleteHistoryEntry(const QList<int> &list)
     }
 
     mApp->webProfile()->clearVisitedLinks(urls);
+    IconProvider::instance()->clearIconCache();
 
     db.commit();
 }
@@ -242,32 +265,180 @@ bool History::urlIsStored(const QString &url)
 }
 
 QVector<HistoryEntry> History::mostVisited(int count)
+{
+    if (count > s_cachedEntriesCount) {
+        return queryEntries(QSL("count"), count);
+    }
+
+    ensureCachedLists();
+    return m_mostVisitedEntries.mid(0, count);
+}
+
+QVector<HistoryEntry> History::recentEntries(int count)
+{
+    if (count > s_cachedEntriesCount) {
+        return queryEntries(QSL("date"), count);
+    }
+
+    ensureCachedLists();
+    return m_recentEntries.mid(0, count);
+}
+
+QIcon History::iconForEntry(const HistoryEntry &entry)
+{
+    QIcon icon = m_cachedIcons.value(entry.urlString);
+    if (!icon.isNull()) {
+        return icon;
+    }
+
+    icon = IconProvider::iconForUrl(entry.url, true);
+    if (icon.isNull()) {
+        // Icon may be saved later, don't cache the fallback
+        return IconProvider::emptyWebIcon();
+    }
+
+    if (m_cachedIcons.count() >= 2 * s_cachedEntriesCount) {
+        m_cachedIcons.clear();
+    }
+    m_cachedIcons.insert(entry.urlString, icon);
+    return icon;
+}
+
+QVector<HistoryEntry> History::queryEntries(const QString &orderBy, int count) const
 {
     QVector<HistoryEntry> list;
+    list.reserve(count);
+
     QSqlQuery query(SqlDatabase::instance()->database());
-    query.prepare(QString("SELECT count, date, id, title, url FROM history ORDER BY count DESC LIMIT %1").arg(count));
+    query.prepare(QSL("SELECT count, date, id, title, url FROM history ORDER BY %1 DESC LIMIT %2").arg(orderBy).arg(count));
     query.exec();
     while (query.next()) {
         HistoryEntry entry;
         entry.count = query.value(0).toInt();
-        entry.date = query.value(1).toDateTime();
+        entry.date = QDateTime::fromMSecsSinceEpoch(query.value(1).toLongLong());
         entry.id = query.value(2).toInt();
         entry.title = query.value(3).toString();
         entry.url = query.value(4).toUrl();
+        entry.urlString = entry.url.toEncoded();
         list.append(entry);
     }
     return list;
 }
 
+void History::ensureCachedLists()
+{
+    if (m_cachedListsValid) {
+        return;
+    }
+
+    // Both queries use date/count indices
+    m_recentEntries = queryEntries(QSL("date"), s_cachedEntriesCount);
+    m_mostVisitedEntries = queryEntries(QSL("count"), s_cachedEntriesCount);
+    m_cachedListsValid = true;
+}
+
+static int indexOfEntry(const QVector<HistoryEntry> &list, int id)
+{
+    for (int i = 0; i < list.count(); ++i) {
+        if (list.at(i).id == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void insertMostVisited(QVector<HistoryEntry> &list, const HistoryEntry &entry)
+{
+    int i = 0;
+    while (i < list.count() && list.at(i).count >= entry.count) {
+        ++i;
+    }
+
+    // Entries not in the full list have lower count than its last entry
+    if (i < s_cachedEntriesCount) {
+        list.insert(i, entry);
+        if (list.count() > s_cachedEntriesCount) {
+            list.resize(s_cachedEntriesCount);
+        }
+    }
+}
+
+void History::cachedEntryAdded(const HistoryEntry &entry)
+{
+    if (!m_cachedListsValid) {
+        return;
+    }
+
+    m_recentEntries.prepend(entry);
+    if (m_recentEntries.count() > s_cachedEntriesCount) {
+        m_recentEntries.resize(s_cachedEntriesCount);
+    }
+
+    // Only fill the list if it is not full yet, new entry has the lowest count
+    if (m_mostVisitedEntries.count() < s_cachedEntriesCount) {
+        m_mostVisitedEntries.append(entry);
+    }
+}
+
+void History::cachedEntryEdited(const HistoryEntry &before, const HistoryEntry &after)
+{
+    if (!m_cachedListsValid) {
+        return;
+    }
+
+    int index = indexOfEntry(m_recentEntries, before.id);
+    if (index != -1) {
+        m_recentEntries.remove(index);
+    }
+
+    if (after.date >= before.date) {
+        m_recentEntries.prepend(after);
+        if (m_recentEntries.count() > s_cachedEntriesCount) {
+            m_recentEntries.resize(s_cachedEntriesCount);
+        }
+    }
+    else {
+        // Entry moved back in time, its new position is not known
+        m_cachedListsValid = false;
+        return;
+    }
+
+    index = indexOfEntry(m_mostVisitedEntries, before.id);
+    if (index != -1) {
+        m_mostVisitedEntries.remove(index);
+    }
+    insertMostVisited(m_mostVisitedEntries, after);
+
+    // Page was just visited, its icon may have changed
+    m_cachedIcons.remove(after.urlString);
+}
+
+void History::cachedEntryDeleted(const HistoryEntry &entry)
+{
+    m_cachedIcons.remove(entry.urlString);
+
+    // Next entry that should take its place is not known, load the lists again
+    if (indexOfEntry(m_recentEntries, entry.id) != -1 || indexOfEntry(m_mostVisitedEntries, entry.id) != -1) {
+        m_cachedListsValid = false;
+    }
+}
+
+void History::invalidateCachedLists()
+{
+    m_cachedListsValid = false;
+    m_recentEntries.clear();
+    m_mostVisitedEntries.clear();
+    m_cachedIcons.clear();
+}
+
 void History::clearHistory()
 {
-    QSqlQuery query(SqlDatabase::instance()->database());
-    query.exec(QSL("DELETE FROM history"));
-    query.exec(QSL("VACUUM"));
+    // resetHistory() is emitted once all rows are deleted, VACUUM is
+    // scheduled by DatabaseMaintenance when enough pages were freed
+    m_maintenanceJobs.insert(DatabaseMaintenance::instance()->deleteRows(QSL("history"), QString(), QVariantList(), DatabaseMaintenance::Immediate));
 
     mApp->webProfile()->clearAllVisitedLinks();
-
-    emit resetHistory();
+    OpenSearchEngine::clearSuggestionsCache();
 }
 
 void History::setSaving(bool state)
@@ -20,13 +20,14 @@
 
 #include <QObject>
 #include <QList>
+#include <QSet>
 #include <QDateTime>
+#include <QHash>
+#include <QIcon>
 #include <QUrl>
 
 #include "qzcommon.h"
 
-class QIcon;
-
 class WebView;
 class HistoryModel;
 
@@ -60,7 +61,12 @@ public:
 
     bool urlIsStored(const QString &url);
 
+    // Up to 20 entries are served from memory, without querying the database
     QVector<HistoryEntry> mostVisited(int count);
+    QVector<HistoryEntry> recentEntries(int count);
+
+    // Icon of recent/most visited entry, cached while the entry is in the lists
+    QIcon iconForEntry(const HistoryEntry &entry);
 
     void clearHistory();
     bool isSaving();
@@ -75,11 +81,27 @@ signals:
 
     void resetHistory();
 
+private slots:
+    void maintenanceJobFinished(int id, int result);
+
+    void cachedEntryAdded(const HistoryEntry &entry);
+    void cachedEntryEdited(const HistoryEntry &before, const HistoryEntry &after);
+    void cachedEntryDeleted(const HistoryEntry &entry);
+    void invalidateCachedLists();
+
 private:
     void pruneOldHistory();
+    void ensureCachedLists();
+    QVector<HistoryEntry> queryEntries(const QString &orderBy, int count) const;
 
     bool m_isSaving;
     HistoryModel* m_model;
+    QSet<int> m_maintenanceJobs;
+
+    bool m_cachedListsValid;
+    QVector<HistoryEntry> m_recentEntries;
+    QVector<HistoryEntry> m_mostVisitedEntries;
+    QHash<QString, QIcon> m_cachedIcons;
 };
 
 typedef History::HistoryEntry HistoryEntry;
@@ -24,8 +24,9 @@ HistoryItem::HistoryItem(HistoryItem* parent)
     , m_startTimestamp(0)
     , m_endTimestamp(0)
 {
+    // New item can't be a child yet, so skip the lookup done in appendChild()
     if (m_parent) {
-        m_parent->appendChild(this);
+        m_parent->m_children.append(this);
     }
 }
 
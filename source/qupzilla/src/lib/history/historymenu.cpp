@@ -25,7 +25,6 @@
 #include "qztools.h"
 #include "history.h"
 #include "qzsettings.h"
-#include "sqldatabase.h"
 #include "closedwindowsmanager.h"
 
 #include <QApplication>
@@ -91,16 +90,12 @@ void HistoryMenu::aboutToShow()
 
     addSeparator();
 
-    QSqlQuery query(SqlDatabase::instance()->database());
-    query.exec(QSL("SELECT title, url FROM history ORDER BY date DESC LIMIT 10"));
+    const QVector<HistoryEntry> recentEntries = mApp->history()->recentEntries(10);
 
-    while (query.next()) {
-        const QUrl url = query.value(1).toUrl();
-        const QString title = QzTools::truncatedText(query.value(0).toString(), 40);
-
-        Action* act = new Action(title);
-        act->setData(url);
-        act->setIcon(IconProvider::iconForUrl(url));
+    foreach (const HistoryEntry &entry, recentEntries) {
+        Action* act = new Action(QzTools::truncatedText(entry.title, 40));
+        act->setData(entry.url);
+        act->setIcon(mApp->history()->iconForEntry(entry));
         connect(act, SIGNAL(triggered()), this, SLOT(historyEntryActivated()));
         connect(act, SIGNAL(ctrlTriggered()), this, SLOT(historyEntryCtrlActivated()));
         connect(act, SIGNAL(shiftTriggered()), this, SLOT(historyEntryShiftActivated()));
@@ -124,7 +119,7 @@ void HistoryMenu::aboutToShowMostVisited()
     foreach (const HistoryEntry &entry, mostVisited) {
         Action* act = new Action(QzTools::truncatedText(entry.title, 40));
         act->setData(entry.url);
-        act->setIcon(IconProvider::iconForUrl(entry.url));
+        act->setIcon(mApp->history()->iconForEntry(entry));
         connect(act, SIGNAL(triggered()), this, SLOT(historyEntryActivated()));
         connect(act, SIGNAL(ctrlTriggered()), this, SLOT(historyEntryCtrlActivated()));
         connect(act, SIGNAL(shiftTriggered()), this, SLOT(historyEntryShiftActivated()));
@@ -149,8 +144,8 @@ void HistoryMenu::aboutToShowClosedTabs()
     const auto closedTabs = tabWidget->closedTabsManager()->closedTabs();
     for (int i = 0; i < closedTabs.count(); ++i) {
         const ClosedTabsManager::Tab tab = closedTabs.at(i);
-        const QString title = QzTools::truncatedText(tab.tabState.title, 40);
-        m_menuClosedTabs->addAction(tab.tabState.icon, title, tabWidget, SLOT(restoreClosedTab()))->setData(i);
+        const QString title = QzTools::truncatedText(tab.title, 40);
+        m_menuClosedTabs->addAction(tab.icon, title, tabWidget, SLOT(restoreClosedTab()))->setData(i);
     }
 
     if (m_menuClosedTabs->isEmpty()) {
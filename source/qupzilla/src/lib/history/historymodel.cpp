@@ -17,11 +17,13 @@
 * ============================================================ */
 #include "historymodel.h"
 #include "historyitem.h"
+#include "historysearchjob.h"
 #include "iconprovider.h"
+#include "mainapplication.h"
 #include "sqldatabase.h"
 
-#include <QApplication>
 #include <QDateTime>
+#include <QSet>
 #include <QTimer>
 
 static QString dateTimeToString(const QDateTime &dateTime)
@@ -48,6 +50,38 @@ HistoryModel::HistoryModel(History* history)
     connect(m_history, SIGNAL(historyEntryEdited(HistoryEntry,HistoryEntry)), this, SLOT(historyEntryEdited(HistoryEntry,HistoryEntry)));
 }
 
+HistoryModel::HistoryModel(History* history, const QString &searchString, QObject* parent)
+    : QAbstractItemModel(parent)
+    , m_rootItem(new HistoryItem(0))
+    , m_todayItem(0)
+    , m_history(history)
+    , m_searchString(searchString)
+{
+    startSearch();
+
+    connect(m_history, SIGNAL(resetHistory()), this, SLOT(resetHistory()));
+    connect(m_history, SIGNAL(historyEntryAdded(HistoryEntry)), this, SLOT(historyEntryAdded(HistoryEntry)));
+    connect(m_history, SIGNAL(historyEntryDeleted(HistoryEntry)), this, SLOT(historyEntryDeleted(HistoryEntry)));
+    connect(m_history, SIGNAL(historyEntryEdited(HistoryEntry,HistoryEntry)), this, SLOT(historyEntryEdited(HistoryEntry,HistoryEntry)));
+}
+
+HistoryModel::~HistoryModel()
+{
+    cancelSearch();
+
+    delete m_rootItem;
+}
+
+QString HistoryModel::searchString() const
+{
+    return m_searchString;
+}
+
+bool HistoryModel::isSearching() const
+{
+    return m_searchJob;
+}
+
 QVariant HistoryModel::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (orientation == Qt::Horizontal && role == Qt::DisplayRole) {
@@ -262,15 +296,88 @@ void HistoryModel::resetHistory()
 {
     beginResetModel();
 
+    cancelSearch();
+
     delete m_rootItem;
     m_todayItem = 0;
     m_rootItem = new HistoryItem(0);
 
-    init();
+    if (m_searchString.isEmpty()) {
+        init();
+    }
+    else {
+        startSearch();
+    }
 
     endResetModel();
 }
 
+void HistoryModel::searchEntriesFound(const QVector<HistoryEntry> &entries)
+{
+    // Ignore results still queued from cancelled job
+    if (sender() != m_searchJob) {
+        return;
+    }
+
+    // Entries are ordered by date, so they are always appended to the last top level item
+    int i = 0;
+    while (i < entries.size()) {
+        HistoryItem* parentItem = m_rootItem->childCount() > 0 ? m_rootItem->child(m_rootItem->childCount() - 1) : 0;
+        const qint64 timestamp = entries.at(i).date.toMSecsSinceEpoch();
+
+        if (!parentItem || timestamp < parentItem->endTimestamp()) {
+            qint64 start;
+            qint64 end;
+            QString title;
+            topLevelRange(timestamp, start, end, title);
+
+            const int row = m_rootItem->childCount();
+            beginInsertRows(QModelIndex(), row, row);
+
+            parentItem = new HistoryItem(m_rootItem);
+            parentItem->setStartTimestamp(start);
+            parentItem->setEndTimestamp(end);
+            parentItem->title = title;
+
+            if (start == -1) {
+                m_todayItem = parentItem;
+            }
+
+            endInsertRows();
+        }
+
+        int last = i;
+        while (last + 1 < entries.size() && entries.at(last + 1).date.toMSecsSinceEpoch() >= parentItem->endTimestamp()) {
+            ++last;
+        }
+
+        const int first = parentItem->childCount();
+        beginInsertRows(createIndex(parentItem->row(), 0, parentItem), first, first + last - i);
+
+        for (; i <= last; ++i) {
+            HistoryItem* item = new HistoryItem(parentItem);
+            item->historyEntry = entries.at(i);
+        }
+
+        endInsertRows();
+    }
+
+    emit searchResultsAdded();
+}
+
+void HistoryModel::searchJobFinished()
+{
+    HistorySearchJob* job = qobject_cast<HistorySearchJob*>(sender());
+    Q_ASSERT(job);
+
+    if (job == m_searchJob) {
+        m_searchJob = 0;
+        emit searchFinished();
+    }
+
+    job->deleteLater();
+}
+
 bool HistoryModel::canFetchMore(const QModelIndex &parent) const
 {
     HistoryItem* parentItem = itemFromIndex(parent);
@@ -288,9 +395,10 @@ void HistoryModel::fetchMore(const QModelIndex &parent)
 
     parentItem->canFetchMore = false;
 
-    QList<int> idList;
+    QSet<int> idList;
+    idList.reserve(parentItem->childCount());
     for (int i = 0; i < parentItem->childCount(); ++i) {
-        idList.append(parentItem->child(i)->historyEntry.id);
+        idList.insert(parentItem->child(i)->historyEntry.id);
     }
 
     QSqlQuery query(SqlDatabase::instance()->database());
@@ -331,6 +439,12 @@ void HistoryModel::fetchMore(const QModelIndex &parent)
 
 void HistoryModel::historyEntryAdded(const HistoryEntry &entry)
 {
+    if (!m_searchString.isEmpty() &&
+        !entry.urlString.contains(m_searchString, Qt::CaseInsensitive) &&
+        !entry.title.contains(m_searchString, Qt::CaseInsensitive)) {
+        return;
+    }
+
     if (!m_todayItem) {
         beginInsertRows(QModelIndex(), 0, 0);
 
@@ -454,55 +568,29 @@ void HistoryModel::init()
         return;
     }
 
-    const QDate today = QDate::currentDate();
-    const QDate week = today.addDays(1 - today.dayOfWeek());
-    const QDate month = QDate(today.year(), today.month(), 1);
     const qint64 currentTimestamp = QDateTime::currentMSecsSinceEpoch();
 
     qint64 timestamp = currentTimestamp;
     while (timestamp > minTimestamp) {
-        QDate timestampDate = QDateTime::fromMSecsSinceEpoch(timestamp).date();
+        qint64 startTimestamp;
         qint64 endTimestamp;
         QString itemName;
-
-        if (timestampDate == today) {
-            endTimestamp = QDateTime(today).toMSecsSinceEpoch();
-
-            itemName = tr("Today");
-        }
-        else if (timestampDate >= week) {
-            endTimestamp = QDateTime(week).toMSecsSinceEpoch();
-
-            itemName = tr("This Week");
-        }
-        else if (timestampDate.month() == month.month() && timestampDate.year() == month.year()) {
-            endTimestamp = QDateTime(month).toMSecsSinceEpoch();
-
-            itemName = tr("This Month");
-        }
-        else {
-            QDate startDate(timestampDate.year(), timestampDate.month(), timestampDate.daysInMonth());
-            QDate endDate(startDate.year(), startDate.month(), 1);
-
-            timestamp = QDateTime(startDate, QTime(23, 59, 59)).toMSecsSinceEpoch();
-            endTimestamp = QDateTime(endDate).toMSecsSinceEpoch();
-            itemName = QString("%1 %2").arg(History::titleCaseLocalizedMonth(timestampDate.month()), QString::number(timestampDate.year()));
-        }
+        topLevelRange(timestamp, startTimestamp, endTimestamp, itemName);
 
         QSqlQuery query(SqlDatabase::instance()->database());
         query.prepare("SELECT id FROM history WHERE date BETWEEN ? AND ? LIMIT 1");
         query.addBindValue(endTimestamp);
-        query.addBindValue(timestamp);
+        query.addBindValue(startTimestamp == -1 ? currentTimestamp : startTimestamp);
         query.exec();
 
         if (query.next()) {
             HistoryItem* item = new HistoryItem(m_rootItem);
-            item->setStartTimestamp(timestamp == currentTimestamp ? -1 : timestamp);
+            item->setStartTimestamp(startTimestamp);
             item->setEndTimestamp(endTimestamp);
             item->title = itemName;
             item->canFetchMore = true;
 
-            if (timestamp == currentTimestamp) {
+            if (startTimestamp == -1) {
                 m_todayItem = item;
             }
         }
@@ -511,12 +599,69 @@ void HistoryModel::init()
     }
 }
 
+// Computes range of top level item into which timestamp belongs
+// start is -1 for today item (open range)
+void HistoryModel::topLevelRange(qint64 timestamp, qint64 &start, qint64 &end, QString &title) const
+{
+    const QDate today = QDate::currentDate();
+    const QDate week = today.addDays(1 - today.dayOfWeek());
+    const QDate month = QDate(today.year(), today.month(), 1);
+    const QDate timestampDate = QDateTime::fromMSecsSinceEpoch(timestamp).date();
+
+    if (timestampDate >= today) {
+        start = -1;
+        end = QDateTime(today).toMSecsSinceEpoch();
+        title = tr("Today");
+    }
+    else if (timestampDate >= week) {
+        start = QDateTime(today).toMSecsSinceEpoch() - 1;
+        end = QDateTime(week).toMSecsSinceEpoch();
+        title = tr("This Week");
+    }
+    else if (timestampDate.month() == month.month() && timestampDate.year() == month.year()) {
+        start = QDateTime(week).toMSecsSinceEpoch() - 1;
+        end = QDateTime(month).toMSecsSinceEpoch();
+        title = tr("This Month");
+    }
+    else {
+        QDate startDate(timestampDate.year(), timestampDate.month(), timestampDate.daysInMonth());
+        QDate endDate(startDate.year(), startDate.month(), 1);
+
+        start = QDateTime(startDate, QTime(23, 59, 59)).toMSecsSinceEpoch();
+        end = QDateTime(endDate).toMSecsSinceEpoch();
+        title = QString("%1 %2").arg(History::titleCaseLocalizedMonth(timestampDate.month()), QString::number(timestampDate.year()));
+    }
+}
+
+void HistoryModel::startSearch()
+{
+    m_searchJob = new HistorySearchJob(m_searchString);
+    connect(m_searchJob.data(), SIGNAL(entriesFound(QVector<HistoryEntry>)), this, SLOT(searchEntriesFound(QVector<HistoryEntry>)));
+    connect(m_searchJob.data(), SIGNAL(finished()), this, SLOT(searchJobFinished()));
+}
+
+void HistoryModel::cancelSearch()
+{
+    if (!m_searchJob) {
+        return;
+    }
+
+    // Job deletes itself once the worker thread returns
+    HistorySearchJob* job = m_searchJob;
+    m_searchJob = 0;
+
+    disconnect(job, 0, this, 0);
+    connect(job, SIGNAL(finished()), job, SLOT(deleteLater()));
+    job->jobCancelled();
+}
+
 // HistoryFilterModel
-HistoryFilterModel::HistoryFilterModel(QAbstractItemModel* parent)
+HistoryFilterModel::HistoryFilterModel(HistoryModel* parent)
     : QSortFilterProxyModel(parent)
+    , m_historyModel(parent)
+    , m_searchModel(0)
 {
-    setSourceModel(parent);
-    setFilterCaseSensitivity(Qt::CaseInsensitive);
+    setSourceModel(m_historyModel);
 
     m_filterTimer = new QTimer(this);
     m_filterTimer->setSingleShot(true);
@@ -525,6 +670,11 @@ HistoryFilterModel::HistoryFilterModel(QAbstractItemModel* parent)
     connect(m_filterTimer, SIGNAL(timeout()), this, SLOT(startFiltering()));
 }
 
+HistoryModel* HistoryFilterModel::historyModel() const
+{
+    return m_searchModel ? m_searchModel : m_historyModel;
+}
+
 void HistoryFilterModel::setFilterFixedString(const QString &pattern)
 {
     m_pattern = pattern;
@@ -534,30 +684,25 @@ void HistoryFilterModel::setFilterFixedString(const QString &pattern)
 
 void HistoryFilterModel::startFiltering()
 {
-    if (m_pattern.isEmpty()) {
-        emit collapseAllItems();
-        QSortFilterProxyModel::setFilterFixedString(m_pattern);
+    if (m_searchModel && m_searchModel->searchString() == m_pattern) {
         return;
     }
 
-    QApplication::setOverrideCursor(Qt::WaitCursor);
-
-    // Expand all items also calls fetchmore
-    emit expandAllItems();
-
-    QSortFilterProxyModel::setFilterFixedString(m_pattern);
+    HistoryModel* oldSearchModel = m_searchModel;
+    m_searchModel = 0;
 
-    QApplication::restoreOverrideCursor();
-}
-
-bool HistoryFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
-{
-    const QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
-
-    if (index.data(HistoryModel::IsTopLevelRole).toBool()) {
-        return true;
+    if (m_pattern.isEmpty()) {
+        setSourceModel(m_historyModel);
+        delete oldSearchModel;
+        emit collapseAllItems();
+        return;
     }
 
-    return (index.data(HistoryModel::UrlStringRole).toString().contains(m_pattern, Qt::CaseInsensitive) ||
-            index.data(HistoryModel::TitleRole).toString().contains(m_pattern, Qt::CaseInsensitive));
+    // Matching entries are queried in background and added as they arrive,
+    // so the main model never needs to load the whole history
+    m_searchModel = new HistoryModel(mApp->history(), m_pattern, this);
+    connect(m_searchModel, SIGNAL(searchResultsAdded()), this, SIGNAL(expandAllItems()));
+
+    setSourceModel(m_searchModel);
+    delete oldSearchModel;
 }
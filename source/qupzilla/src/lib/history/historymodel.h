@@ -19,6 +19,7 @@
 #define HISTORYMODEL_H
 
 #include <QAbstractItemModel>
+#include <QPointer>
 #include <QSortFilterProxyModel>
 
 #include "qzcommon.h"
@@ -28,6 +29,7 @@ class QTimer;
 
 class History;
 class HistoryItem;
+class HistorySearchJob;
 
 class QUPZILLA_EXPORT HistoryModel : public QAbstractItemModel
 {
@@ -46,6 +48,12 @@ public:
     };
 
     explicit HistoryModel(History* history);
+    // Contains only entries matching searchString, loaded in background
+    explicit HistoryModel(History* history, const QString &searchString, QObject* parent);
+    ~HistoryModel();
+
+    QString searchString() const;
+    bool isSearching() const;
 
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
     QVariant data(const QModelIndex &index, int role) const;
@@ -68,9 +76,13 @@ public:
     void removeTopLevelIndexes(const QList<QPersistentModelIndex> &indexes);
 
 signals:
+    void searchResultsAdded();
+    void searchFinished();
 
 private slots:
     void resetHistory();
+    void searchEntriesFound(const QVector<HistoryEntry> &entries);
+    void searchJobFinished();
 
     void historyEntryAdded(const HistoryEntry &entry);
     void historyEntryDeleted(const HistoryEntry &entry);
@@ -79,18 +91,26 @@ private slots:
 private:
     HistoryItem* findHistoryItem(const HistoryEntry &entry);
     void checkEmptyParentItem(HistoryItem* item);
+    void topLevelRange(qint64 timestamp, qint64 &start, qint64 &end, QString &title) const;
+    void startSearch();
+    void cancelSearch();
     void init();
 
     HistoryItem* m_rootItem;
     HistoryItem* m_todayItem;
     History* m_history;
+
+    QString m_searchString;
+    QPointer<HistorySearchJob> m_searchJob;
 };
 
 class QUPZILLA_EXPORT HistoryFilterModel : public QSortFilterProxyModel
 {
     Q_OBJECT
 public:
-    explicit HistoryFilterModel(QAbstractItemModel* parent);
+    explicit HistoryFilterModel(HistoryModel* parent);
+
+    HistoryModel* historyModel() const;
 
 public slots:
     void setFilterFixedString(const QString &pattern);
@@ -99,13 +119,12 @@ signals:
     void expandAllItems();
     void collapseAllItems();
 
-protected:
-    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const;
-
 private slots:
     void startFiltering();
 
 private:
+    HistoryModel* m_historyModel;
+    HistoryModel* m_searchModel;
     QString m_pattern;
     QTimer* m_filterTimer;
 };
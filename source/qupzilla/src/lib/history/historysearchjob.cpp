@@ -0,0 +1,112 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "historysearchjob.h"
+#include "mainapplication.h"
+#include "sqldatabase.h"
+
+#include <QtConcurrent/QtConcurrentRun>
+
+HistorySearchJob::HistorySearchJob(const QString &searchString, QObject* parent)
+    : QObject(parent)
+    , m_searchString(searchString)
+    , m_jobCancelled(0)
+{
+    qRegisterMetaType<QVector<HistoryEntry> >();
+
+    m_watcher = new QFutureWatcher<void>(this);
+    connect(m_watcher, SIGNAL(finished()), this, SLOT(slotFinished()));
+
+    QFuture<void> future = QtConcurrent::run(this, &HistorySearchJob::runJob);
+    m_watcher->setFuture(future);
+}
+
+QString HistorySearchJob::searchString() const
+{
+    return m_searchString;
+}
+
+bool HistorySearchJob::isCanceled() const
+{
+    return m_jobCancelled.load();
+}
+
+int HistorySearchJob::chunkSize()
+{
+    return 100;
+}
+
+void HistorySearchJob::jobCancelled()
+{
+    m_jobCancelled.store(1);
+}
+
+void HistorySearchJob::slotFinished()
+{
+    emit finished();
+}
+
+void HistorySearchJob::runJob()
+{
+    if (isCanceled() || mApp->isClosing()) {
+        return;
+    }
+
+    QString pattern = m_searchString;
+    pattern.replace(QL1C('!'), QL1S("!!"));
+    pattern.replace(QL1C('%'), QL1S("!%"));
+    pattern.replace(QL1C('_'), QL1S("!_"));
+    pattern = QL1C('%') + pattern + QL1C('%');
+
+    // LIKE with a leading wildcard cannot use an index, so this is still a full
+    // table scan. Results are only delivered in chunks as they are read.
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.setForwardOnly(true);
+    query.prepare(QSL("SELECT id, count, title, url, date FROM history "
+                      "WHERE title LIKE ? ESCAPE '!' OR url LIKE ? ESCAPE '!' ORDER BY date DESC"));
+    query.addBindValue(pattern);
+    query.addBindValue(pattern);
+    query.exec();
+
+    QVector<HistoryEntry> entries;
+    entries.reserve(chunkSize());
+
+    while (query.next()) {
+        if (isCanceled()) {
+            return;
+        }
+
+        HistoryEntry entry;
+        entry.id = query.value(0).toInt();
+        entry.count = query.value(1).toInt();
+        entry.title = query.value(2).toString();
+        entry.url = query.value(3).toUrl();
+        entry.date = QDateTime::fromMSecsSinceEpoch(query.value(4).toLongLong());
+        entry.urlString = entry.url.toEncoded();
+        entries.append(entry);
+
+        if (entries.size() == chunkSize()) {
+            emit entriesFound(entries);
+            entries.clear();
+            entries.reserve(chunkSize());
+        }
+    }
+
+    if (!entries.isEmpty() && !isCanceled()) {
+        emit entriesFound(entries);
+    }
+}
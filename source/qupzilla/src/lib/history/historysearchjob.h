@@ -0,0 +1,63 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef HISTORYSEARCHJOB_H
+#define HISTORYSEARCHJOB_H
+
+#include <QAtomicInt>
+#include <QFutureWatcher>
+#include <QVector>
+
+#include "qzcommon.h"
+#include "history.h"
+
+// Searches history table in worker thread and reports matching entries
+// in chunks ordered by date (newest first)
+class QUPZILLA_EXPORT HistorySearchJob : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit HistorySearchJob(const QString &searchString, QObject* parent = 0);
+
+    QString searchString() const;
+    bool isCanceled() const;
+
+    // Entries are delivered (queued) in chunks of this size
+    static int chunkSize();
+
+signals:
+    void entriesFound(const QVector<HistoryEntry> &entries);
+    void finished();
+
+public slots:
+    void jobCancelled();
+
+private slots:
+    void slotFinished();
+
+private:
+    void runJob();
+
+    QString m_searchString;
+    QFutureWatcher<void>* m_watcher;
+    QAtomicInt m_jobCancelled;
+};
+
+Q_DECLARE_METATYPE(QVector<HistoryEntry>)
+
+#endif // HISTORYSEARCHJOB_H
@@ -116,7 +116,7 @@ void HistoryTreeView::removeSelectedItems()
 
             list.append(m_history->indexesFromTimeRange(start, end));
 
-            topLevelIndexes.append(index);
+            topLevelIndexes.append(m_filter->mapToSource(index));
         }
         else {
             int id = index.data(HistoryModel::IdRole).toInt();
@@ -127,7 +127,7 @@ void HistoryTreeView::removeSelectedItems()
     }
 
     m_history->deleteHistoryEntry(list);
-    m_history->model()->removeTopLevelIndexes(topLevelIndexes);
+    m_filter->historyModel()->removeTopLevelIndexes(topLevelIndexes);
 
     QApplication::restoreOverrideCursor();
 }
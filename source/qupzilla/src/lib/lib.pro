@@ -1,4 +1,4 @@
-QT += webenginecore webenginewidgets webchannel network widgets sql quickwidgets printsupport
+QT += webenginecore webenginewidgets webchannel network widgets sql qml quickwidgets printsupport
 
 TARGET = QupZilla
 TEMPLATE = lib
@@ -59,6 +59,8 @@ SOURCES += \
     app/proxystyle.cpp \
     app/qzcommon.cpp \
     app/settings.cpp \
+    app/startupscheduler.cpp \
+    app/themecompiler.cpp \
     autofill/autofill.cpp \
     autofill/autofillicon.cpp \
     autofill/autofillnotification.cpp \
@@ -67,6 +69,7 @@ SOURCES += \
     autofill/passwordbackends/databasepasswordbackend.cpp \
     autofill/passwordbackends/passwordbackend.cpp \
     autofill/passwordmanager.cpp \
+    autofill/passwordmodel.cpp \
     bookmarks/bookmarkitem.cpp \
     bookmarks/bookmarks.cpp \
     bookmarks/bookmarksexport/bookmarksexportdialog.cpp \
@@ -93,13 +96,16 @@ SOURCES += \
     cookies/cookiemanager.cpp \
     downloads/downloadsbutton.cpp \
     downloads/downloaditem.cpp \
+    downloads/downloaditemdelegate.cpp \
     downloads/downloadmanager.cpp \
     downloads/downloadoptionsdialog.cpp \
+    downloads/downloadsmodel.cpp \
     history/history.cpp \
     history/historyitem.cpp \
     history/historymanager.cpp \
     history/historymenu.cpp \
     history/historymodel.cpp \
+    history/historysearchjob.cpp \
     history/historytreeview.cpp \
     navigation/completer/locationcompleter.cpp \
     navigation/completer/locationcompleterdelegate.cpp \
@@ -120,6 +126,7 @@ SOURCES += \
     network/networkmanager.cpp \
     network/networkproxyfactory.cpp \
     network/networkurlinterceptor.cpp \
+    network/pacrunner.cpp \
     network/schemehandlers/extensionschemehandler.cpp \
     #network/schemehandlers/fileschemehandler.cpp \
     network/schemehandlers/qupzillaschemehandler.cpp \
@@ -163,6 +170,7 @@ SOURCES += \
     session/restoremanager.cpp \
     session/sessionmanager.cpp \
     session/sessionmanagerdialog.cpp \
+    session/sessionstore.cpp \
     sidebar/bookmarkssidebar.cpp \
     sidebar/historysidebar.cpp \
     sidebar/sidebar.cpp \
@@ -182,9 +190,11 @@ SOURCES += \
     tools/buttonwithmenu.cpp \
     tools/certificateinfowidget.cpp \
     tools/clickablelabel.cpp \
+    tools/closeditemsstore.cpp \
     tools/closedtabsmanager.cpp \
     tools/closedwindowsmanager.cpp \
     tools/colors.cpp \
+    tools/databasemaintenance.cpp \
     tools/delayedfilewatcher.cpp \
     tools/docktitlebarwidget.cpp \
     tools/emptynetworkreply.cpp \
@@ -208,11 +218,13 @@ SOURCES += \
     tools/scripts.cpp \
     tools/sqldatabase.cpp \
     tools/toolbutton.cpp \
+    tools/tracerecorder.cpp \
     tools/treewidget.cpp \
     tools/widget.cpp \
     tools/wheelhelper.cpp \
     webengine/javascript/autofilljsobject.cpp \
     webengine/javascript/externaljsobject.cpp \
+    webengine/javascript/scrollbarsjsobject.cpp \
     webengine/loadrequest.cpp \
     webengine/webhittestresult.cpp \
     webengine/webinspector.cpp \
@@ -241,6 +253,8 @@ HEADERS  += \
     app/proxystyle.h \
     app/qzcommon.h \
     app/settings.h \
+    app/startupscheduler.h \
+    app/themecompiler.h \
     autofill/autofill.h \
     autofill/autofillicon.h \
     autofill/autofillnotification.h \
@@ -249,6 +263,7 @@ HEADERS  += \
     autofill/passwordbackends/databasepasswordbackend.h \
     autofill/passwordbackends/passwordbackend.h \
     autofill/passwordmanager.h \
+    autofill/passwordmodel.h \
     bookmarks/bookmarkitem.h \
     bookmarks/bookmarksexport/bookmarksexportdialog.h \
     bookmarks/bookmarksexport/bookmarksexporter.h \
@@ -275,13 +290,16 @@ HEADERS  += \
     cookies/cookiemanager.h \
     downloads/downloadsbutton.h \
     downloads/downloaditem.h \
+    downloads/downloaditemdelegate.h \
     downloads/downloadmanager.h \
     downloads/downloadoptionsdialog.h \
+    downloads/downloadsmodel.h \
     history/history.h \
     history/historyitem.h \
     history/historymanager.h \
     history/historymenu.h \
     history/historymodel.h \
+    history/historysearchjob.h \
     history/historytreeview.h \
     navigation/completer/locationcompleterdelegate.h \
     navigation/completer/locationcompleter.h \
@@ -302,6 +320,7 @@ HEADERS  += \
     network/networkmanager.h \
     network/networkproxyfactory.h \
     network/networkurlinterceptor.h \
+    network/pacrunner.h \
     network/schemehandlers/extensionschemehandler.h \
     #network/schemehandlers/fileschemehandler.h \
     network/schemehandlers/qupzillaschemehandler.h \
@@ -347,6 +366,7 @@ HEADERS  += \
     session/restoremanager.h \
     session/sessionmanager.h \
     session/sessionmanagerdialog.h \
+    session/sessionstore.h \
     sidebar/bookmarkssidebar.h \
     sidebar/historysidebar.h \
     sidebar/sidebar.h \
@@ -367,9 +387,11 @@ HEADERS  += \
     tools/buttonwithmenu.h \
     tools/certificateinfowidget.h \
     tools/clickablelabel.h \
+    tools/closeditemsstore.h \
     tools/closedtabsmanager.h \
     tools/closedwindowsmanager.h \
     tools/colors.h \
+    tools/databasemaintenance.h \
     tools/delayedfilewatcher.h \
     tools/docktitlebarwidget.h \
     tools/emptynetworkreply.h \
@@ -391,13 +413,16 @@ HEADERS  += \
     tools/qztools.h \
     tools/removeitemfocusdelegate.h \
     tools/scripts.h \
+    tools/spscringbuffer.h \
     tools/sqldatabase.h \
     tools/toolbutton.h \
+    tools/tracerecorder.h \
     tools/treewidget.h \
     tools/widget.h \
     tools/wheelhelper.h \
     webengine/javascript/autofilljsobject.h \
     webengine/javascript/externaljsobject.h \
+    webengine/javascript/scrollbarsjsobject.h \
     webengine/loadrequest.h \
     webengine/webhittestresult.cpp \
     webengine/webinspector.h \
@@ -418,7 +443,6 @@ FORMS    += \
     bookmarks/bookmarksmanager.ui \
     bookmarks/bookmarkswidget.ui \
     cookies/cookiemanager.ui \
-    downloads/downloaditem.ui \
     downloads/downloadmanager.ui \
     downloads/downloadoptionsdialog.ui \
     history/historymanager.ui \
@@ -37,6 +37,11 @@ LocationCompleterRefreshJob::LocationCompleterRefreshJob(const QString &searchSt
     , m_searchString(searchString)
     , m_jobCancelled(false)
 {
+    // History is not thread-safe, take most visited entries from memory before starting
+    if (m_searchString.isEmpty()) {
+        m_mostVisited = mApp->history()->mostVisited(15);
+    }
+
     m_watcher = new QFutureWatcher<void>(this);
     connect(m_watcher, SIGNAL(finished()), this, SLOT(slotFinished()));
 
@@ -208,17 +213,13 @@ void LocationCompleterRefreshJob::completeFromHistory()
 
 void LocationCompleterRefreshJob::completeMostVisited()
 {
-    QSqlQuery query(SqlDatabase::instance()->database());
-    query.exec(QSL("SELECT id, url, title FROM history ORDER BY count DESC LIMIT 15"));
-
-    while (query.next()) {
+    foreach (const HistoryEntry &entry, m_mostVisited) {
         QStandardItem* item = new QStandardItem();
-        const QUrl url = query.value(1).toUrl();
 
-        item->setText(url.toEncoded());
-        item->setData(query.value(0), LocationCompleterModel::IdRole);
-        item->setData(query.value(2), LocationCompleterModel::TitleRole);
-        item->setData(url, LocationCompleterModel::UrlRole);
+        item->setText(entry.urlString);
+        item->setData(entry.id, LocationCompleterModel::IdRole);
+        item->setData(entry.title, LocationCompleterModel::TitleRole);
+        item->setData(entry.url, LocationCompleterModel::UrlRole);
         item->setData(true, LocationCompleterModel::HistoryRole);
 
         m_items.append(item);
@@ -21,6 +21,7 @@
 #include <QFutureWatcher>
 
 #include "qzcommon.h"
+#include "history.h"
 
 class QStandardItem;
 
@@ -64,6 +65,7 @@ private:
     QString m_searchString;
     QString m_domainCompletion;
     QList<QStandardItem*> m_items;
+    QVector<HistoryEntry> m_mostVisited;
     QFutureWatcher<void>* m_watcher;
     bool m_jobCancelled;
 };
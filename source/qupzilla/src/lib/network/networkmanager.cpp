@@ -25,6 +25,7 @@
 #include "passwordmanager.h"
 #include "sslerrordialog.h"
 #include "networkurlinterceptor.h"
+#include "networkproxyfactory.h"
 #include "schemehandlers/qupzillaschemehandler.h"
 #include "schemehandlers/extensionschemehandler.h"
 
@@ -55,6 +56,11 @@ NetworkManager::NetworkManager(QObject *parent)
     // Create cookie jar
     mApp->cookieJar();
 
+    // Proxy exceptions and PAC are only used by requests of this manager,
+    // QtWebEngine only reads application proxy set in loadSettings()
+    m_proxyFactory = new NetworkProxyFactory();
+    setProxyFactory(m_proxyFactory);
+
     connect(this, &QNetworkAccessManager::authenticationRequired, this, [this](QNetworkReply *reply, QAuthenticator *auth) {
         authentication(reply->url(), auth);
     });
@@ -266,7 +272,8 @@ void NetworkManager::loadSettings()
         proxy.setType(QNetworkProxy::Socks5Proxy);
     }
 
-    if (proxyType == 2) {
+    // Web content can't use PAC script, it falls back to system configuration
+    if (proxyType == 2 || proxyType == 5) {
         QNetworkProxy::setApplicationProxy(QNetworkProxy());
         QNetworkProxyFactory::setUseSystemConfiguration(true);
     } else {
@@ -274,6 +281,8 @@ void NetworkManager::loadSettings()
         QNetworkProxyFactory::setUseSystemConfiguration(false);
     }
 
+    m_proxyFactory->loadSettings();
+
     m_urlInterceptor->loadSettings();
 }
 
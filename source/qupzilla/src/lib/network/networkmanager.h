@@ -27,6 +27,7 @@ class UrlInterceptor;
 class NetworkUrlInterceptor;
 class ExtensionSchemeManager;
 class ExtensionSchemeHandler;
+class NetworkProxyFactory;
 
 class QUPZILLA_EXPORT NetworkManager : public QNetworkAccessManager
 {
@@ -54,6 +55,7 @@ protected:
 private:
     NetworkUrlInterceptor *m_urlInterceptor;
     ExtensionSchemeManager *m_extensionScheme;
+    NetworkProxyFactory *m_proxyFactory;
     QHash<QString, QWebEngineCertificateError::Error> m_ignoredSslErrors;
 };
 
@@ -17,46 +17,69 @@
 * ============================================================ */
 #include "networkproxyfactory.h"
 #include "mainapplication.h"
+#include "pacrunner.h"
 #include "settings.h"
+#include "qztools.h"
 
-WildcardMatcher::WildcardMatcher(const QString &pattern)
-    : m_regExp(0)
-{
-    setPattern(pattern);
-}
+#include <QThread>
+#include <QUrl>
 
-WildcardMatcher::~WildcardMatcher()
-{
-    delete m_regExp;
-}
+static const int s_cacheSize = 256;
+// Longest time a request waits for PAC script, DIRECT is used after that
+static const int s_pacTimeout = 3000;
 
-void WildcardMatcher::setPattern(const QString &pattern)
+void ProxyExceptions::setPatterns(const QStringList &patterns)
 {
-    m_pattern = pattern;
+    m_hosts.clear();
+    m_hasWildcards = false;
+
+    QStringList wildcards;
 
-    if (m_pattern.contains(QLatin1Char('?')) || m_pattern.contains(QLatin1Char('*'))) {
-        QString regexp = m_pattern;
-        regexp.replace(QLatin1Char('.'), QLatin1String("\\."))
-        .replace(QLatin1Char('*'), QLatin1String(".*"))
-        .replace(QLatin1Char('?'), QLatin1Char('.'));
-        regexp = QString("^.*%1.*$").arg(regexp);
+    foreach (QString pattern, patterns) {
+        pattern = pattern.trimmed().toLower();
+        if (pattern.isEmpty()) {
+            continue;
+        }
 
-        m_regExp = new QzRegExp(regexp, Qt::CaseInsensitive);
+        if (pattern.contains(QLatin1Char('?')) || pattern.contains(QLatin1Char('*'))) {
+            QString regexp = QzRegExp::escape(pattern);
+            regexp.replace(QLatin1String("\\*"), QLatin1String(".*"))
+            .replace(QLatin1String("\\?"), QLatin1String("."));
+            wildcards.append(regexp);
+        }
+        else {
+            if (pattern.startsWith(QLatin1Char('.'))) {
+                pattern = pattern.mid(1);
+            }
+            m_hosts.insert(pattern);
+        }
     }
-}
 
-QString WildcardMatcher::pattern() const
-{
-    return m_pattern;
+    if (!wildcards.isEmpty()) {
+        m_wildcards = QzRegExp(QString("^.*(?:%1).*$").arg(wildcards.join(QLatin1Char('|'))), Qt::CaseInsensitive);
+        m_hasWildcards = true;
+    }
 }
 
-bool WildcardMatcher::match(const QString &str) const
+bool ProxyExceptions::match(const QString &host) const
 {
-    if (!m_regExp) {
-        return str.contains(m_pattern, Qt::CaseInsensitive);
+    if (!m_hosts.isEmpty()) {
+        const QString h = host.toLower();
+
+        if (m_hosts.contains(h)) {
+            return true;
+        }
+
+        int dot = h.indexOf(QLatin1Char('.'));
+        while (dot != -1) {
+            if (m_hosts.contains(h.mid(dot + 1))) {
+                return true;
+            }
+            dot = h.indexOf(QLatin1Char('.'), dot + 1);
+        }
     }
 
-    return m_regExp->indexIn(str) > -1;
+    return m_hasWildcards && m_wildcards.match(host).hasMatch();
 }
 
 NetworkProxyFactory::NetworkProxyFactory()
@@ -66,15 +89,19 @@ NetworkProxyFactory::NetworkProxyFactory()
     , m_port(0)
     , m_httpsPort(0)
     , m_useDifferentProxyForHttps(false)
+    , m_pacThread(0)
+    , m_pacRunner(0)
+    , m_cache(s_cacheSize)
 {
 }
 
 void NetworkProxyFactory::loadSettings()
 {
+    QMutexLocker locker(&m_cacheMutex);
+
     Settings settings;
     settings.beginGroup("Web-Proxy");
-    m_proxyPreference = ProxyPreference(settings.value("UseProxy", SystemProxy).toInt());
-    m_proxyType = QNetworkProxy::ProxyType(settings.value("ProxyType", QNetworkProxy::NoProxy).toInt());
+    const int proxyType = settings.value("ProxyType", 2).toInt();
     m_useDifferentProxyForHttps = settings.value("UseDifferentProxyForHttps", false).toBool();
 
     m_hostName = settings.value("HostName", QString()).toString();
@@ -87,14 +114,49 @@ void NetworkProxyFactory::loadSettings()
     m_httpsUsername = settings.value("HttpsUsername", QString()).toString();
     m_httpsPassword = settings.value("HttpsPassword", QString()).toString();
 
+    const QString pacUrl = settings.value("PacUrl", QString()).toString();
+
     QStringList exceptions = settings.value("ProxyExceptions", QStringList() << "localhost" << "127.0.0.1").toStringList();
     settings.endGroup();
 
-    qDeleteAll(m_proxyExceptions);
-    m_proxyExceptions.clear();
+    // Same values as written by Preferences
+    m_proxyType = QNetworkProxy::NoProxy;
 
-    foreach (const QString &exception, exceptions) {
-        m_proxyExceptions.append(new WildcardMatcher(exception.trimmed()));
+    switch (proxyType) {
+    case 0:
+        m_proxyPreference = NoProxy;
+        break;
+
+    case 3:
+        m_proxyPreference = DefinedProxy;
+        m_proxyType = QNetworkProxy::HttpProxy;
+        break;
+
+    case 4:
+        m_proxyPreference = DefinedProxy;
+        m_proxyType = QNetworkProxy::Socks5Proxy;
+        break;
+
+    case 5:
+        m_proxyPreference = ProxyAutoConfig;
+        break;
+
+    default:
+        m_proxyPreference = SystemProxy;
+        break;
+    }
+
+    m_proxyExceptions.setPatterns(exceptions);
+    m_cache.clear();
+
+    const bool usePac = m_proxyPreference == ProxyAutoConfig;
+    locker.unlock();
+
+    if (usePac) {
+        startPacRunner(pacUrl);
+    }
+    else {
+        stopPacRunner();
     }
 }
 
@@ -105,30 +167,61 @@ NetworkProxyFactory::ProxyPreference NetworkProxyFactory::proxyPreference() cons
 
 QList<QNetworkProxy> NetworkProxyFactory::queryProxy(const QNetworkProxyQuery &query)
 {
-    QList<QNetworkProxy> proxyList;
+    QMutexLocker locker(&m_cacheMutex);
 
     if (m_proxyPreference == NoProxy) {
-        proxyList.append(QNetworkProxy::NoProxy);
-        return proxyList;
+        return QList<QNetworkProxy>() << QNetworkProxy::NoProxy;
     }
 
-    const QString urlHost = query.url().host();
-    foreach (WildcardMatcher* m, m_proxyExceptions) {
-        if (m->match(urlHost)) {
-            proxyList.append(QNetworkProxy::NoProxy);
-            return proxyList;
-        }
+    if (m_proxyExceptions.match(query.url().host())) {
+        return QList<QNetworkProxy>() << QNetworkProxy::NoProxy;
+    }
+
+    // PAC script gets the full url and may resolve hosts, don't block other lookups on it
+    if (m_proxyPreference == ProxyAutoConfig) {
+        locker.unlock();
+        return queryPacRunner(query);
+    }
+
+    const QString key = query.protocolTag() + QLatin1String("://") + query.url().host();
+
+    if (QList<QNetworkProxy>* cached = m_cache.object(key)) {
+        return *cached;
     }
 
+    const QList<QNetworkProxy> proxyList = createProxyList(query);
+    m_cache.insert(key, new QList<QNetworkProxy>(proxyList));
+    return proxyList;
+}
+
+QList<QNetworkProxy> NetworkProxyFactory::queryPacRunner(const QNetworkProxyQuery &query)
+{
+    QString result;
+
+    m_pacLock.lockForRead();
+    if (m_pacRunner && !m_pacRunner->queryProxy(query.url(), s_pacTimeout, &result)) {
+        qWarning() << "NetworkProxyFactory: PAC script didn't answer in time, using DIRECT for" << query.url().host();
+    }
+    m_pacLock.unlock();
+
+    QList<QNetworkProxy> proxyList = PacRunner::parseProxies(result);
+
+    if (!proxyList.contains(QNetworkProxy::NoProxy)) {
+        proxyList.append(QNetworkProxy::NoProxy);
+    }
+
+    return proxyList;
+}
+
+QList<QNetworkProxy> NetworkProxyFactory::createProxyList(const QNetworkProxyQuery &query)
+{
+    QList<QNetworkProxy> proxyList;
+
     switch (m_proxyPreference) {
     case SystemProxy:
         proxyList.append(systemProxyForQuery(query));
         break;
 
-    case ProxyAutoConfig:
-        qWarning() << "PAC Not Implemented!";
-        break;
-
     case DefinedProxy: {
         QNetworkProxy proxy(m_proxyType);
 
@@ -165,7 +258,59 @@ QList<QNetworkProxy> NetworkProxyFactory::queryProxy(const QNetworkProxyQuery &q
     return proxyList;
 }
 
+void NetworkProxyFactory::startPacRunner(const QString &pacUrl)
+{
+    const QUrl url = QUrl::fromUserInput(pacUrl);
+    if (!url.isLocalFile()) {
+        qWarning() << "NetworkProxyFactory: Only local PAC files are supported" << pacUrl;
+        stopPacRunner();
+        return;
+    }
+
+    QWriteLocker locker(&m_pacLock);
+
+    // Always start new runner, the previous one may be stuck in a script that never returns
+    stopPacThread();
+
+    m_pacThread = new QThread;
+    m_pacThread->setObjectName(QSL("PacRunner"));
+    m_pacRunner = new PacRunner;
+    m_pacRunner->moveToThread(m_pacThread);
+    QObject::connect(m_pacThread, &QThread::finished, m_pacRunner, &QObject::deleteLater);
+    m_pacThread->start();
+
+    QMetaObject::invokeMethod(m_pacRunner, "setScript", Qt::QueuedConnection,
+                              Q_ARG(QString, QzTools::readAllFileContents(url.toLocalFile())));
+}
+
+void NetworkProxyFactory::stopPacRunner()
+{
+    QWriteLocker locker(&m_pacLock);
+    stopPacThread();
+}
+
+void NetworkProxyFactory::stopPacThread()
+{
+    if (!m_pacThread) {
+        return;
+    }
+
+    m_pacThread->quit();
+
+    if (m_pacThread->wait(s_pacTimeout)) {
+        delete m_pacThread;
+    }
+    else {
+        // Script can't be interrupted, leave the thread to finish on its own
+        qWarning() << "NetworkProxyFactory: PAC script doesn't respond, not waiting for it";
+        QObject::connect(m_pacThread, &QThread::finished, m_pacThread, &QObject::deleteLater);
+    }
+
+    m_pacThread = 0;
+    m_pacRunner = 0;
+}
+
 NetworkProxyFactory::~NetworkProxyFactory()
 {
-    qDeleteAll(m_proxyExceptions);
+    stopPacRunner();
 }
@@ -20,24 +20,31 @@
 
 #include <QNetworkProxyFactory>
 #include <QStringList>
+#include <QCache>
+#include <QMutex>
+#include <QReadWriteLock>
+#include <QSet>
 
 #include "qzcommon.h"
 #include "qzregexp.h"
 
-class WildcardMatcher
+class QThread;
+
+class PacRunner;
+
+class QUPZILLA_EXPORT ProxyExceptions
 {
 public:
-    explicit WildcardMatcher(const QString &pattern = QString());
-    ~WildcardMatcher();
-
-    void setPattern(const QString &pattern);
-    QString pattern() const;
+    void setPatterns(const QStringList &patterns);
 
-    bool match(const QString &str) const;
+    // Host matches when it equals a pattern or is a subdomain of it,
+    // only patterns with '*' or '?' wildcards need the regexp
+    bool match(const QString &host) const;
 
 private:
-    QString m_pattern;
-    QzRegExp* m_regExp;
+    QSet<QString> m_hosts;
+    QzRegExp m_wildcards;
+    bool m_hasWildcards = false;
 };
 
 class QUPZILLA_EXPORT NetworkProxyFactory : public QNetworkProxyFactory
@@ -55,6 +62,13 @@ public:
     QList<QNetworkProxy> queryProxy(const QNetworkProxyQuery &query = QNetworkProxyQuery());
 
 private:
+    QList<QNetworkProxy> createProxyList(const QNetworkProxyQuery &query);
+    QList<QNetworkProxy> queryPacRunner(const QNetworkProxyQuery &query);
+    void startPacRunner(const QString &pacUrl);
+    void stopPacRunner();
+    // Needs m_pacLock locked for writing
+    void stopPacThread();
+
     ProxyPreference m_proxyPreference;
     QNetworkProxy::ProxyType m_proxyType;
 
@@ -68,8 +82,17 @@ private:
     QString m_httpsUsername;
     QString m_httpsPassword;
 
-    QList<WildcardMatcher*> m_proxyExceptions;
+    ProxyExceptions m_proxyExceptions;
     bool m_useDifferentProxyForHttps;
+
+    // Write locked while PAC runner is started or stopped
+    QReadWriteLock m_pacLock;
+    QThread* m_pacThread;
+    PacRunner* m_pacRunner;
+
+    // Guards settings and decisions per scheme and host, PAC results are not cached
+    QMutex m_cacheMutex;
+    QCache<QString, QList<QNetworkProxy> > m_cache;
 };
 
 #endif // NETWORKPROXYFACTORY_H
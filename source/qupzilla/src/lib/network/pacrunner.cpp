@@ -0,0 +1,197 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "pacrunner.h"
+#include "qztools.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QJSEngine>
+#include <QThread>
+#include <QHostInfo>
+#include <QNetworkInterface>
+#include <QUrl>
+
+PacRunnerHelpers::PacRunnerHelpers(QObject* parent)
+    : QObject(parent)
+{
+}
+
+QString PacRunnerHelpers::dnsResolve(const QString &host) const
+{
+    const QHostInfo info = QHostInfo::fromName(host);
+
+    foreach (const QHostAddress &address, info.addresses()) {
+        if (address.protocol() == QAbstractSocket::IPv4Protocol) {
+            return address.toString();
+        }
+    }
+
+    return QString();
+}
+
+QString PacRunnerHelpers::myIpAddress() const
+{
+    foreach (const QHostAddress &address, QNetworkInterface::allAddresses()) {
+        if (address.protocol() == QAbstractSocket::IPv4Protocol && !address.isLoopback()) {
+            return address.toString();
+        }
+    }
+
+    return QSL("127.0.0.1");
+}
+
+PacRunner::PacRunner(QObject* parent)
+    : QObject(parent)
+    , m_engine(0)
+    , m_nextQueryId(0)
+    , m_busySince(0)
+{
+}
+
+void PacRunner::setScript(const QString &script)
+{
+    setBusy(true);
+
+    // Fresh engine for every script, nothing but the PAC helpers is exposed to it
+    delete m_engine;
+    m_engine = new QJSEngine(this);
+    m_engine->globalObject().setProperty(QSL("_qz_pac"), m_engine->newQObject(new PacRunnerHelpers(m_engine)));
+
+    m_engine->evaluate(QzTools::readAllFileContents(QSL(":data/pac.js")));
+
+    const QJSValue result = m_engine->evaluate(script);
+    if (result.isError()) {
+        qWarning() << "PacRunner: Error evaluating PAC script" << result.toString();
+    }
+
+    m_findProxy = m_engine->globalObject().property(QSL("FindProxyForURL"));
+    if (!m_findProxy.isCallable()) {
+        qWarning() << "PacRunner: PAC script doesn't define FindProxyForURL function";
+    }
+
+    setBusy(false);
+}
+
+QString PacRunner::findProxyForUrl(const QUrl &url)
+{
+    if (!m_findProxy.isCallable()) {
+        return QString();
+    }
+
+    const QJSValue result = m_findProxy.call(QJSValueList() << url.toString() << url.host());
+    if (result.isError()) {
+        qWarning() << "PacRunner: Error in FindProxyForURL" << result.toString();
+        return QString();
+    }
+
+    return result.toString();
+}
+
+bool PacRunner::queryProxy(const QUrl &url, int timeout, QString* result)
+{
+    Q_ASSERT(thread() != QThread::currentThread());
+
+    QMutexLocker locker(&m_queryMutex);
+
+    // QJSEngine can't be interrupted in Qt 5.9, don't queue behind a script that hangs
+    if (m_busySince && QDateTime::currentMSecsSinceEpoch() - m_busySince > timeout) {
+        return false;
+    }
+
+    const int id = m_nextQueryId++;
+    QMetaObject::invokeMethod(this, "runQuery", Qt::QueuedConnection, Q_ARG(int, id), Q_ARG(QUrl, url));
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    while (!m_results.contains(id)) {
+        const qint64 remaining = timeout - elapsed.elapsed();
+        if (remaining <= 0 || !m_queryFinished.wait(&m_queryMutex, remaining)) {
+            // Late result is dropped in runQuery
+            m_results.insert(id, QString());
+            return false;
+        }
+    }
+
+    *result = m_results.take(id);
+    return true;
+}
+
+void PacRunner::runQuery(int id, const QUrl &url)
+{
+    setBusy(true);
+    const QString result = findProxyForUrl(url);
+    setBusy(false);
+
+    QMutexLocker locker(&m_queryMutex);
+
+    // Query already timed out
+    if (m_results.contains(id)) {
+        m_results.remove(id);
+        return;
+    }
+
+    m_results.insert(id, result);
+    m_queryFinished.wakeAll();
+}
+
+void PacRunner::setBusy(bool busy)
+{
+    QMutexLocker locker(&m_queryMutex);
+    m_busySince = busy ? QDateTime::currentMSecsSinceEpoch() : 0;
+}
+
+// static
+QList<QNetworkProxy> PacRunner::parseProxies(const QString &result)
+{
+    QList<QNetworkProxy> proxies;
+
+    foreach (const QString &entry, result.split(QL1C(';'), QString::SkipEmptyParts)) {
+        const QStringList parts = entry.simplified().split(QL1C(' '));
+        const QString type = parts.at(0).toUpper();
+
+        if (type == QL1S("DIRECT")) {
+            proxies.append(QNetworkProxy::NoProxy);
+            continue;
+        }
+
+        if (parts.size() < 2) {
+            continue;
+        }
+
+        QNetworkProxy::ProxyType proxyType;
+        if (type == QL1S("PROXY") || type == QL1S("HTTP") || type == QL1S("HTTPS")) {
+            proxyType = QNetworkProxy::HttpProxy;
+        }
+        else if (type == QL1S("SOCKS") || type == QL1S("SOCKS5")) {
+            proxyType = QNetworkProxy::Socks5Proxy;
+        }
+        else {
+            continue;
+        }
+
+        const QUrl hostPort = QUrl::fromUserInput(parts.at(1));
+        if (hostPort.host().isEmpty()) {
+            continue;
+        }
+
+        proxies.append(QNetworkProxy(proxyType, hostPort.host(), hostPort.port(8080)));
+    }
+
+    return proxies;
+}
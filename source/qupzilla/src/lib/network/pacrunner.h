@@ -0,0 +1,79 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef PACRUNNER_H
+#define PACRUNNER_H
+
+#include <QObject>
+#include <QHash>
+#include <QJSValue>
+#include <QMutex>
+#include <QNetworkProxy>
+#include <QWaitCondition>
+
+#include "qzcommon.h"
+
+class QJSEngine;
+
+// Native helpers exposed to PAC scripts
+class PacRunnerHelpers : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PacRunnerHelpers(QObject* parent = 0);
+
+    Q_INVOKABLE QString dnsResolve(const QString &host) const;
+    Q_INVOKABLE QString myIpAddress() const;
+};
+
+// Evaluates proxy auto-config scripts, lives in NetworkProxyFactory worker thread
+class QUPZILLA_EXPORT PacRunner : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PacRunner(QObject* parent = 0);
+
+    Q_INVOKABLE void setScript(const QString &script);
+    Q_INVOKABLE QString findProxyForUrl(const QUrl &url);
+
+    // Called from other threads, waits at most timeout ms for the script.
+    // Returns false when the script didn't answer in time or is still busy
+    // with a call that already timed out.
+    bool queryProxy(const QUrl &url, int timeout, QString* result);
+
+    static QList<QNetworkProxy> parseProxies(const QString &result);
+
+private:
+    Q_INVOKABLE void runQuery(int id, const QUrl &url);
+
+    void setBusy(bool busy);
+
+    QJSEngine* m_engine;
+    QJSValue m_findProxy;
+
+    // Guards the query state below, shared with querying threads
+    QMutex m_queryMutex;
+    QWaitCondition m_queryFinished;
+    QHash<int, QString> m_results;
+    int m_nextQueryId;
+    // Time the current evaluation started, 0 when idle
+    qint64 m_busySince;
+};
+
+#endif // PACRUNNER_H
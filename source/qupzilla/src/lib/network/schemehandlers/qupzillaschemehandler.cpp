@@ -42,6 +42,7 @@ static QString authorString(const char* name, const QString &mail)
 
 QupZillaSchemeHandler::QupZillaSchemeHandler(QObject *parent)
     : QWebEngineUrlSchemeHandler(parent)
+    , m_thumbnailCache(4 * 1024 * 1024)
 {
 }
 
@@ -51,6 +52,11 @@ void QupZillaSchemeHandler::requestStarted(QWebEngineUrlRequestJob *job)
         return;
     }
 
+    if (job->requestUrl().path().startsWith(QL1S("thumbnail/"))) {
+        handleThumbnailRequest(job);
+        return;
+    }
+
     QStringList knownPages;
     knownPages << "about" << "reportbug" << "start" << "speeddial" << "config" << "restore" << "reader";
 
@@ -79,6 +85,36 @@ bool QupZillaSchemeHandler::handleRequest(QWebEngineUrlRequestJob *job)
     return false;
 }
 
+void QupZillaSchemeHandler::handleThumbnailRequest(QWebEngineUrlRequestJob *job)
+{
+    // Thumbnail urls carry file modification time in query, so the whole url
+    // is a valid cache key and changed thumbnails are never served stale
+    const QString key = job->requestUrl().toString();
+    QByteArray data;
+
+    if (QByteArray* cached = m_thumbnailCache.object(key)) {
+        data = *cached;
+    }
+    else {
+        const QString hash = job->requestUrl().path().mid(10);
+        const QString fileName = mApp->plugins()->speedDial()->thumbnailPath(hash);
+
+        QFile file(fileName);
+        if (fileName.isEmpty() || !file.open(QFile::ReadOnly)) {
+            job->fail(QWebEngineUrlRequestJob::UrlNotFound);
+            return;
+        }
+
+        data = file.readAll();
+        m_thumbnailCache.insert(key, new QByteArray(data), data.size());
+    }
+
+    QBuffer* buffer = new QBuffer(job);
+    buffer->setData(data);
+    buffer->open(QIODevice::ReadOnly);
+    job->reply(QByteArrayLiteral("image/png"), buffer);
+}
+
 QupZillaSchemeReply::QupZillaSchemeReply(QWebEngineUrlRequestJob *job, QObject *parent)
     : QIODevice(parent)
     , m_loaded(false)
@@ -520,7 +556,38 @@ QString QupZillaSchemeReply::configPage()
 
 QString QupZillaSchemeReply::readerPage()
 {
-    QString page = QzTools::readAllFileContents(QSL(":readingmode/reader.html"));
+    // Page shell with theme CSS and translations, rebuilt only when the theme changes
+    static QString rShell;
+    static QString rShellTheme;
+
+    Settings settings;
+    settings.beginGroup(QSL("Themes"));
+    QString activeTheme = settings.value(QSL("activeTheme"), QSL("linux")).toString();
+    settings.endGroup();
+
+    if (rShell.isEmpty() || rShellTheme != activeTheme) {
+        QString themeCss;
+        const QStringList themePaths = DataPaths::allPaths(DataPaths::Themes);
+        for (const QString &path : themePaths) {
+            const QString cssPath = QString(QSL("%1/%2/readingmode.css")).arg(path, activeTheme);
+            if (QFile::exists(cssPath)) {
+                themeCss = QzTools::readAllFileContents(cssPath);
+                break;
+            }
+        }
+
+        rShell = QzTools::readAllFileContents(QSL(":readingmode/reader.html"));
+        rShell.replace(QLatin1String("%THEME-CSS%"), themeCss);
+        rShell.replace(QLatin1String("%TITLE%"), tr("Reading Mode"));
+        rShell.replace(QLatin1String("%BACK-LABEL%"), tr("Back to page"));
+        rShell.replace(QLatin1String("%LOADING%"), tr("Loading"));
+        rShell.replace(QLatin1String("%ERROR-MSG%"), tr("Could not load article content."));
+        rShell.replace(QLatin1String("%SOURCE-LABEL%"), tr("Source"));
+        rShell = QzTools::applyDirectionToPage(rShell);
+        rShellTheme = activeTheme;
+    }
+
+    QString page = rShell;
 
     // Parse the original URL from query string
     QUrlQuery query(m_job->requestUrl());
@@ -533,28 +600,6 @@ QString QupZillaSchemeReply::readerPage()
     // Get cached article content
     ReadingModeArticle article = ReadingModeManager::instance()->getCachedArticle(originalUrl);
 
-    // Load theme CSS for reading mode
-    Settings settings;
-    settings.beginGroup(QSL("Themes"));
-    QString activeTheme = settings.value(QSL("activeTheme"), QSL("linux")).toString();
-    settings.endGroup();
-
-    QString themeCss;
-    const QStringList themePaths = DataPaths::allPaths(DataPaths::Themes);
-    for (const QString &path : themePaths) {
-        const QString cssPath = QString(QSL("%1/%2/readingmode.css")).arg(path, activeTheme);
-        if (QFile::exists(cssPath)) {
-            themeCss = QzTools::readAllFileContents(cssPath);
-            break;
-        }
-    }
-
-    page.replace(QLatin1String("%THEME-CSS%"), themeCss);
-    page.replace(QLatin1String("%TITLE%"), tr("Reading Mode"));
-    page.replace(QLatin1String("%BACK-LABEL%"), tr("Back to page"));
-    page.replace(QLatin1String("%LOADING%"), tr("Loading"));
-    page.replace(QLatin1String("%ERROR-MSG%"), tr("Could not load article content."));
-    page.replace(QLatin1String("%SOURCE-LABEL%"), tr("Source"));
     page.replace(QLatin1String("%ORIGINAL-URL%"), originalUrl.toString().toHtmlEscaped());
     page.replace(QLatin1String("%ORIGINAL-URL-ENCODED%"), QString::fromUtf8(QUrl::toPercentEncoding(originalUrl.toString())));
 
@@ -597,5 +642,5 @@ QString QupZillaSchemeReply::readerPage()
         page.replace(QLatin1String("</body>"), errorScript + QLatin1String("</body>"));
     }
 
-    return QzTools::applyDirectionToPage(page);
+    return page;
 }
@@ -19,6 +19,7 @@
 #define QUPZILLASCHEMEHANDLER_H
 
 #include <QBuffer>
+#include <QCache>
 #include <QIODevice>
 #include <QWebEngineUrlSchemeHandler>
 
@@ -33,6 +34,9 @@ public:
 
 private:
     bool handleRequest(QWebEngineUrlRequestJob *job);
+    void handleThumbnailRequest(QWebEngineUrlRequestJob *job);
+
+    QCache<QString, QByteArray> m_thumbnailCache;
 };
 
 class QUPZILLA_EXPORT QupZillaSchemeReply : public QIODevice
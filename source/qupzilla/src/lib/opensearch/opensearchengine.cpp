@@ -45,6 +45,8 @@
 #include <qnetworkreply.h>
 #include <qregexp.h>
 #include <qstringlist.h>
+#include <qtimer.h>
+#include <qcache.h>
 
 #include <QUrlQuery>
 #include <QJsonDocument>
@@ -97,6 +99,27 @@
     \sa OpenSearchReader, OpenSearchWriter
 */
 
+// Typing bursts shorter than this only result in one suggestions request
+static const int s_suggestionsDelay = 150;
+// Stalled reply would otherwise block all further requests of the engine
+static const int s_suggestionsReplyTimeout = 3000;
+static const int s_suggestionsCacheSize = 64;
+
+struct SuggestionsCache
+{
+    ~SuggestionsCache()
+    {
+        qDeleteAll(engines);
+    }
+
+    // Suggestions per engine, keyed by normalized search term
+    QHash<QString, QCache<QString, QStringList>*> engines;
+    quint64 hits = 0;
+    quint64 misses = 0;
+};
+
+Q_GLOBAL_STATIC(SuggestionsCache, qz_suggestions_cache)
+
 /*!
     Constructs an engine with a given \a parent.
 */
@@ -106,10 +129,20 @@ OpenSearchEngine::OpenSearchEngine(QObject* parent)
     , m_suggestionsMethod(QLatin1String("get"))
     , m_networkAccessManager(0)
     , m_suggestionsReply(0)
+    , m_suggestionsTimer(new QTimer(this))
+    , m_suggestionsReplyTimer(new QTimer(this))
     , m_delegate(0)
 {
     m_requestMethods.insert(QLatin1String("get"), QNetworkAccessManager::GetOperation);
     m_requestMethods.insert(QLatin1String("post"), QNetworkAccessManager::PostOperation);
+
+    m_suggestionsTimer->setSingleShot(true);
+    m_suggestionsTimer->setInterval(s_suggestionsDelay);
+    connect(m_suggestionsTimer, SIGNAL(timeout()), this, SLOT(sendSuggestionsRequest()));
+
+    m_suggestionsReplyTimer->setSingleShot(true);
+    m_suggestionsReplyTimer->setInterval(s_suggestionsReplyTimeout);
+    connect(m_suggestionsReplyTimer, SIGNAL(timeout()), this, SLOT(suggestionsReplyTimeout()));
 }
 
 /*!
@@ -561,16 +594,60 @@ void OpenSearchEngine::requestSuggestions(const QString &searchTerm)
         return;
     }
 
-    if (m_suggestionsReply) {
-        m_suggestionsReply->disconnect(this);
-        m_suggestionsReply->abort();
-        m_suggestionsReply->deleteLater();
-        m_suggestionsReply = 0;
+    m_suggestionsTerm = searchTerm;
+
+    SuggestionsCache* cache = qz_suggestions_cache();
+    QCache<QString, QStringList>* engineCache = cache->engines.value(suggestionsCacheKey());
+    const QString term = normalizedSearchTerm(searchTerm);
+
+    if (engineCache && engineCache->contains(term)) {
+        cache->hits++;
+        m_suggestionsTimer->stop();
+        emit suggestions(*engineCache->object(term));
+        return;
+    }
+
+    // Show results of the longest cached prefix until the real response arrives
+    if (engineCache) {
+        for (int length = term.length() - 1; length > 0; --length) {
+            const QStringList* list = engineCache->object(term.left(length));
+            if (!list) {
+                continue;
+            }
+
+            QStringList out;
+            foreach (const QString &suggestion, *list) {
+                if (suggestion.startsWith(term, Qt::CaseInsensitive)) {
+                    out.append(suggestion);
+                }
+            }
+            if (!out.isEmpty()) {
+                emit suggestions(out);
+            }
+            break;
+        }
+    }
+
+    m_suggestionsTimer->start();
+}
+
+void OpenSearchEngine::sendSuggestionsRequest()
+{
+    // Only one request is in flight at a time, the pending term is requested
+    // once the current reply is finished
+    if (m_suggestionsReply || m_suggestionsTerm.isEmpty() || !m_networkAccessManager) {
+        return;
+    }
+
+    // Term may have been answered from the cache while a reply was in flight
+    const QCache<QString, QStringList>* engineCache = qz_suggestions_cache()->engines.value(suggestionsCacheKey());
+    if (engineCache && engineCache->contains(normalizedSearchTerm(m_suggestionsTerm))) {
+        return;
     }
 
     Q_ASSERT(m_requestMethods.contains(m_suggestionsMethod));
     if (m_suggestionsMethod == QLatin1String("get")) {
-        m_suggestionsReply = m_networkAccessManager->get(QNetworkRequest(suggestionsUrl(searchTerm)));
+        m_suggestionsReply = m_networkAccessManager->get(QNetworkRequest(suggestionsUrl(m_suggestionsTerm)));
     }
     else {
         QStringList parameters;
@@ -581,10 +658,23 @@ void OpenSearchEngine::requestSuggestions(const QString &searchTerm)
         }
 
         QByteArray data = parameters.join(QLatin1String("&")).toUtf8();
-        m_suggestionsReply = m_networkAccessManager->post(QNetworkRequest(suggestionsUrl(searchTerm)), data);
+        m_suggestionsReply = m_networkAccessManager->post(QNetworkRequest(suggestionsUrl(m_suggestionsTerm)), data);
     }
 
+    m_suggestionsReply->setProperty("searchTerm", m_suggestionsTerm);
+    m_suggestionsReply->setProperty("cacheKey", suggestionsCacheKey());
     connect(m_suggestionsReply, SIGNAL(finished()), this, SLOT(suggestionsObtained()));
+
+    m_suggestionsReplyTimer->start();
+    qz_suggestions_cache()->misses++;
+}
+
+void OpenSearchEngine::suggestionsReplyTimeout()
+{
+    // Finished signal sends request for the pending term, if any
+    if (m_suggestionsReply) {
+        m_suggestionsReply->abort();
+    }
 }
 
 /*!
@@ -626,16 +716,27 @@ void OpenSearchEngine::requestSearchResults(const QString &searchTerm)
 void OpenSearchEngine::suggestionsObtained()
 {
     const QByteArray response = m_suggestionsReply->readAll();
+    const QString searchTerm = m_suggestionsReply->property("searchTerm").toString();
+    const QString cacheKey = m_suggestionsReply->property("cacheKey").toString();
+    const bool success = m_suggestionsReply->error() == QNetworkReply::NoError;
 
     m_suggestionsReply->close();
     m_suggestionsReply->deleteLater();
     m_suggestionsReply = 0;
+    m_suggestionsReplyTimer->stop();
+
+    const bool current = cacheKey == suggestionsCacheKey() && normalizedSearchTerm(searchTerm) == normalizedSearchTerm(m_suggestionsTerm);
+
+    // The user kept typing while the request was in flight
+    if (!current && !m_suggestionsTimer->isActive()) {
+        sendSuggestionsRequest();
+    }
 
     QJsonParseError err;
     QJsonDocument json = QJsonDocument::fromJson(response, &err);
     const QVariant res = json.toVariant();
 
-    if (err.error != QJsonParseError::NoError || res.type() != QVariant::List)
+    if (!success || err.error != QJsonParseError::NoError || res.type() != QVariant::List)
         return;
 
     const QVariantList list = res.toList();
@@ -648,7 +749,59 @@ void OpenSearchEngine::suggestionsObtained()
     foreach (const QVariant &v, list.at(1).toList())
         out.append(v.toString());
 
-    emit suggestions(out);
+    SuggestionsCache* cache = qz_suggestions_cache();
+    QCache<QString, QStringList>* engineCache = cache->engines.value(cacheKey);
+    if (!engineCache) {
+        engineCache = new QCache<QString, QStringList>(s_suggestionsCacheSize);
+        cache->engines.insert(cacheKey, engineCache);
+    }
+    engineCache->insert(normalizedSearchTerm(searchTerm), new QStringList(out));
+
+    if (current)
+        emit suggestions(out);
+}
+
+QString OpenSearchEngine::suggestionsCacheKey() const
+{
+    if (!m_preparedSuggestionsUrl.isEmpty()) {
+        return m_preparedSuggestionsUrl + QLatin1Char('\n') + QString::fromUtf8(m_preparedSuggestionsParameters);
+    }
+
+    return m_suggestionsUrlTemplate + QLatin1Char('\n') + m_suggestionsMethod;
+}
+
+QString OpenSearchEngine::normalizedSearchTerm(const QString &searchTerm)
+{
+    return searchTerm.simplified().toLower();
+}
+
+/*!
+    Returns number of suggestion requests that were answered from the cache.
+
+    \sa suggestionsCacheMisses()
+*/
+quint64 OpenSearchEngine::suggestionsCacheHits()
+{
+    return qz_suggestions_cache()->hits;
+}
+
+/*!
+    Returns number of network requests sent for suggestions that were not cached.
+
+    \sa suggestionsCacheHits()
+*/
+quint64 OpenSearchEngine::suggestionsCacheMisses()
+{
+    return qz_suggestions_cache()->misses;
+}
+
+void OpenSearchEngine::clearSuggestionsCache()
+{
+    SuggestionsCache* cache = qz_suggestions_cache();
+    qDeleteAll(cache->engines);
+    cache->engines.clear();
+    cache->hits = 0;
+    cache->misses = 0;
 }
 
 /*!
@@ -47,6 +47,7 @@
 #include <qurl.h>
 
 class QNetworkReply;
+class QTimer;
 
 class OpenSearchEngineDelegate;
 class QUPZILLA_EXPORT OpenSearchEngine : public QObject
@@ -129,6 +130,10 @@ public:
     bool operator==(const OpenSearchEngine &other) const;
     bool operator<(const OpenSearchEngine &other) const;
 
+    static quint64 suggestionsCacheHits();
+    static quint64 suggestionsCacheMisses();
+    static void clearSuggestionsCache();
+
 public slots:
     void requestSuggestions(const QString &searchTerm);
     void requestSearchResults(const QString &searchTerm);
@@ -139,9 +144,14 @@ protected:
 
 private slots:
     void imageObtained();
+    void sendSuggestionsRequest();
     void suggestionsObtained();
+    void suggestionsReplyTimeout();
 
 private:
+    QString suggestionsCacheKey() const;
+    static QString normalizedSearchTerm(const QString &searchTerm);
+
     QString m_name;
     QString m_description;
 
@@ -162,6 +172,9 @@ private:
 
     QNetworkAccessManager* m_networkAccessManager;
     QNetworkReply* m_suggestionsReply;
+    QString m_suggestionsTerm;
+    QTimer* m_suggestionsTimer;
+    QTimer* m_suggestionsReplyTimer;
 
     OpenSearchEngineDelegate* m_delegate;
 };
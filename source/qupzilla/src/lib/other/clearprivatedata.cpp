@@ -27,8 +27,11 @@
 #include "ui_clearprivatedata.h"
 #include "iconprovider.h"
 #include "qztools.h"
+#include "databasemaintenance.h"
 #include "cookiemanager.h"
 #include "desktopnotificationsfactory.h"
+#include "readingmodemanager.h"
+#include "opensearchengine.h"
 
 #include <QNetworkCookie>
 #include <QMessageBox>
@@ -67,24 +70,24 @@ void ClearPrivateData::clearLocalStorage()
 {
     const QString profile = DataPaths::currentProfilePath();
 
-    QzTools::removeDir(profile + "/Local Storage");
+    DatabaseMaintenance::instance()->removeDirectories(QStringList() << profile + "/Local Storage");
 }
 
 void ClearPrivateData::clearWebDatabases()
 {
     const QString profile = DataPaths::currentProfilePath();
 
-    QzTools::removeDir(profile + "/IndexedDB");
-    QzTools::removeDir(profile + "/databases");
+    DatabaseMaintenance::instance()->removeDirectories(QStringList() << profile + "/IndexedDB" << profile + "/databases");
 }
 
 void ClearPrivateData::clearCache()
 {
     const QString profile = DataPaths::currentProfilePath();
 
-    QzTools::removeDir(profile + "/GPUCache");
+    DatabaseMaintenance::instance()->removeDirectories(QStringList() << profile + "/GPUCache");
 
     mApp->webProfile()->clearHttpCache();
+    ReadingModeManager::instance()->clearCache();
 }
 
 void ClearPrivateData::closeEvent(QCloseEvent* e)
@@ -130,6 +133,9 @@ void ClearPrivateData::dialogAccepted()
             const QList<int> &indexes = mApp->history()->indexesFromTimeRange(start, end);
             mApp->history()->deleteHistoryEntry(indexes);
         }
+
+        // Cached suggestions would reveal recently typed search terms
+        OpenSearchEngine::clearSuggestionsCache();
     }
 
     if (ui->cookies->isChecked()) {
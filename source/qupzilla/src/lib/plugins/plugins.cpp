@@ -21,6 +21,7 @@
 #include "speeddial.h"
 #include "settings.h"
 #include "datapaths.h"
+#include "tracerecorder.h"
 #include "adblock/adblockplugin.h"
 
 #include <iostream>
@@ -108,6 +109,8 @@ void Plugins::shutdown()
 
 void Plugins::loadPlugins()
 {
+    TraceScope trace("Plugins::loadPlugins", "startup");
+
     QDir settingsDir(DataPaths::currentProfilePath() + "/extensions/");
     if (!settingsDir.exists()) {
         settingsDir.mkdir(settingsDir.absolutePath());
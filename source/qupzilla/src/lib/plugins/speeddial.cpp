@@ -21,20 +21,35 @@
 #include "datapaths.h"
 #include "qztools.h"
 #include "autosaver.h"
+#include "mainapplication.h"
+#include "webview.h"
 
 #include <QDir>
+#include <QDateTime>
+#include <QFileInfo>
 #include <QCryptographicHash>
 #include <QFileDialog>
 #include <QWebEnginePage>
 #include <QImage>
+#include <QSaveFile>
+#include <QTimer>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentRun>
 
 #define ENSURE_LOADED if (!m_loaded) loadSettings();
 
+// Minimum time between two captures of the same page and between any two captures
+static const qint64 s_pageCaptureInterval = 30 * 60 * 1000;
+static const qint64 s_captureInterval = 5 * 1000;
+// Time for page to paint after load finished
+static const int s_captureDelay = 1000;
+
 SpeedDial::SpeedDial(QObject* parent)
     : QObject(parent)
     , m_maxPagesInRow(4)
     , m_sizeOfSpeedDials(231)
     , m_sdcentered(false)
+    , m_lastCaptureTime(0)
     , m_loaded(false)
     , m_regenerateScript(true)
 {
@@ -124,6 +139,40 @@ QUrl SpeedDial::urlForShortcut(int key)
     return QUrl::fromEncoded(m_pages.at(key).url.toUtf8());
 }
 
+void SpeedDial::captureThumbnail(WebView* view)
+{
+    ENSURE_LOADED;
+
+    if (mApp->isPrivate() || !view) {
+        return;
+    }
+
+    const Page page = pageForUrl(view->url());
+    if (!page.isValid() || m_pendingCaptures.contains(page.url)) {
+        return;
+    }
+
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    if (now - m_lastCaptureTime < s_captureInterval) {
+        return;
+    }
+
+    if (m_lastCaptures.contains(page.url) && now - m_lastCaptures.value(page.url) < s_pageCaptureInterval) {
+        return;
+    }
+
+    m_lastCaptureTime = now;
+    m_lastCaptures[page.url] = now;
+    m_pendingCaptures.insert(page.url);
+
+    const QString url = page.url;
+    QPointer<WebView> guard = view;
+
+    QTimer::singleShot(s_captureDelay, this, [=]() {
+        grabThumbnail(guard.data(), url);
+    });
+}
+
 void SpeedDial::addPage(const QUrl &url, const QString &title)
 {
     ENSURE_LOADED;
@@ -208,27 +257,57 @@ QString SpeedDial::initialScript()
     m_regenerateScript = false;
     m_initialScript.clear();
 
+    // Entries are cached per url, so editing one page does not stat
+    // the thumbnails of all the others
+    QHash<QString, BoxScript> boxScripts;
+
     foreach (const Page &page, m_pages) {
-        QString imgSource = m_thumbnailsDir + QCryptographicHash::hash(page.url.toUtf8(), QCryptographicHash::Md4).toHex() + ".png";
+        BoxScript box = m_boxScripts.value(page.url);
 
-        if (!QFile(imgSource).exists()) {
-            // Use static globe icon instead of spinner (thumbnails disabled on webOS)
-            imgSource = "qrc:icons/other/webpage.svg";
+        if (box.script.isEmpty() || box.title != page.title) {
+            QString imgSource = thumbnailUrl(page.url);
 
-            if (!page.isValid()) {
-                imgSource.clear();
+            if (imgSource.isEmpty()) {
+                // Use static globe icon instead of spinner, thumbnail will be captured
+                // from tab once the page is visited (headless thumbnailer disabled on webOS)
+                imgSource = "qrc:icons/other/webpage.svg";
+
+                if (!page.isValid()) {
+                    imgSource.clear();
+                }
             }
-        }
-        else {
-            imgSource = QzTools::pixmapToDataUrl(QPixmap(imgSource)).toString();
+
+            box.title = page.title;
+            box.script = QString("addBox('%1', '%2', '%3');\n").arg(page.url, page.title, imgSource);
         }
 
-        m_initialScript.append(QString("addBox('%1', '%2', '%3');\n").arg(page.url, page.title, imgSource));
+        boxScripts.insert(page.url, box);
+        m_initialScript.append(box.script);
     }
 
+    m_boxScripts = boxScripts;
+
     return m_initialScript;
 }
 
+QString SpeedDial::thumbnailPath(const QString &hash)
+{
+    ENSURE_LOADED;
+
+    // Only accept plain hex names so the request can't escape thumbnails directory
+    if (hash.isEmpty()) {
+        return QString();
+    }
+
+    foreach (const QChar &c, hash) {
+        if (!c.isDigit() && (c < QL1C('a') || c > QL1C('f'))) {
+            return QString();
+        }
+    }
+
+    return m_thumbnailsDir + hash + QL1S(".png");
+}
+
 void SpeedDial::changed(const QString &allPages)
 {
     if (allPages.isEmpty()) {
@@ -265,7 +344,8 @@ void SpeedDial::changed(const QString &allPages)
 void SpeedDial::loadThumbnail(const QString &url, bool loadTitle)
 {
 #ifdef PORTABLE_BUILD
-    // Disable thumbnail generation on webOS - QQuickWidget causes crashes
+    // Disable headless thumbnail generation on webOS - QQuickWidget causes crashes,
+    // thumbnails are only captured from already rendered tabs in captureThumbnail()
     Q_UNUSED(url)
     Q_UNUSED(loadTitle)
     return;
@@ -281,11 +361,14 @@ void SpeedDial::loadThumbnail(const QString &url, bool loadTitle)
 
 void SpeedDial::removeImageForUrl(const QString &url)
 {
-    QString fileName = m_thumbnailsDir + QCryptographicHash::hash(url.toUtf8(), QCryptographicHash::Md4).toHex() + ".png";
+    QString fileName = m_thumbnailsDir + thumbnailHash(url) + ".png";
 
     if (QFile(fileName).exists()) {
         QFile(fileName).remove();
     }
+
+    m_boxScripts.remove(url);
+    m_regenerateScript = true;
 }
 
 QStringList SpeedDial::getOpenFileName()
@@ -342,26 +425,28 @@ void SpeedDial::thumbnailCreated(const QPixmap &pixmap)
     bool loadTitle = thumbnailer->loadTitle();
     QString title = thumbnailer->title();
     QString url = thumbnailer->url().toString();
-    QString fileName = m_thumbnailsDir + QCryptographicHash::hash(url.toUtf8(), QCryptographicHash::Md4).toHex() + ".png";
+    QString fileName = m_thumbnailsDir + thumbnailHash(url) + ".png";
+    QString imgSource;
 
     if (pixmap.isNull()) {
-        fileName = ":/html/broken-page.svg";
+        imgSource = QSL("qrc:html/broken-page.svg");
         title = tr("Unable to load");
     }
     else {
         if (!pixmap.save(fileName, "PNG")) {
             qWarning() << "SpeedDial::thumbnailCreated Cannot save thumbnail to " << fileName;
         }
-        //fileName = QUrl::fromLocalFile(fileName).toString();
+        imgSource = thumbnailUrl(url);
     }
 
+    m_boxScripts.remove(url);
     m_regenerateScript = true;
     thumbnailer->deleteLater();
 
     if (loadTitle)
         emit pageTitleLoaded(url, title);
 
-    emit thumbnailLoaded(url, QzTools::pixmapToDataUrl(QPixmap(fileName)).toString());
+    emit thumbnailLoaded(url, imgSource);
 }
 
 QString SpeedDial::escapeTitle(QString title) const
@@ -389,3 +474,79 @@ QString SpeedDial::generateAllPages()
 
     return allPages;
 }
+
+QString SpeedDial::thumbnailHash(const QString &url) const
+{
+    return QString::fromLatin1(QCryptographicHash::hash(url.toUtf8(), QCryptographicHash::Md4).toHex());
+}
+
+QString SpeedDial::thumbnailUrl(const QString &url) const
+{
+    const QString hash = thumbnailHash(url);
+    const QFileInfo info(m_thumbnailsDir + hash + QL1S(".png"));
+
+    if (!info.exists()) {
+        return QString();
+    }
+
+    // Modification time in query makes the url change together with thumbnail,
+    // so the scheme handler can cache file contents by url
+    return QSL("qupzilla:thumbnail/%1?v=%2").arg(hash, QString::number(info.lastModified().toMSecsSinceEpoch()));
+}
+
+void SpeedDial::grabThumbnail(WebView* view, const QString &url)
+{
+    // Page must still be displayed in (visible) view, otherwise there is nothing to grab
+    if (!view || !view->isVisible() || view->isLoading() || pageForUrl(view->url()).url != url) {
+        m_pendingCaptures.remove(url);
+        m_lastCaptures.remove(url);
+        return;
+    }
+
+    const QImage image = view->grab().toImage();
+    if (image.isNull()) {
+        m_pendingCaptures.remove(url);
+        return;
+    }
+
+    // Scaling and PNG encoding is done in worker thread
+    const QSize size = QSize(450, 253) * view->devicePixelRatioF();
+    const QString fileName = m_thumbnailsDir + thumbnailHash(url) + QL1S(".png");
+
+    QFutureWatcher<bool>* watcher = new QFutureWatcher<bool>(this);
+    connect(watcher, &QFutureWatcher<bool>::finished, this, [=]() {
+        thumbnailSaved(url, watcher->result());
+        watcher->deleteLater();
+    });
+    watcher->setFuture(QtConcurrent::run(&SpeedDial::saveThumbnail, image, size, fileName));
+}
+
+void SpeedDial::thumbnailSaved(const QString &url, bool ok)
+{
+    m_pendingCaptures.remove(url);
+
+    if (!ok) {
+        qWarning() << "SpeedDial::thumbnailSaved Cannot save thumbnail for" << url;
+        return;
+    }
+
+    m_boxScripts.remove(url);
+    m_regenerateScript = true;
+
+    emit thumbnailLoaded(url, thumbnailUrl(url));
+}
+
+// static
+bool SpeedDial::saveThumbnail(const QImage &image, const QSize &size, const QString &fileName)
+{
+    // Crop top part of the page with the same aspect ratio as thumbnail
+    const int height = qMin(image.height(), image.width() * size.height() / size.width());
+    const QImage thumbnail = image.copy(0, 0, image.width(), height).scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+    QSaveFile file(fileName);
+    if (!file.open(QFile::WriteOnly) || !thumbnail.save(&file, "PNG")) {
+        return false;
+    }
+
+    return file.commit();
+}
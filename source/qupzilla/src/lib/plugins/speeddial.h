@@ -18,8 +18,11 @@
 #ifndef SPEEDDIAL_H
 #define SPEEDDIAL_H
 
+#include <QHash>
+#include <QImage>
 #include <QObject>
 #include <QPointer>
+#include <QSet>
 #include <QWebEnginePage>
 
 #include "qzcommon.h"
@@ -29,6 +32,7 @@ class QPixmap;
 
 class AutoSaver;
 class PageThumbnailer;
+class WebView;
 
 class QUPZILLA_EXPORT SpeedDial : public QObject
 {
@@ -56,6 +60,9 @@ public:
     Page pageForUrl(const QUrl &url);
     QUrl urlForShortcut(int key);
 
+    // Grabs thumbnail from already rendered view when it shows speed dial page
+    void captureThumbnail(WebView* view);
+
     void addPage(const QUrl &url, const QString &title);
     void removePage(const Page &page);
 
@@ -68,6 +75,9 @@ public:
     QString backgroundImageSize();
     QString initialScript();
 
+    // Local file for thumbnail served as qupzilla:thumbnail/<hash>
+    QString thumbnailPath(const QString &hash);
+
 signals:
     void pagesChanged();
     void thumbnailLoaded(const QString &url, const QString &src);
@@ -95,6 +105,12 @@ private:
     QString escapeUrl(QString url) const;
 
     QString generateAllPages();
+    QString thumbnailHash(const QString &url) const;
+    QString thumbnailUrl(const QString &url) const;
+
+    void grabThumbnail(WebView* view, const QString &url);
+    void thumbnailSaved(const QString &url, bool ok);
+    static bool saveThumbnail(const QImage &image, const QSize &size, const QString &fileName);
 
     QString m_initialScript;
     QString m_thumbnailsDir;
@@ -106,6 +122,16 @@ private:
     bool m_sdcentered;
 
     QList<Page> m_pages;
+
+    struct BoxScript {
+        QString title;
+        QString script;
+    };
+    QHash<QString, BoxScript> m_boxScripts;
+
+    QSet<QString> m_pendingCaptures;
+    QHash<QString, qint64> m_lastCaptures;
+    qint64 m_lastCaptureTime;
     AutoSaver* m_autoSaver;
 
     bool m_loaded;
@@ -19,6 +19,7 @@
 #include "ui_autofillmanager.h"
 #include "autofill.h"
 #include "passwordmanager.h"
+#include "passwordmodel.h"
 #include "passwordbackends/passwordbackend.h"
 #include "mainapplication.h"
 #include "settings.h"
@@ -32,18 +33,28 @@
 #include <QInputDialog>
 #include <QFileDialog>
 #include <QClipboard>
+#include <QHeaderView>
+#include <QSortFilterProxyModel>
 
 AutoFillManager::AutoFillManager(QWidget* parent)
     : QWidget(parent)
     , ui(new Ui::AutoFillManager)
     , m_passwordManager(mApp->autoFill()->passwordManager())
+    , m_passwordModel(new PasswordModel(this))
+    , m_passwordFilter(new QSortFilterProxyModel(this))
     , m_passwordsShown(false)
 {
     ui->setupUi(this);
+
+    // Only host is known before decrypting, so filter and default sort by it
+    m_passwordFilter->setSourceModel(m_passwordModel);
+    m_passwordFilter->setFilterKeyColumn(PasswordModel::ServerColumn);
+    m_passwordFilter->setFilterCaseSensitivity(Qt::CaseInsensitive);
+    m_passwordFilter->setSortRole(PasswordModel::SortRole);
+    ui->treePass->setModel(m_passwordFilter);
+
     if (isRightToLeft()) {
-        ui->treePass->headerItem()->setTextAlignment(0, Qt::AlignRight | Qt::AlignVCenter);
-        ui->treePass->headerItem()->setTextAlignment(1, Qt::AlignRight | Qt::AlignVCenter);
-        ui->treePass->headerItem()->setTextAlignment(2, Qt::AlignRight | Qt::AlignVCenter);
+        ui->treePass->header()->setDefaultAlignment(Qt::AlignRight | Qt::AlignVCenter);
         ui->treePass->setLayoutDirection(Qt::LeftToRight);
         ui->treeExcept->setLayoutDirection(Qt::LeftToRight);
     }
@@ -52,7 +63,7 @@ AutoFillManager::AutoFillManager(QWidget* parent)
     connect(ui->removeAllPass, SIGNAL(clicked()), this, SLOT(removeAllPass()));
     connect(ui->editPass, SIGNAL(clicked()), this, SLOT(editPass()));
     connect(ui->showPasswords, SIGNAL(clicked()), this, SLOT(showPasswords()));
-    connect(ui->search, SIGNAL(textChanged(QString)), ui->treePass, SLOT(filterString(QString)));
+    connect(ui->search, SIGNAL(textChanged(QString)), m_passwordFilter, SLOT(setFilterFixedString(QString)));
     connect(ui->changeBackend, SIGNAL(clicked()), this, SLOT(changePasswordBackend()));
     connect(ui->backendOptions, SIGNAL(clicked()), this, SLOT(showBackendOptions()));
     connect(m_passwordManager, SIGNAL(passwordBackendChanged()), this, SLOT(currentPasswordBackendChanged()));
@@ -61,7 +72,7 @@ AutoFillManager::AutoFillManager(QWidget* parent)
     connect(ui->removeAllExcept, SIGNAL(clicked()), this, SLOT(removeAllExcept()));
 
     ui->treePass->setContextMenuPolicy(Qt::CustomContextMenu);
-    connect(ui->treePass, &TreeWidget::customContextMenuRequested, this, &AutoFillManager::passwordContextMenu);
+    connect(ui->treePass, &QTreeView::customContextMenuRequested, this, &AutoFillManager::passwordContextMenu);
 
     QMenu* menu = new QMenu(this);
     menu->addAction(tr("Import Passwords from File..."), this, SLOT(importPasswords()));
@@ -82,20 +93,9 @@ void AutoFillManager::loadPasswords()
     ui->showPasswords->setText(tr("Show Passwords"));
     m_passwordsShown = false;
 
-    QVector<PasswordEntry> allEntries = mApp->autoFill()->getAllFormData();
-
-    ui->treePass->clear();
-    foreach (const PasswordEntry &entry, allEntries) {
-        QTreeWidgetItem* item = new QTreeWidgetItem(ui->treePass);
-        item->setText(0, entry.host);
-        item->setText(1, entry.username);
-        item->setText(2, "*****");
-
-        QVariant v;
-        v.setValue<PasswordEntry>(entry);
-        item->setData(0, Qt::UserRole + 10, v);
-        ui->treePass->addTopLevelItem(item);
-    }
+    // Entries are decrypted lazily as their rows get visible
+    m_passwordModel->setPasswordsShown(false);
+    m_passwordModel->reload(m_passwordManager->activeBackend());
 
     QSqlQuery query(SqlDatabase::instance()->database());
     query.exec("SELECT server, id FROM autofill_exceptions");
@@ -107,7 +107,7 @@ void AutoFillManager::loadPasswords()
         ui->treeExcept->addTopLevelItem(item);
     }
 
-    ui->treePass->sortByColumn(-1);
+    ui->treePass->sortByColumn(-1, Qt::AscendingOrder);
     ui->treeExcept->sortByColumn(-1);
 }
 
@@ -160,13 +160,7 @@ void AutoFillManager::showBackendOptions()
 void AutoFillManager::showPasswords()
 {
     if (m_passwordsShown) {
-        for (int i = 0; i < ui->treePass->topLevelItemCount(); i++) {
-            QTreeWidgetItem* item = ui->treePass->topLevelItem(i);
-            if (!item) {
-                continue;
-            }
-            item->setText(2, "*****");
-        }
+        m_passwordModel->setPasswordsShown(false);
 
         ui->showPasswords->setText(tr("Show Passwords"));
         m_passwordsShown = false;
@@ -182,49 +176,44 @@ void AutoFillManager::showPasswords()
         return;
     }
 
-    for (int i = 0; i < ui->treePass->topLevelItemCount(); i++) {
-        QTreeWidgetItem* item = ui->treePass->topLevelItem(i);
-        if (!item) {
-            continue;
-        }
-
-        item->setText(2, item->data(0, Qt::UserRole + 10).value<PasswordEntry>().password);
-    }
+    // Only passwords of visible rows are decrypted
+    m_passwordModel->setPasswordsShown(true);
 
     ui->showPasswords->setText(tr("Hide Passwords"));
 }
 
 void AutoFillManager::copyPassword()
 {
-    QTreeWidgetItem* curItem = ui->treePass->currentItem();
-    if (!curItem)
+    const QModelIndex index = currentPasswordIndex();
+    if (!index.isValid())
         return;
 
-    PasswordEntry entry = curItem->data(0, Qt::UserRole + 10).value<PasswordEntry>();
+    PasswordEntry entry = m_passwordModel->entry(index);
     QApplication::clipboard()->setText(entry.password);
 }
 
 void AutoFillManager::copyUsername()
 {
-    QTreeWidgetItem* curItem = ui->treePass->currentItem();
-    if (!curItem)
+    const QModelIndex index = currentPasswordIndex();
+    if (!index.isValid())
         return;
 
-    PasswordEntry entry = curItem->data(0, Qt::UserRole + 10).value<PasswordEntry>();
+    PasswordEntry entry = m_passwordModel->entry(index);
     QApplication::clipboard()->setText(entry.username);
 }
 
 void AutoFillManager::removePass()
 {
-    QTreeWidgetItem* curItem = ui->treePass->currentItem();
-    if (!curItem) {
+    const QModelIndex index = currentPasswordIndex();
+    if (!index.isValid()) {
         return;
     }
 
-    PasswordEntry entry = curItem->data(0, Qt::UserRole + 10).value<PasswordEntry>();
+    // Removing needs only id, no need to decrypt the entry
+    PasswordEntry entry = index.data(PasswordModel::EntryRole).value<PasswordEntry>();
     mApp->autoFill()->removeEntry(entry);
 
-    delete curItem;
+    m_passwordModel->removeEntry(index);
 }
 
 void AutoFillManager::removeAllPass()
@@ -236,17 +225,20 @@ void AutoFillManager::removeAllPass()
     }
 
     mApp->autoFill()->removeAllEntries();
-    ui->treePass->clear();
+    m_passwordModel->clear();
 }
 
 void AutoFillManager::editPass()
 {
-    QTreeWidgetItem* curItem = ui->treePass->currentItem();
-    if (!curItem) {
+    const QModelIndex index = currentPasswordIndex();
+    if (!index.isValid()) {
         return;
     }
 
-    PasswordEntry entry = curItem->data(0, Qt::UserRole + 10).value<PasswordEntry>();
+    PasswordEntry entry = m_passwordModel->entry(index);
+    if (!entry.id.isValid()) {
+        return;
+    }
 
     bool ok;
     QString text = QInputDialog::getText(this, tr("Edit password"), tr("Change password:"), QLineEdit::Normal, entry.password, &ok);
@@ -257,13 +249,7 @@ void AutoFillManager::editPass()
         entry.password = text;
 
         if (mApp->autoFill()->updateEntry(entry)) {
-            QVariant v;
-            v.setValue<PasswordEntry>(entry);
-            curItem->setData(0, Qt::UserRole + 10, v);
-
-            if (m_passwordsShown) {
-                curItem->setText(2, text);
-            }
+            m_passwordModel->updateEntry(index, entry);
         }
     }
 }
@@ -376,6 +362,11 @@ void AutoFillManager::passwordContextMenu(const QPoint &pos)
     menu->popup(ui->treePass->viewport()->mapToGlobal(pos));
 }
 
+QModelIndex AutoFillManager::currentPasswordIndex() const
+{
+    return m_passwordFilter->mapToSource(ui->treePass->currentIndex());
+}
+
 AutoFillManager::~AutoFillManager()
 {
     delete ui;
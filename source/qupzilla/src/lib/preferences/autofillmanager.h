@@ -22,7 +22,11 @@
 
 #include "qzcommon.h"
 
+class QModelIndex;
+class QSortFilterProxyModel;
+
 class PasswordManager;
+class PasswordModel;
 
 namespace Ui
 {
@@ -65,9 +69,14 @@ private slots:
     void passwordContextMenu(const QPoint &pos);
 
 private:
+    // Returns index in m_passwordModel
+    QModelIndex currentPasswordIndex() const;
+
     Ui::AutoFillManager* ui;
 
     PasswordManager* m_passwordManager;
+    PasswordModel* m_passwordModel;
+    QSortFilterProxyModel* m_passwordFilter;
     QString m_fileName;
     bool m_passwordsShown;
 };
@@ -540,6 +540,8 @@ Preferences::Preferences(BrowserWindow* window)
     } else if (proxyType == 3) {
         ui->manualProxy->setChecked(true);
         ui->proxyType->setCurrentIndex(0);
+    } else if (proxyType == 5) {
+        ui->pacProxy->setChecked(true);
     } else {
         ui->manualProxy->setChecked(true);
         ui->proxyType->setCurrentIndex(1);
@@ -549,10 +551,14 @@ Preferences::Preferences(BrowserWindow* window)
     ui->proxyPort->setText(settings.value("Port", 8080).toString());
     ui->proxyUsername->setText(settings.value("Username", "").toString());
     ui->proxyPassword->setText(settings.value("Password", "").toString());
+    ui->proxyExceptions->setText(settings.value("ProxyExceptions", QStringList() << "localhost" << "127.0.0.1").toStringList().join(QSL(", ")));
+    ui->pacUrl->setText(settings.value("PacUrl", QString()).toString());
     settings.endGroup();
 
     setManualProxyConfigurationEnabled(ui->manualProxy->isChecked());
+    ui->pacUrl->setEnabled(ui->pacProxy->isChecked());
     connect(ui->manualProxy, SIGNAL(toggled(bool)), this, SLOT(setManualProxyConfigurationEnabled(bool)));
+    connect(ui->pacProxy, SIGNAL(toggled(bool)), ui->pacUrl, SLOT(setEnabled(bool)));
 
     //CONNECTS
     connect(ui->buttonBox, SIGNAL(clicked(QAbstractButton*)), this, SLOT(buttonClicked(QAbstractButton*)));
@@ -1085,6 +1091,8 @@ void Preferences::saveSettings()
         proxyType = 0;
     } else if (ui->systemProxy->isChecked()) {
         proxyType = 2;
+    } else if (ui->pacProxy->isChecked()) {
+        proxyType = 5;
     } else if (ui->proxyType->currentIndex() == 0) { // Http
         proxyType = 3;
     } else { // Socks5
@@ -1097,6 +1105,8 @@ void Preferences::saveSettings()
     settings.setValue("Port", ui->proxyPort->text().toInt());
     settings.setValue("Username", ui->proxyUsername->text());
     settings.setValue("Password", ui->proxyPassword->text());
+    settings.setValue("ProxyExceptions", ui->proxyExceptions->text().split(QL1C(','), QString::SkipEmptyParts));
+    settings.setValue("PacUrl", ui->pacUrl->text());
     settings.endGroup();
 
 #ifndef PORTABLE_BUILD
@@ -1,12 +1,17 @@
 INCLUDEPATH += $$PWD
 
 SOURCES += \
+    $$PWD/readingmodeextractor.cpp \
     $$PWD/readingmodemanager.cpp \
-    $$PWD/readingmodeicon.cpp
+    $$PWD/readingmodeicon.cpp \
+    $$PWD/readingmodestore.cpp
 
 HEADERS += \
+    $$PWD/readingmodearticle.h \
+    $$PWD/readingmodeextractor.h \
     $$PWD/readingmodemanager.h \
-    $$PWD/readingmodeicon.h
+    $$PWD/readingmodeicon.h \
+    $$PWD/readingmodestore.h
 
 RESOURCES += \
     $$PWD/data/readingmode.qrc
@@ -0,0 +1,32 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef READINGMODEARTICLE_H
+#define READINGMODEARTICLE_H
+
+#include <QString>
+#include <QUrl>
+
+struct ReadingModeArticle {
+    QString title;
+    QString content;
+    QString byline;
+    QUrl originalUrl;
+    bool isValid() const { return !content.isEmpty(); }
+};
+
+#endif // READINGMODEARTICLE_H
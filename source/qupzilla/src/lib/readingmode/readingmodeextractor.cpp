@@ -0,0 +1,792 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "readingmodeextractor.h"
+
+#include <QHash>
+#include <QSet>
+#include <QVector>
+#include <QRegularExpression>
+
+// Scoring follows the approach of Mozilla's Readability.js: paragraphs give
+// points to their parent and grandparent, candidates are penalized by link
+// density and the best one is merged with its related siblings.
+
+namespace
+{
+
+struct Node
+{
+    QString tag; // empty for text nodes
+    QString text;
+    QVector<QPair<QString, QString> > attributes;
+    Node* parent = nullptr;
+    QVector<Node*> children;
+
+    bool removed = false;
+    bool candidate = false;
+    double score = 0;
+    int textLength = 0;
+    int linkLength = 0;
+    int commas = 0;
+
+    bool isText() const { return tag.isEmpty(); }
+
+    QString attribute(const QString &name) const
+    {
+        for (const auto &attribute : attributes) {
+            if (attribute.first == name) {
+                return attribute.second;
+            }
+        }
+        return QString();
+    }
+
+    bool hasAttribute(const QString &name) const
+    {
+        for (const auto &attribute : attributes) {
+            if (attribute.first == name) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    double linkDensity() const
+    {
+        return textLength > 0 ? double(linkLength) / textLength : 0;
+    }
+};
+
+static const QSet<QString> &voidTags()
+{
+    static const QSet<QString> tags = {
+        QSL("area"), QSL("base"), QSL("br"), QSL("col"), QSL("embed"), QSL("hr"), QSL("img"), QSL("input"),
+        QSL("link"), QSL("meta"), QSL("param"), QSL("source"), QSL("track"), QSL("wbr")
+    };
+    return tags;
+}
+
+// Contents of these elements are not parsed at all
+static const QSet<QString> &rawTextTags()
+{
+    static const QSet<QString> tags = {
+        QSL("script"), QSL("style"), QSL("noscript"), QSL("template"), QSL("textarea"), QSL("title")
+    };
+    return tags;
+}
+
+static const QSet<QString> &removeTags()
+{
+    static const QSet<QString> tags = {
+        QSL("head"), QSL("nav"), QSL("aside"), QSL("header"), QSL("footer"), QSL("form"), QSL("button"),
+        QSL("select"), QSL("input"), QSL("iframe"), QSL("object"), QSL("embed"), QSL("svg"), QSL("canvas"),
+        QSL("menu")
+    };
+    return tags;
+}
+
+// Starting one of these implicitly closes an open paragraph
+static const QSet<QString> &blockTags()
+{
+    static const QSet<QString> tags = {
+        QSL("p"), QSL("div"), QSL("ul"), QSL("ol"), QSL("dl"), QSL("table"), QSL("blockquote"), QSL("pre"),
+        QSL("section"), QSL("article"), QSL("aside"), QSL("header"), QSL("footer"), QSL("nav"), QSL("figure"),
+        QSL("h1"), QSL("h2"), QSL("h3"), QSL("h4"), QSL("h5"), QSL("h6"), QSL("hr"), QSL("form"), QSL("main")
+    };
+    return tags;
+}
+
+// Elements kept in the output, everything else is unwrapped
+static const QSet<QString> &keepTags()
+{
+    static const QSet<QString> tags = {
+        QSL("p"), QSL("br"), QSL("hr"), QSL("a"), QSL("img"), QSL("h1"), QSL("h2"), QSL("h3"), QSL("h4"),
+        QSL("h5"), QSL("h6"), QSL("ul"), QSL("ol"), QSL("li"), QSL("dl"), QSL("dt"), QSL("dd"),
+        QSL("blockquote"), QSL("pre"), QSL("code"), QSL("em"), QSL("strong"), QSL("b"), QSL("i"), QSL("u"),
+        QSL("s"), QSL("sub"), QSL("sup"), QSL("figure"), QSL("figcaption"), QSL("table"), QSL("thead"),
+        QSL("tbody"), QSL("tfoot"), QSL("tr"), QSL("td"), QSL("th"), QSL("caption"), QSL("div"),
+        QSL("section"), QSL("article"), QSL("main")
+    };
+    return tags;
+}
+
+static const QRegularExpression &unlikelyCandidates()
+{
+    static const QRegularExpression re(QSL("banner|breadcrumbs|combx|comment|community|disqus|extra|footer|gdpr|header|"
+                                           "legends|menu|related|remark|replies|rss|shoutbox|sidebar|skyscraper|social|"
+                                           "sponsor|supplemental|ad-break|agegate|pagination|pager|popup|share|cookie|"
+                                           "newsletter|promo|navbar"), QRegularExpression::CaseInsensitiveOption);
+    return re;
+}
+
+static const QRegularExpression &maybeCandidate()
+{
+    static const QRegularExpression re(QSL("and|article|body|column|content|main|shadow"), QRegularExpression::CaseInsensitiveOption);
+    return re;
+}
+
+static const QRegularExpression &positiveClass()
+{
+    static const QRegularExpression re(QSL("article|body|content|entry|hentry|h-entry|main|page|post|text|blog|story"),
+                                       QRegularExpression::CaseInsensitiveOption);
+    return re;
+}
+
+static const QRegularExpression &negativeClass()
+{
+    static const QRegularExpression re(QSL("hidden|banner|combx|comment|com-|contact|foot|footnote|gdpr|masthead|media|"
+                                           "meta|outbrain|promo|related|scroll|share|shoutbox|sidebar|skyscraper|"
+                                           "sponsor|shopping|tags|tool|widget"), QRegularExpression::CaseInsensitiveOption);
+    return re;
+}
+
+static QString decodeEntities(const QString &text)
+{
+    if (!text.contains(QL1C('&'))) {
+        return text;
+    }
+
+    static const QHash<QString, QString> entities = {
+        {QSL("amp"), QSL("&")}, {QSL("lt"), QSL("<")}, {QSL("gt"), QSL(">")}, {QSL("quot"), QSL("\"")},
+        {QSL("apos"), QSL("'")}, {QSL("nbsp"), QSL(" ")}, {QSL("ndash"), QString(QChar(0x2013))},
+        {QSL("mdash"), QString(QChar(0x2014))}, {QSL("hellip"), QString(QChar(0x2026))},
+        {QSL("lsquo"), QString(QChar(0x2018))}, {QSL("rsquo"), QString(QChar(0x2019))},
+        {QSL("ldquo"), QString(QChar(0x201C))}, {QSL("rdquo"), QString(QChar(0x201D))},
+        {QSL("copy"), QString(QChar(0x00A9))}
+    };
+
+    QString out;
+    out.reserve(text.size());
+
+    for (int i = 0; i < text.size(); ++i) {
+        const QChar c = text.at(i);
+        const int end = c == QL1C('&') ? text.indexOf(QL1C(';'), i) : -1;
+        if (end == -1 || end - i > 10) {
+            out.append(c);
+            continue;
+        }
+
+        const QString entity = text.mid(i + 1, end - i - 1);
+        if (entity.startsWith(QL1C('#'))) {
+            bool ok;
+            const uint code = entity.startsWith(QL1S("#x"), Qt::CaseInsensitive) ? entity.mid(2).toUInt(&ok, 16) : entity.mid(1).toUInt(&ok);
+            if (ok) {
+                out.append(QString::fromUcs4(&code, 1));
+                i = end;
+                continue;
+            }
+        }
+        else if (entities.contains(entity)) {
+            out.append(entities.value(entity));
+            i = end;
+            continue;
+        }
+
+        out.append(c);
+    }
+
+    return out;
+}
+
+class Document
+{
+public:
+    explicit Document(const QString &html);
+    ~Document() { qDeleteAll(m_nodes); }
+
+    Node* root() const { return m_root; }
+    QString title() const { return m_title; }
+
+    // All element and text nodes in document order
+    const QVector<Node*> &nodes() const { return m_nodes; }
+
+private:
+    Node* createNode(const QString &tag, Node* parent);
+    void parse(const QString &html);
+
+    Node* m_root;
+    QString m_title;
+    QVector<Node*> m_nodes;
+};
+
+Document::Document(const QString &html)
+{
+    m_root = createNode(QSL("#root"), nullptr);
+    parse(html);
+}
+
+Node* Document::createNode(const QString &tag, Node* parent)
+{
+    Node* node = new Node;
+    node->tag = tag;
+    node->parent = parent;
+    if (parent) {
+        parent->children.append(node);
+    }
+    m_nodes.append(node);
+    return node;
+}
+
+void Document::parse(const QString &html)
+{
+    Node* current = m_root;
+    const int length = html.length();
+    int i = 0;
+
+    while (i < length) {
+        if (html.at(i) != QL1C('<')) {
+            int end = html.indexOf(QL1C('<'), i);
+            if (end == -1) {
+                end = length;
+            }
+            Node* text = createNode(QString(), current);
+            text->text = html.mid(i, end - i);
+            i = end;
+            continue;
+        }
+
+        const QChar next = i + 1 < length ? html.at(i + 1) : QChar();
+
+        // Comments, doctype and processing instructions
+        if (next == QL1C('!') || next == QL1C('?')) {
+            int end;
+            if (html.midRef(i, 4) == QL1S("<!--")) {
+                end = html.indexOf(QL1S("-->"), i + 4);
+                end = end == -1 ? length : end + 3;
+            }
+            else {
+                end = html.indexOf(QL1C('>'), i);
+                end = end == -1 ? length : end + 1;
+            }
+            i = end;
+            continue;
+        }
+
+        // End tag
+        if (next == QL1C('/')) {
+            int j = i + 2;
+            while (j < length && html.at(j).isLetterOrNumber()) {
+                ++j;
+            }
+            const QString tag = html.mid(i + 2, j - i - 2).toLower();
+            const int end = html.indexOf(QL1C('>'), j);
+            i = end == -1 ? length : end + 1;
+
+            Node* node = current;
+            while (node != m_root && node->tag != tag) {
+                node = node->parent;
+            }
+            if (node != m_root) {
+                current = node->parent;
+            }
+            continue;
+        }
+
+        if (!next.isLetter()) {
+            Node* text = createNode(QString(), current);
+            text->text = QSL("&lt;");
+            ++i;
+            continue;
+        }
+
+        // Start tag
+        int j = i + 1;
+        while (j < length && (html.at(j).isLetterOrNumber() || html.at(j) == QL1C('-') || html.at(j) == QL1C(':'))) {
+            ++j;
+        }
+        const QString tag = html.mid(i + 1, j - i - 1).toLower();
+
+        QVector<QPair<QString, QString> > attributes;
+        bool selfClosing = false;
+
+        while (j < length) {
+            const QChar c = html.at(j);
+            if (c == QL1C('>')) {
+                ++j;
+                break;
+            }
+            if (c == QL1C('/')) {
+                selfClosing = true;
+                ++j;
+                continue;
+            }
+            if (c.isSpace()) {
+                ++j;
+                continue;
+            }
+
+            selfClosing = false;
+
+            const int nameStart = j;
+            while (j < length && !html.at(j).isSpace() && html.at(j) != QL1C('=') && html.at(j) != QL1C('>') && html.at(j) != QL1C('/')) {
+                ++j;
+            }
+            const QString name = html.mid(nameStart, j - nameStart).toLower();
+
+            while (j < length && html.at(j).isSpace()) {
+                ++j;
+            }
+
+            QString value;
+            if (j < length && html.at(j) == QL1C('=')) {
+                ++j;
+                while (j < length && html.at(j).isSpace()) {
+                    ++j;
+                }
+                if (j < length && (html.at(j) == QL1C('"') || html.at(j) == QL1C('\''))) {
+                    int end = html.indexOf(html.at(j), j + 1);
+                    if (end == -1) {
+                        end = length;
+                    }
+                    value = html.mid(j + 1, end - j - 1);
+                    j = end + 1;
+                }
+                else {
+                    const int valueStart = j;
+                    while (j < length && !html.at(j).isSpace() && html.at(j) != QL1C('>')) {
+                        ++j;
+                    }
+                    value = html.mid(valueStart, j - valueStart);
+                }
+            }
+
+            if (!name.isEmpty()) {
+                attributes.append(qMakePair(name, value));
+            }
+        }
+
+        i = j;
+
+        if (rawTextTags().contains(tag)) {
+            int end = html.indexOf(QSL("</") + tag, i, Qt::CaseInsensitive);
+            if (end == -1) {
+                end = length;
+            }
+            if (tag == QL1S("title") && m_title.isEmpty()) {
+                m_title = decodeEntities(html.mid(i, end - i)).simplified();
+            }
+            const int close = html.indexOf(QL1C('>'), end);
+            i = close == -1 ? length : close + 1;
+            continue;
+        }
+
+        if (current->tag == QL1S("p") && blockTags().contains(tag)) {
+            current = current->parent;
+        }
+        else if (current->tag == tag && (tag == QL1S("li") || tag == QL1S("dt") || tag == QL1S("dd") || tag == QL1S("option"))) {
+            current = current->parent;
+        }
+
+        Node* node = createNode(tag, current);
+        node->attributes = attributes;
+
+        if (!selfClosing && !voidTags().contains(tag)) {
+            current = node;
+        }
+    }
+}
+
+static int classWeight(const Node* node)
+{
+    int weight = 0;
+
+    const QString className = node->attribute(QSL("class"));
+    if (!className.isEmpty()) {
+        if (negativeClass().match(className).hasMatch()) {
+            weight -= 25;
+        }
+        if (positiveClass().match(className).hasMatch()) {
+            weight += 25;
+        }
+    }
+
+    const QString id = node->attribute(QSL("id"));
+    if (!id.isEmpty()) {
+        if (negativeClass().match(id).hasMatch()) {
+            weight -= 25;
+        }
+        if (positiveClass().match(id).hasMatch()) {
+            weight += 25;
+        }
+    }
+
+    return weight;
+}
+
+static int tagWeight(const QString &tag)
+{
+    if (tag == QL1S("div") || tag == QL1S("article")) {
+        return 5;
+    }
+    if (tag == QL1S("pre") || tag == QL1S("td") || tag == QL1S("blockquote")) {
+        return 3;
+    }
+    if (tag == QL1S("address") || tag == QL1S("ol") || tag == QL1S("ul") || tag == QL1S("dl") ||
+        tag == QL1S("dd") || tag == QL1S("dt") || tag == QL1S("li") || tag == QL1S("form")) {
+        return -3;
+    }
+    if ((tag.size() == 2 && tag.at(0) == QL1C('h') && tag.at(1).isDigit()) || tag == QL1S("th")) {
+        return -5;
+    }
+    return 0;
+}
+
+static void prune(Node* node)
+{
+    static const QSet<QString> unlikelyRoles = {
+        QSL("menu"), QSL("menubar"), QSL("complementary"), QSL("navigation"), QSL("alert"), QSL("alertdialog"), QSL("dialog")
+    };
+
+    foreach (Node* child, node->children) {
+        if (child->isText()) {
+            continue;
+        }
+
+        if (removeTags().contains(child->tag) || child->hasAttribute(QSL("hidden")) ||
+            unlikelyRoles.contains(child->attribute(QSL("role"))) ||
+            child->attribute(QSL("style")).remove(QL1C(' ')).contains(QL1S("display:none"), Qt::CaseInsensitive)) {
+            child->removed = true;
+            continue;
+        }
+
+        if (child->tag != QL1S("body") && child->tag != QL1S("article") && child->tag != QL1S("main")) {
+            const QString match = child->attribute(QSL("class")) + QL1C(' ') + child->attribute(QSL("id"));
+            if (match.size() > 1 && unlikelyCandidates().match(match).hasMatch() && !maybeCandidate().match(match).hasMatch()) {
+                child->removed = true;
+                continue;
+            }
+        }
+
+        prune(child);
+    }
+}
+
+static void computeStats(Node* node, bool inLink)
+{
+    node->textLength = 0;
+    node->linkLength = 0;
+    node->commas = 0;
+
+    if (node->isText()) {
+        node->textLength = node->text.simplified().length();
+        node->commas = node->text.count(QL1C(','));
+        if (inLink) {
+            node->linkLength = node->textLength;
+        }
+        return;
+    }
+
+    const bool link = inLink || node->tag == QL1S("a");
+
+    foreach (Node* child, node->children) {
+        if (child->removed) {
+            continue;
+        }
+        computeStats(child, link);
+        node->textLength += child->textLength;
+        node->linkLength += child->linkLength;
+        node->commas += child->commas;
+    }
+}
+
+static bool hasBlockChildren(const Node* node)
+{
+    foreach (const Node* child, node->children) {
+        if (!child->isText() && !child->removed && blockTags().contains(child->tag)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static QString textContent(const Node* node)
+{
+    if (node->isText()) {
+        return node->text;
+    }
+
+    QString text;
+    foreach (const Node* child, node->children) {
+        text += textContent(child);
+    }
+    return text;
+}
+
+static QString resolvedUrl(const QString &value, const QUrl &baseUrl)
+{
+    const QUrl url = baseUrl.resolved(QUrl(decodeEntities(value).trimmed()));
+    if (url.scheme() == QL1S("javascript")) {
+        return QString();
+    }
+    return url.toString().toHtmlEscaped();
+}
+
+static void serialize(const Node* node, const QUrl &baseUrl, QString &out)
+{
+    if (node->removed) {
+        return;
+    }
+
+    if (node->isText()) {
+        out += node->text;
+        return;
+    }
+
+    const QString &tag = node->tag;
+
+    // Remove link lists and other boilerplate left inside the content
+    if (tag == QL1S("div") || tag == QL1S("section") || tag == QL1S("ul") || tag == QL1S("ol") || tag == QL1S("table")) {
+        if (classWeight(node) < 0 || (node->textLength > 0 && node->linkDensity() > 0.5)) {
+            return;
+        }
+    }
+
+    if (!keepTags().contains(tag)) {
+        foreach (const Node* child, node->children) {
+            serialize(child, baseUrl, out);
+        }
+        return;
+    }
+
+    const QString outTag = tag == QL1S("section") || tag == QL1S("article") || tag == QL1S("main") ? QSL("div") : tag;
+
+    if (tag == QL1S("img")) {
+        QString src = node->attribute(QSL("src"));
+        if (src.isEmpty() || src.startsWith(QL1S("data:"))) {
+            const QString lazySrc = node->attribute(QSL("data-src"));
+            if (!lazySrc.isEmpty()) {
+                src = lazySrc;
+            }
+        }
+        src = resolvedUrl(src, baseUrl);
+        if (src.isEmpty()) {
+            return;
+        }
+        out += QSL("<img src=\"%1\" alt=\"%2\">").arg(src, node->attribute(QSL("alt")).toHtmlEscaped());
+        return;
+    }
+
+    out += QL1C('<') + outTag;
+    if (tag == QL1S("a")) {
+        const QString href = resolvedUrl(node->attribute(QSL("href")), baseUrl);
+        if (!href.isEmpty()) {
+            out += QSL(" href=\"%1\"").arg(href);
+        }
+    }
+    else if (tag == QL1S("td") || tag == QL1S("th")) {
+        foreach (const QString &name, QStringList() << QSL("colspan") << QSL("rowspan")) {
+            const int value = node->attribute(name).toInt();
+            if (value > 1) {
+                out += QSL(" %1=\"%2\"").arg(name).arg(value);
+            }
+        }
+    }
+    out += QL1C('>');
+
+    if (voidTags().contains(tag)) {
+        return;
+    }
+
+    foreach (const Node* child, node->children) {
+        serialize(child, baseUrl, out);
+    }
+
+    out += QSL("</") + outTag + QL1C('>');
+}
+
+} // namespace
+
+ReadingModeArticle ReadingModeExtractor::extract(const QString &html, const QUrl &url)
+{
+    ReadingModeArticle article;
+    article.originalUrl = url;
+
+    Document document(html);
+    const QVector<Node*> &nodes = document.nodes();
+
+    // Metadata
+    QString ogTitle;
+    QString h1Title;
+    Node* body = nullptr;
+
+    foreach (Node* node, nodes) {
+        if (node->tag == QL1S("meta")) {
+            const QString property = node->attribute(QSL("property"));
+            const QString name = node->attribute(QSL("name")).toLower();
+            if (property == QL1S("og:title") && ogTitle.isEmpty()) {
+                ogTitle = decodeEntities(node->attribute(QSL("content"))).simplified();
+            }
+            else if (name == QL1S("author") && article.byline.isEmpty()) {
+                article.byline = decodeEntities(node->attribute(QSL("content"))).simplified();
+            }
+        }
+        else if (node->tag == QL1S("h1") && h1Title.isEmpty()) {
+            h1Title = decodeEntities(textContent(node)).simplified();
+        }
+        else if (node->tag == QL1S("body") && !body) {
+            body = node;
+        }
+    }
+
+    if (article.byline.isEmpty()) {
+        static const QRegularExpression bylineRe(QSL("byline|author"), QRegularExpression::CaseInsensitiveOption);
+        foreach (Node* node, nodes) {
+            if (node->isText()) {
+                continue;
+            }
+            if (node->attribute(QSL("rel")) == QL1S("author") ||
+                bylineRe.match(node->attribute(QSL("class")) + QL1C(' ') + node->attribute(QSL("itemprop"))).hasMatch()) {
+                const QString byline = decodeEntities(textContent(node)).simplified();
+                if (!byline.isEmpty() && byline.length() < 100) {
+                    article.byline = byline;
+                    break;
+                }
+            }
+        }
+    }
+
+    article.title = !ogTitle.isEmpty() ? ogTitle : !h1Title.isEmpty() ? h1Title : document.title();
+
+    // Scoring
+    Node* root = body ? body : document.root();
+    prune(root);
+    computeStats(root, false);
+
+    QVector<Node*> candidates;
+    auto initializeCandidate = [&candidates](Node* node) {
+        if (!node->candidate) {
+            node->candidate = true;
+            node->score = tagWeight(node->tag) + classWeight(node);
+            candidates.append(node);
+        }
+    };
+
+    foreach (Node* node, nodes) {
+        if (node->isText() || node->removed || node->textLength < 25 || !node->parent) {
+            continue;
+        }
+
+        const QString &tag = node->tag;
+        const bool scorable = tag == QL1S("p") || tag == QL1S("pre") || tag == QL1S("td") || tag == QL1S("blockquote") ||
+                              (tag == QL1S("div") && !hasBlockChildren(node));
+        if (!scorable) {
+            continue;
+        }
+
+        // Ignore nodes inside removed subtrees
+        bool removed = false;
+        for (Node* p = node->parent; p; p = p->parent) {
+            if (p->removed) {
+                removed = true;
+                break;
+            }
+        }
+        if (removed) {
+            continue;
+        }
+
+        const double score = 1 + node->commas + qMin(node->textLength / 100, 3);
+
+        Node* parent = node->parent;
+        if (parent == document.root()) {
+            continue;
+        }
+        initializeCandidate(parent);
+        parent->score += score;
+
+        Node* grandParent = parent->parent;
+        if (grandParent && grandParent != document.root()) {
+            initializeCandidate(grandParent);
+            grandParent->score += score / 2;
+        }
+    }
+
+    Node* best = nullptr;
+    double bestScore = 0;
+
+    foreach (Node* candidate, candidates) {
+        candidate->score *= 1 - candidate->linkDensity();
+        if (!best || candidate->score > bestScore) {
+            best = candidate;
+            bestScore = candidate->score;
+        }
+    }
+
+    if (!best) {
+        best = root;
+    }
+
+    // Merge with related siblings
+    QVector<Node*> content;
+    Node* parent = best->parent;
+
+    if (!parent || best == root) {
+        content.append(best);
+    }
+    else {
+        const double threshold = qMax(10.0, bestScore * 0.2);
+        foreach (Node* sibling, parent->children) {
+            if (sibling->isText() || sibling->removed) {
+                continue;
+            }
+            if (sibling == best ||
+                (sibling->candidate && sibling->score >= threshold) ||
+                (sibling->tag == QL1S("p") && sibling->textLength > 80 && sibling->linkDensity() < 0.25)) {
+                content.append(sibling);
+            }
+        }
+    }
+
+    int textLength = 0;
+    foreach (Node* node, content) {
+        textLength += node->textLength;
+    }
+
+    // Not enough text to be considered an article
+    if (textLength < 140) {
+        return article;
+    }
+
+    foreach (Node* node, content) {
+        serialize(node, url, article.content);
+    }
+
+    return article;
+}
+
+QString ReadingModeExtractor::toPlainText(const QString &content)
+{
+    QString text;
+    text.reserve(content.size());
+
+    bool inTag = false;
+    foreach (const QChar &c, content) {
+        if (c == QL1C('<')) {
+            inTag = true;
+            text.append(QL1C(' '));
+        }
+        else if (c == QL1C('>')) {
+            inTag = false;
+        }
+        else if (!inTag) {
+            text.append(c);
+        }
+    }
+
+    return decodeEntities(text).simplified();
+}
@@ -0,0 +1,36 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef READINGMODEEXTRACTOR_H
+#define READINGMODEEXTRACTOR_H
+
+#include "qzcommon.h"
+#include "readingmodearticle.h"
+
+// Readability-style article extraction from page HTML without touching the renderer.
+// Thread-safe, meant to be run on a worker thread.
+class QUPZILLA_EXPORT ReadingModeExtractor
+{
+public:
+    // Returns invalid article when no block with enough text was found
+    static ReadingModeArticle extract(const QString &html, const QUrl &url);
+
+    // Converts extracted HTML content to plain text (for comparing results)
+    static QString toPlainText(const QString &content);
+};
+
+#endif // READINGMODEEXTRACTOR_H
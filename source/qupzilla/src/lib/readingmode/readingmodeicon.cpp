@@ -17,11 +17,15 @@
 * ============================================================ */
 #include "readingmodeicon.h"
 #include "readingmodemanager.h"
+#include "readingmodeextractor.h"
 #include "mainapplication.h"
 #include "browserwindow.h"
 #include "webview.h"
 #include "webpage.h"
 
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentRun>
+
 ReadingModeIcon::ReadingModeIcon(QObject *parent)
     : AbstractButtonInterface(parent)
 {
@@ -143,18 +147,51 @@ void ReadingModeIcon::clicked(ClickController *controller)
     }
 
     const QUrl originalUrl = view->url();
+    QPointer<WebView> viewPtr = view;
+
+    // Extract the article natively on a worker thread, the JS extraction
+    // is only used as a fallback when no article was found
+    page->toHtml([this, viewPtr, originalUrl](const QString &html) {
+        if (!viewPtr) {
+            return;
+        }
+
+        QFutureWatcher<ReadingModeArticle>* watcher = new QFutureWatcher<ReadingModeArticle>(this);
+        connect(watcher, &QFutureWatcher<ReadingModeArticle>::finished, this, [=]() {
+            const ReadingModeArticle article = watcher->result();
+            watcher->deleteLater();
+
+            if (!viewPtr || viewPtr->url() != originalUrl) {
+                return;
+            }
+
+            if (article.isValid()) {
+                ReadingModeManager::instance()->cacheArticle(article);
+                viewPtr->load(ReadingModeManager::readerUrl(originalUrl));
+            }
+            else {
+                extractWithJavaScript(viewPtr, originalUrl);
+            }
+        });
+        watcher->setFuture(QtConcurrent::run(&ReadingModeExtractor::extract, html, originalUrl));
+    });
+}
+
+void ReadingModeIcon::extractWithJavaScript(WebView *view, const QUrl &originalUrl)
+{
+    QPointer<WebView> viewPtr = view;
 
-    page->runJavaScript(ReadingModeManager::getExtractionScript(),
+    view->page()->runJavaScript(ReadingModeManager::getExtractionScript(),
                        WebPage::SafeJsWorld,
-                       [this, view, originalUrl](const QVariant &result) {
-                           if (!view) {
+                       [this, viewPtr, originalUrl](const QVariant &result) {
+                           if (!viewPtr) {
                                return;
                            }
                            bool success = contentExtracted(result, originalUrl);
                            if (success) {
                                // Navigate to reader view
                                QUrl readerUrl = ReadingModeManager::readerUrl(originalUrl);
-                               view->load(readerUrl);
+                               viewPtr->load(readerUrl);
                            }
                        });
 }
@@ -40,6 +40,7 @@ private:
     void clicked(ClickController *controller);
     void pageLoadFinished(bool ok);
     void readabilityDetected(const QVariant &result);
+    void extractWithJavaScript(WebView *view, const QUrl &originalUrl);
     bool contentExtracted(const QVariant &result, const QUrl &originalUrl);
     void updateActiveIcon(bool active);
 
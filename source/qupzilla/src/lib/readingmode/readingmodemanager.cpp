@@ -16,6 +16,9 @@
 * along with this program.  If not, see <http://www.gnu.org/licenses/>.
 * ============================================================ */
 #include "readingmodemanager.h"
+#include "readingmodestore.h"
+#include "mainapplication.h"
+#include "datapaths.h"
 #include "qztools.h"
 #include "webpage.h"
 
@@ -33,37 +36,44 @@ ReadingModeManager* ReadingModeManager::instance()
 
 ReadingModeManager::ReadingModeManager(QObject *parent)
     : QObject(parent)
+    , m_readablePages(500)
 {
+    const QString storePath = mApp->isPrivate() ? QString() : DataPaths::path(DataPaths::Cache) + QL1S("/readingmode");
+    m_store = new ReadingModeStore(storePath);
+}
+
+ReadingModeManager::~ReadingModeManager()
+{
+    delete m_store;
 }
 
 bool ReadingModeManager::isPageReadable(const QUrl &url) const
 {
-    return m_readablePages.value(url, false);
+    const bool *readable = m_readablePages.object(url);
+    return readable && *readable;
 }
 
 void ReadingModeManager::setPageReadable(const QUrl &url, bool readable)
 {
-    if (m_readablePages.value(url) != readable) {
-        m_readablePages[url] = readable;
+    if (isPageReadable(url) != readable) {
+        m_readablePages.insert(url, new bool(readable));
         emit pageReadabilityChanged(url, readable);
     }
 }
 
 void ReadingModeManager::cacheArticle(const ReadingModeArticle &article)
 {
-    if (article.isValid()) {
-        m_cachedArticles[article.originalUrl] = article;
-    }
+    m_store->insert(article);
 }
 
 ReadingModeArticle ReadingModeManager::getCachedArticle(const QUrl &url) const
 {
-    return m_cachedArticles.value(url);
+    return m_store->article(url);
 }
 
 void ReadingModeManager::clearCache()
 {
-    m_cachedArticles.clear();
+    m_store->clear();
     m_readablePages.clear();
 }
 
@@ -117,7 +127,7 @@ QString ReadingModeManager::getDetectionScript()
 QString ReadingModeManager::getExtractionScript()
 {
     // Simple ES5-compatible article extraction
-    // TODO: Add ES5-transpiled Readability.js for better extraction
+    // Only used when ReadingModeExtractor does not find an article
     return QSL(
         "(function() {"
         "  var title = document.title || '';"
@@ -20,20 +20,14 @@
 
 #include <QObject>
 #include <QUrl>
-#include <QHash>
+#include <QCache>
 #include <functional>
 
 #include "qzcommon.h"
+#include "readingmodearticle.h"
 
 class WebPage;
-
-struct ReadingModeArticle {
-    QString title;
-    QString content;
-    QString byline;
-    QUrl originalUrl;
-    bool isValid() const { return !content.isEmpty(); }
-};
+class ReadingModeStore;
 
 class QUPZILLA_EXPORT ReadingModeManager : public QObject
 {
@@ -46,7 +40,8 @@ public:
     bool isPageReadable(const QUrl &url) const;
     void setPageReadable(const QUrl &url, bool readable);
 
-    // Cache extracted article content
+    // Cache extracted article content, articles are persisted on disk
+    // (except in private browsing) so they can be reopened offline
     void cacheArticle(const ReadingModeArticle &article);
     ReadingModeArticle getCachedArticle(const QUrl &url) const;
     void clearCache();
@@ -58,7 +53,7 @@ public:
     // JavaScript for readability detection
     static QString getDetectionScript();
 
-    // JavaScript for content extraction (includes Readability.js)
+    // JavaScript for content extraction, fallback for ReadingModeExtractor
     static QString getExtractionScript();
 
 signals:
@@ -66,9 +61,10 @@ signals:
 
 private:
     explicit ReadingModeManager(QObject *parent = nullptr);
+    ~ReadingModeManager();
 
-    QHash<QUrl, bool> m_readablePages;
-    QHash<QUrl, ReadingModeArticle> m_cachedArticles;
+    QCache<QUrl, bool> m_readablePages;
+    ReadingModeStore *m_store;
 
     static ReadingModeManager *s_instance;
 };
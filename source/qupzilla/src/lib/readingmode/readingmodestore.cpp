@@ -0,0 +1,236 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "readingmodestore.h"
+#include "qztools.h"
+
+#include <QDir>
+#include <QDateTime>
+#include <QDataStream>
+#include <QMap>
+#include <QSaveFile>
+#include <QCryptographicHash>
+#include <QtConcurrent/QtConcurrentRun>
+
+static const quint32 s_storeVersion = 1;
+
+static void writeArticleFile(const QString &fileName, const QByteArray &data)
+{
+    QSaveFile file(fileName);
+    if (!file.open(QFile::WriteOnly)) {
+        qWarning() << "ReadingModeStore: Cannot write" << fileName;
+        return;
+    }
+    file.write(data);
+    file.commit();
+}
+
+static void removeArticleFile(const QString &fileName)
+{
+    QFile::remove(fileName);
+}
+
+ReadingModeStore::ReadingModeStore(const QString &path, qint64 maxDiskSize, int maxMemorySize)
+    : m_path(path)
+    , m_maxDiskSize(maxDiskSize)
+    , m_diskSize(0)
+    , m_memory(maxMemorySize)
+{
+    m_writer.setMaxThreadCount(1);
+
+    if (!m_path.isEmpty()) {
+        QDir().mkpath(m_path);
+        loadIndex();
+    }
+}
+
+ReadingModeStore::~ReadingModeStore()
+{
+    m_writer.waitForDone();
+}
+
+bool ReadingModeStore::contains(const QUrl &url) const
+{
+    return m_memory.contains(url) || (!m_path.isEmpty() && m_index.contains(fileName(url)));
+}
+
+ReadingModeArticle ReadingModeStore::article(const QUrl &url)
+{
+    if (ReadingModeArticle* article = m_memory.object(url)) {
+        return *article;
+    }
+
+    if (m_path.isEmpty()) {
+        return ReadingModeArticle();
+    }
+
+    const QString name = fileName(url);
+    if (!m_index.contains(name)) {
+        return ReadingModeArticle();
+    }
+
+    // Make sure the file is not being written right now
+    m_writer.waitForDone();
+
+    const ReadingModeArticle article = deserialize(QzTools::readAllFileByteContents(m_path + QL1C('/') + name));
+    if (!article.isValid() || article.originalUrl != url) {
+        return ReadingModeArticle();
+    }
+
+    m_index[name].lastAccess = QDateTime::currentMSecsSinceEpoch();
+    m_memory.insert(url, new ReadingModeArticle(article), article.content.size() * sizeof(QChar));
+
+    return article;
+}
+
+void ReadingModeStore::insert(const ReadingModeArticle &article)
+{
+    if (!article.isValid()) {
+        return;
+    }
+
+    m_memory.insert(article.originalUrl, new ReadingModeArticle(article), article.content.size() * sizeof(QChar));
+
+    if (m_path.isEmpty()) {
+        return;
+    }
+
+    const QByteArray data = serialize(article);
+    const QString name = fileName(article.originalUrl);
+
+    if (m_index.contains(name)) {
+        m_diskSize -= m_index.value(name).size;
+    }
+
+    DiskEntry entry;
+    entry.size = data.size();
+    entry.lastAccess = QDateTime::currentMSecsSinceEpoch();
+    m_index[name] = entry;
+    m_diskSize += entry.size;
+
+    QtConcurrent::run(&m_writer, writeArticleFile, m_path + QL1C('/') + name, data);
+
+    evict();
+}
+
+void ReadingModeStore::clear()
+{
+    m_memory.clear();
+
+    if (m_path.isEmpty()) {
+        return;
+    }
+
+    m_writer.waitForDone();
+
+    QHash<QString, DiskEntry>::const_iterator it = m_index.constBegin();
+    while (it != m_index.constEnd()) {
+        QFile::remove(m_path + QL1C('/') + it.key());
+        ++it;
+    }
+
+    m_index.clear();
+    m_diskSize = 0;
+}
+
+qint64 ReadingModeStore::diskSize() const
+{
+    return m_diskSize;
+}
+
+void ReadingModeStore::waitForWrites()
+{
+    m_writer.waitForDone();
+}
+
+// static
+QByteArray ReadingModeStore::serialize(const ReadingModeArticle &article)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << s_storeVersion << article.originalUrl << article.title << article.byline << article.content;
+    return qCompress(data);
+}
+
+// static
+ReadingModeArticle ReadingModeStore::deserialize(const QByteArray &data)
+{
+    ReadingModeArticle article;
+
+    if (data.isEmpty()) {
+        return article;
+    }
+
+    const QByteArray uncompressed = qUncompress(data);
+    QDataStream stream(uncompressed);
+
+    quint32 version = 0;
+    stream >> version;
+    if (version != s_storeVersion) {
+        return article;
+    }
+
+    stream >> article.originalUrl >> article.title >> article.byline >> article.content;
+
+    if (stream.status() != QDataStream::Ok) {
+        return ReadingModeArticle();
+    }
+
+    return article;
+}
+
+QString ReadingModeStore::fileName(const QUrl &url) const
+{
+    return QString::fromLatin1(QCryptographicHash::hash(url.toEncoded(), QCryptographicHash::Sha1).toHex()) + QSL(".article");
+}
+
+void ReadingModeStore::loadIndex()
+{
+    const QFileInfoList files = QDir(m_path).entryInfoList(QStringList(QSL("*.article")), QDir::Files);
+
+    foreach (const QFileInfo &info, files) {
+        DiskEntry entry;
+        entry.size = info.size();
+        entry.lastAccess = info.lastModified().toMSecsSinceEpoch();
+        m_index.insert(info.fileName(), entry);
+        m_diskSize += entry.size;
+    }
+
+    evict();
+}
+
+void ReadingModeStore::evict()
+{
+    if (m_diskSize <= m_maxDiskSize) {
+        return;
+    }
+
+    QMultiMap<qint64, QString> byAccess;
+    QHash<QString, DiskEntry>::const_iterator it = m_index.constBegin();
+    while (it != m_index.constEnd()) {
+        byAccess.insert(it.value().lastAccess, it.key());
+        ++it;
+    }
+
+    QMultiMap<qint64, QString>::const_iterator oldest = byAccess.constBegin();
+    while (m_diskSize > m_maxDiskSize && oldest != byAccess.constEnd()) {
+        const QString name = oldest.value();
+        m_diskSize -= m_index.take(name).size;
+        QtConcurrent::run(&m_writer, removeArticleFile, m_path + QL1C('/') + name);
+        ++oldest;
+    }
+}
@@ -0,0 +1,68 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef READINGMODESTORE_H
+#define READINGMODESTORE_H
+
+#include <QCache>
+#include <QHash>
+#include <QThreadPool>
+
+#include "qzcommon.h"
+#include "readingmodearticle.h"
+
+// Size-bounded store of compressed articles on disk with an in-memory LRU front.
+// With empty path the articles are only kept in memory (private browsing).
+class QUPZILLA_EXPORT ReadingModeStore
+{
+public:
+    explicit ReadingModeStore(const QString &path, qint64 maxDiskSize = 20 * 1024 * 1024, int maxMemorySize = 2 * 1024 * 1024);
+    ~ReadingModeStore();
+
+    bool contains(const QUrl &url) const;
+    ReadingModeArticle article(const QUrl &url);
+    void insert(const ReadingModeArticle &article);
+    void clear();
+
+    qint64 diskSize() const;
+
+    // Blocks until all pending disk writes are finished
+    void waitForWrites();
+
+    static QByteArray serialize(const ReadingModeArticle &article);
+    static ReadingModeArticle deserialize(const QByteArray &data);
+
+private:
+    struct DiskEntry {
+        qint64 size;
+        qint64 lastAccess;
+    };
+
+    QString fileName(const QUrl &url) const;
+    void loadIndex();
+    void evict();
+
+    QString m_path;
+    qint64 m_maxDiskSize;
+    qint64 m_diskSize;
+
+    QHash<QString, DiskEntry> m_index;
+    QCache<QUrl, ReadingModeArticle> m_memory;
+    QThreadPool m_writer;
+};
+
+#endif // READINGMODESTORE_H
@@ -87,6 +87,12 @@ RestoreManager::RestoreManager(const QString &file)
     createFromFile(file);
 }
 
+RestoreManager::RestoreManager(const RestoreData &data)
+    : m_recoveryObject(new RecoveryJsObject(this))
+    , m_data(data)
+{
+}
+
 RestoreManager::~RestoreManager()
 {
     delete m_recoveryObject;
@@ -42,6 +42,7 @@ class QUPZILLA_EXPORT RestoreManager
 {
 public:
     explicit RestoreManager(const QString &file);
+    explicit RestoreManager(const RestoreData &data);
     virtual ~RestoreManager();
 
     bool isValid() const;
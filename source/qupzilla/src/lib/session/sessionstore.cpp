@@ -0,0 +1,267 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "sessionstore.h"
+#include "mainapplication.h"
+#include "closedwindowsmanager.h"
+#include "browserwindow.h"
+#include "tabbedwebview.h"
+#include "webtab.h"
+
+#include <QDir>
+#include <QSaveFile>
+#include <QDateTime>
+#include <QWebEngineHistory>
+
+static const int sessionStoreVersion = 1;
+
+SessionStore::SessionStore(const QString &path, QObject *parent)
+    : QObject(parent)
+    , m_path(path)
+    , m_previousReleased(false)
+    , m_nextKey(QDateTime::currentMSecsSinceEpoch())
+    , m_lastWrittenTabs(0)
+{
+    QDir().mkpath(m_path);
+}
+
+QString SessionStore::path() const
+{
+    return m_path;
+}
+
+RestoreData SessionStore::restoreData() const
+{
+    RestoreData data;
+
+    QFile indexFile(indexFilePath());
+    if (!indexFile.open(QFile::ReadOnly)) {
+        return data;
+    }
+
+    QDataStream stream(&indexFile);
+
+    int version;
+    stream >> version;
+
+    if (version < 1) {
+        return data;
+    }
+
+    int windowCount;
+    stream >> windowCount;
+    data.windows.reserve(windowCount);
+
+    for (int i = 0; i < windowCount; ++i) {
+        BrowserWindow::SavedWindow window;
+        QStringList tabKeys;
+
+        stream >> window.windowState;
+        stream >> window.windowGeometry;
+        stream >> window.windowUiState;
+        stream >> window.currentTab;
+        stream >> tabKeys;
+
+        window.tabs.reserve(tabKeys.count());
+        for (const QString &key : qAsConst(tabKeys)) {
+            QFile tabFile(tabFilePath(key));
+            if (!tabFile.open(QFile::ReadOnly)) {
+                continue;
+            }
+
+            WebTab::SavedTab tab;
+            QDataStream tabStream(qUncompress(tabFile.readAll()));
+            tabStream >> tab;
+            if (tab.isValid()) {
+                window.tabs.append(tab);
+            }
+        }
+
+        if (window.tabs.isEmpty()) {
+            continue;
+        }
+
+        window.currentTab = qBound(0, window.currentTab, window.tabs.count() - 1);
+        data.windows.append(window);
+    }
+
+    stream >> data.closedWindows;
+
+    return data;
+}
+
+int SessionStore::lastWrittenTabs() const
+{
+    return m_lastWrittenTabs;
+}
+
+void SessionStore::releasePreviousSession()
+{
+    if (m_previousReleased) {
+        return;
+    }
+
+    m_previousReleased = true;
+    m_staleKeys = QDir(m_path).entryList(QStringList(QSL("tab-*")), QDir::Files);
+
+    save();
+}
+
+void SessionStore::save()
+{
+    // Overwriting index would lose previous session before user decided to restore it
+    if (!m_previousReleased || mApp->isPrivate() || mApp->windowCount() == 0) {
+        return;
+    }
+
+    QHash<WebTab*, TabRecord> records;
+    records.reserve(m_records.size());
+    m_lastWrittenTabs = 0;
+
+    QByteArray index;
+    QDataStream stream(&index, QIODevice::WriteOnly);
+
+    const QList<BrowserWindow*> windows = mApp->windows();
+
+    stream << sessionStoreVersion;
+    stream << windows.count();
+
+    for (BrowserWindow *window : windows) {
+        QStringList tabKeys;
+        int currentTab = -1;
+
+        const int tabsCount = window->tabCount();
+        for (int i = 0; i < tabsCount; ++i) {
+            TabbedWebView *webView = window->weView(i);
+            WebTab *webTab = webView ? webView->webTab() : nullptr;
+            if (!webTab) {
+                continue;
+            }
+
+            TabRecord record = m_records.value(webTab);
+            const uint fingerprint = tabFingerprint(webTab);
+
+            if (record.key.isEmpty() || record.fingerprint != fingerprint) {
+                WebTab::SavedTab tab(webTab);
+                if (!tab.isValid()) {
+                    continue;
+                }
+
+                if (record.key.isEmpty()) {
+                    record.key = QString::number(m_nextKey++, 16);
+                }
+
+                QByteArray data;
+                QDataStream tabStream(&data, QIODevice::WriteOnly);
+                tabStream << tab;
+
+                if (!writeFile(tabFilePath(record.key), qCompress(data))) {
+                    continue;
+                }
+
+                record.fingerprint = fingerprint;
+                ++m_lastWrittenTabs;
+            }
+
+            if (webTab->isCurrentTab()) {
+                currentTab = tabKeys.count();
+            }
+
+            tabKeys.append(record.key);
+            records.insert(webTab, record);
+        }
+
+        stream << (window->isFullScreen() ? QByteArray() : window->saveState());
+        stream << window->saveGeometry();
+        stream << window->saveUiState();
+        stream << currentTab;
+        stream << tabKeys;
+    }
+
+    stream << (mApp->closedWindowsManager() ? mApp->closedWindowsManager()->saveState() : QByteArray());
+
+    if (index != m_lastIndex) {
+        if (!writeFile(indexFilePath(), index)) {
+            return;
+        }
+        m_lastIndex = index;
+    }
+
+    // Index no longer references records of closed tabs
+    for (auto it = m_records.constBegin(); it != m_records.constEnd(); ++it) {
+        if (!records.contains(it.key())) {
+            QFile::remove(tabFilePath(it.value().key));
+        }
+    }
+
+    for (const QString &fileName : qAsConst(m_staleKeys)) {
+        QFile::remove(m_path + QL1C('/') + fileName);
+    }
+    m_staleKeys.clear();
+
+    m_records = records;
+}
+
+void SessionStore::clear()
+{
+    m_records.clear();
+    m_lastIndex.clear();
+    m_staleKeys.clear();
+
+    QDir(m_path).removeRecursively();
+    QDir().mkpath(m_path);
+}
+
+uint SessionStore::tabFingerprint(WebTab *tab) const
+{
+    // Cheap to compute, unlike serializing navigation history
+    uint hash = qHash(tab->url()) ^ qHash(tab->title(true));
+    hash = hash * 31 + tab->tabIndex();
+    hash = hash * 31 + tab->zoomLevel();
+    hash = hash * 31 + (tab->isPinned() ? 1 : 0);
+    hash = hash * 31 + (tab->parentTab() ? tab->parentTab()->tabIndex() + 1 : 0);
+    hash = hash * 31 + tab->childTabs().count();
+    hash = hash * 31 + tab->sessionData().count();
+
+    if (tab->isRestored()) {
+        QWebEngineHistory *history = tab->history();
+        hash = hash * 31 + history->count();
+        hash = hash * 31 + history->currentItemIndex();
+    }
+
+    return hash;
+}
+
+bool SessionStore::writeFile(const QString &fileName, const QByteArray &data) const
+{
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) == -1 || !file.commit()) {
+        qWarning() << "SessionStore: Cannot write file" << fileName << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+QString SessionStore::tabFilePath(const QString &key) const
+{
+    return m_path + QL1S("/tab-") + key;
+}
+
+QString SessionStore::indexFilePath() const
+{
+    return m_path + QL1S("/session.idx");
+}
@@ -0,0 +1,73 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#pragma once
+
+#include <QObject>
+#include <QHash>
+
+#include "qzcommon.h"
+#include "restoremanager.h"
+
+class WebTab;
+
+// Incremental session store used for crash recovery.
+// Each tab is saved as its own compressed record, which is only rewritten
+// when the tab state changed since the last save. A small index file then
+// describes windows and references tab records.
+class QUPZILLA_EXPORT SessionStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SessionStore(const QString &path, QObject *parent = nullptr);
+
+    QString path() const;
+
+    // Reads session saved by last save()
+    RestoreData restoreData() const;
+
+    // Number of tab records written by last save()
+    int lastWrittenTabs() const;
+
+    // Nothing is saved until previous session is no longer needed for recovery,
+    // its records are then removed by next save()
+    void releasePreviousSession();
+
+public slots:
+    void save();
+    void clear();
+
+private:
+    struct TabRecord {
+        QString key;
+        uint fingerprint = 0;
+    };
+
+    uint tabFingerprint(WebTab *tab) const;
+    bool writeFile(const QString &fileName, const QByteArray &data) const;
+    QString tabFilePath(const QString &key) const;
+    QString indexFilePath() const;
+
+    QString m_path;
+    QHash<WebTab*, TabRecord> m_records;
+    QByteArray m_lastIndex;
+    QStringList m_staleKeys;
+    bool m_previousReleased;
+    quint64 m_nextKey;
+    int m_lastWrittenTabs;
+};
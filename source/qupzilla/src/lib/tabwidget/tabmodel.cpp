@@ -134,6 +134,9 @@ QVariant TabModel::data(const QModelIndex &index, int role) const
     case BackgroundActivityRole:
         return t->backgroundActivity();
 
+    case UrlRole:
+        return t->url();
+
     default:
         return QVariant();
     }
@@ -239,6 +242,7 @@ void TabModel::tabInserted(int index)
     connect(tab, &WebTab::titleChanged, this, std::bind(emitDataChanged, tab, TitleRole));
     connect(tab, &WebTab::iconChanged, this, std::bind(emitDataChanged, tab, Qt::DecorationRole));
     connect(tab, &WebTab::iconChanged, this, std::bind(emitDataChanged, tab, IconRole));
+    connect(tab, &WebTab::urlChanged, this, std::bind(emitDataChanged, tab, UrlRole));
     connect(tab, &WebTab::pinnedChanged, this, std::bind(emitDataChanged, tab, PinnedRole));
     connect(tab, &WebTab::restoredChanged, this, std::bind(emitDataChanged, tab, RestoredRole));
     connect(tab, &WebTab::currentTabChanged, this, std::bind(emitDataChanged, tab, CurrentTabRole));
@@ -60,7 +60,8 @@ public:
         LoadingRole = Qt::UserRole + 7,
         AudioPlayingRole = Qt::UserRole + 8,
         AudioMutedRole = Qt::UserRole + 9,
-        BackgroundActivityRole = Qt::UserRole + 10
+        BackgroundActivityRole = Qt::UserRole + 10,
+        UrlRole = Qt::UserRole + 11
     };
 
     explicit TabModel(BrowserWindow *window, QObject *parent = nullptr);
@@ -32,6 +32,7 @@
 #include "qztools.h"
 #include "tabicon.h"
 #include "pluginproxy.h"
+#include "tracerecorder.h"
 
 #include <QFile>
 #include <QTimer>
@@ -41,21 +42,6 @@
 #include <QWebEngineHistory>
 #include <QClipboard>
 
-#include <iostream>
-#include <cstdio>
-#include <sys/stat.h>
-
-static bool twLoggingEnabled() {
-    struct stat st;
-    return (stat("/media/internal/qupzilla/enable_logging", &st) == 0);
-}
-
-static void twLog(const char* msg) {
-    if (!twLoggingEnabled()) return;
-    FILE* f = fopen("/media/internal/qupzilla/startup.log", "a");
-    if (f) { fprintf(f, "%s\n", msg); fclose(f); }
-}
-
 AddTabButton::AddTabButton(TabWidget* tabWidget, TabBar* tabBar)
     : ToolButton(tabBar)
     , m_tabBar(tabBar)
@@ -304,8 +290,8 @@ void TabWidget::aboutToShowClosedTabsMenu()
     const auto closedTabs = closedTabsManager()->closedTabs();
     for (int i = 0; i < closedTabs.count(); ++i) {
         const ClosedTabsManager::Tab tab = closedTabs.at(i);
-        const QString title = QzTools::truncatedText(tab.tabState.title, 40);
-        m_menuClosedTabs->addAction(tab.tabState.icon, title, this, SLOT(restoreClosedTab()))->setData(i);
+        const QString title = QzTools::truncatedText(tab.title, 40);
+        m_menuClosedTabs->addAction(tab.icon, title, this, SLOT(restoreClosedTab()))->setData(i);
     }
 
     if (m_menuClosedTabs->isEmpty()) {
@@ -366,9 +352,9 @@ int TabWidget::addView(const LoadRequest &req, const QString &title, const Qz::N
     m_locationBars->addWidget(webTab->locationBar());
 
     int index = insertTab(position == -1 ? count() : position, webTab, QString(), pinned);
-    twLog("[TABWIDGET] insertTab done, calling attach...");
+    TraceRecorder::instance()->beginEvent("WebTab::attach", "tabs");
     webTab->attach(m_window);
-    twLog("[TABWIDGET] attach done");
+    TraceRecorder::instance()->endEvent("WebTab::attach", "tabs");
 
     // In PORTABLE_BUILD, attach() creates the WebView. If this tab is already selected
     // (which happens when insertTab triggered currentChanged), we need to notify
@@ -376,7 +362,6 @@ int TabWidget::addView(const LoadRequest &req, const QString &title, const Qz::N
     // Only refresh the NavigationBar - don't call full currentTabChanged() as that
     // includes setTabOrder which can crash during early initialization.
     if (currentIndex() == index && webTab->webView()) {
-        twLog("[TABWIDGET] Refreshing NavigationBar with new WebView");
         m_window->navigationBar()->setCurrentView(webTab->webView());
     }
 
@@ -814,8 +799,11 @@ void TabWidget::restoreAllClosedTabs()
         return;
     }
 
-    const auto closedTabs = m_closedTabsManager->closedTabs();
-    for (const ClosedTabsManager::Tab &tab : closedTabs) {
+    while (m_closedTabsManager->isClosedTabAvailable()) {
+        const ClosedTabsManager::Tab tab = m_closedTabsManager->takeLastClosedTab();
+        if (!tab.isValid()) {
+            continue;
+        }
         int index = addView(QUrl(), tab.tabState.title, Qz::NT_CleanSelectedTab);
         WebTab* webTab = weTab(index);
         webTab->p_restoreTab(tab.tabState);
@@ -873,10 +861,15 @@ bool TabWidget::restoreState(const QVector<WebTab::SavedTab> &tabs, int currentT
 
     QVector<QPair<WebTab*, QVector<int>>> childTabs;
 
+    // Saved indices are relative to restored tabs, there may already be other tabs
+    QVector<WebTab*> restoredTabs;
+    restoredTabs.reserve(tabs.size());
+
     for (int i = 0; i < tabs.size(); ++i) {
         WebTab::SavedTab tab = tabs.at(i);
         WebTab *webTab = weTab(addView(QUrl(), Qz::NT_CleanSelectedTab, false, tab.isPinned));
         webTab->restoreTab(tab);
+        restoredTabs.append(webTab);
         if (!tab.childTabs.isEmpty()) {
             childTabs.append({webTab, tab.childTabs});
         }
@@ -885,14 +878,16 @@ bool TabWidget::restoreState(const QVector<WebTab::SavedTab> &tabs, int currentT
     for (const auto p : qAsConst(childTabs)) {
         const auto indices = p.second;
         for (int index : indices) {
-            WebTab *t = weTab(index);
+            WebTab *t = restoredTabs.value(index);
             if (t) {
                 p.first->addChildTab(t);
             }
         }
     }
 
-    setCurrentIndex(currentTab);
+    if (WebTab *current = restoredTabs.value(currentTab)) {
+        setCurrentIndex(current->tabIndex());
+    }
     QTimer::singleShot(0, m_tabBar, SLOT(ensureVisible(int,int)));
 
     weTab()->tabActivated();
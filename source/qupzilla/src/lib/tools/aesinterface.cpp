@@ -27,7 +27,6 @@
 
 #include <QCryptographicHash>
 #include <QByteArray>
-#include <QMessageBox>
 
 //////////////////////////////////////////////
 /// Version 1:
@@ -38,6 +37,7 @@ const int AesInterface::VERSION = 1;
 AesInterface::AesInterface(QObject* parent)
     : QObject(parent)
     , m_ok(false)
+    , m_hasKey(false)
 {
     m_encodeCTX = EVP_CIPHER_CTX_new();
     m_decodeCTX = EVP_CIPHER_CTX_new();
@@ -47,6 +47,7 @@ AesInterface::AesInterface(QObject* parent)
 
 AesInterface::~AesInterface()
 {
+    clearKey();
     EVP_CIPHER_CTX_cleanup(m_encodeCTX);
     EVP_CIPHER_CTX_cleanup(m_decodeCTX);
     EVP_CIPHER_CTX_free(m_encodeCTX);
@@ -58,34 +59,67 @@ bool AesInterface::isOk()
     return m_ok;
 }
 
-// Create an 256 bit 'key' using the supplied password, and creates a random 'iv'.
-// saltArray is an array of 8 bytes can be added for taste.
-// Fills in the encryption and decryption ctx objects and returns true on success
-bool AesInterface::init(int evpMode, const QByteArray &password, const QByteArray &iVector)
+QString AesInterface::errorString() const
 {
-    m_iVector.clear();
+    return m_errorString;
+}
+
+void AesInterface::clearKey()
+{
+    memset(m_key, 0, sizeof(m_key));
+    m_keyPassword.fill(0);
+    m_keyPassword.clear();
+    m_hasKey = false;
+}
+
+bool AesInterface::deriveKey(const QByteArray &password)
+{
+    if (m_hasKey && m_keyPassword == password) {
+        return true;
+    }
+
+    clearKey();
 
-    int i;
     const int nrounds = 5;
-    uchar key[EVP_MAX_KEY_LENGTH];
 
     // Gen "key" for AES 256 CBC mode. A SHA1 digest is used to hash the supplied
     // key material. nrounds is the number of times that we hash the material.
     // More rounds are more secure but slower.
-    i = EVP_BytesToKey(EVP_aes_256_cbc(), EVP_sha256(), 0, (uchar*)password.data(), password.size(), nrounds, key, 0);
+    int i = EVP_BytesToKey(EVP_aes_256_cbc(), EVP_sha256(), 0, (uchar*)password.data(), password.size(), nrounds, m_key, 0);
 
     if (i != 32) {
         qWarning("Key size is %d bits - should be 256 bits", i * 8);
         return false;
     }
 
+    m_keyPassword = password;
+    m_hasKey = true;
+    return true;
+}
+
+// Create an 256 bit 'key' using the supplied password, and creates a random 'iv'.
+// saltArray is an array of 8 bytes can be added for taste.
+// Fills in the encryption and decryption ctx objects and returns true on success
+bool AesInterface::init(int evpMode, const QByteArray &password, const QByteArray &iVector)
+{
+    m_iVector.clear();
+
+    if (!deriveKey(password)) {
+        return false;
+    }
+
+    // Contexts are reused, only key and IV are set again
     int result = 0;
     if (evpMode == EVP_PKEY_MO_ENCRYPT) {
         m_iVector = createRandomData(EVP_MAX_IV_LENGTH);
-        result = EVP_EncryptInit_ex(m_encodeCTX, EVP_aes_256_cbc(), NULL, key, (uchar*)m_iVector.constData());
+        result = EVP_EncryptInit_ex(m_encodeCTX, EVP_aes_256_cbc(), NULL, m_key, (uchar*)m_iVector.constData());
     }
     else if (evpMode == EVP_PKEY_MO_DECRYPT) {
-        result = EVP_DecryptInit_ex(m_decodeCTX, EVP_aes_256_cbc(), NULL, key, (uchar*)iVector.constData());
+        if (iVector.size() < EVP_CIPHER_iv_length(EVP_aes_256_cbc())) {
+            qWarning("Decrypt error: Initialization vector is too short");
+            return false;
+        }
+        result = EVP_DecryptInit_ex(m_decodeCTX, EVP_aes_256_cbc(), NULL, m_key, (uchar*)iVector.constData());
     }
 
     if (result == 0) {
@@ -107,7 +141,8 @@ QByteArray AesInterface::encrypt(const QByteArray &plainData, const QByteArray &
     int dataLength = plainData.size();
     int cipherlength = dataLength + AES_BLOCK_SIZE;
     int finalLength = 0;
-    uchar* ciphertext = (uchar*)malloc(cipherlength);
+    QByteArray cipherArray(cipherlength, Qt::Uninitialized);
+    uchar* ciphertext = (uchar*)cipherArray.data();
 
     // allows reusing of 'm_encodeCTX' for multiple encryption cycles
     EVP_EncryptInit_ex(m_encodeCTX, NULL, NULL, NULL, NULL);
@@ -119,10 +154,8 @@ QByteArray AesInterface::encrypt(const QByteArray &plainData, const QByteArray &
     // update ciphertext with the final remaining bytes
     EVP_EncryptFinal_ex(m_encodeCTX, ciphertext + cipherlength, &finalLength);
 
-    dataLength = cipherlength + finalLength;
-    QByteArray out((char*)ciphertext, dataLength);
-    out = QByteArray::number(AesInterface::VERSION) + '$' + m_iVector.toBase64() + '$' + out.toBase64();
-    free(ciphertext);
+    cipherArray.truncate(cipherlength + finalLength);
+    QByteArray out = QByteArray::number(AesInterface::VERSION) + '$' + m_iVector.toBase64() + '$' + cipherArray.toBase64();
 
     m_ok = true;
     return out;
@@ -131,50 +164,54 @@ QByteArray AesInterface::encrypt(const QByteArray &plainData, const QByteArray &
 QByteArray AesInterface::decrypt(const QByteArray &cipherData, const QByteArray &password)
 {
     m_ok = false;
+    m_errorString.clear();
 
     if (cipherData.isEmpty()) {
         m_ok = true;
         return QByteArray();
     }
 
-    QList<QByteArray> cipherSections(cipherData.split('$'));
-    if (cipherSections.size() != 3) {
+    // Version$InitializationVector_base64$EncryptedData_base64
+    const int ivStart = cipherData.indexOf('$') + 1;
+    const int dataStart = ivStart > 0 ? cipherData.indexOf('$', ivStart) + 1 : 0;
+    if (ivStart == 0 || dataStart == 0 || cipherData.indexOf('$', dataStart) != -1) {
         qWarning() << "Decrypt error: It seems data is corrupted";
         return QByteArray();
     }
 
-    if (cipherSections.at(0).toInt() > AesInterface::VERSION) {
-        QMessageBox::information(0, tr("Warning!"), tr("Data has been encrypted with a newer version of QupZilla."
-                                 "\nPlease install latest version of QupZilla."));
+    const int version = cipherData.left(ivStart - 1).toInt();
+
+    // May be called from worker thread, caller shows the message
+    if (version > AesInterface::VERSION) {
+        m_errorString = tr("Data has been encrypted with a newer version of QupZilla."
+                           "\nPlease install latest version of QupZilla.");
         return QByteArray();
     }
 
-    if (cipherSections.at(0).toInt() != 1) {
+    if (version != 1) {
         qWarning() << Q_FUNC_INFO << "There is just version 1 of decoder, yet ;-)";
         return QByteArray();
     }
 
-    if (!init(EVP_PKEY_MO_DECRYPT, password, QByteArray::fromBase64(cipherSections.at(1)))) {
+    if (!init(EVP_PKEY_MO_DECRYPT, password, QByteArray::fromBase64(cipherData.mid(ivStart, dataStart - ivStart - 1)))) {
         return QByteArray();
     }
 
-    QByteArray cipherArray = QByteArray::fromBase64(cipherSections.at(2));
+    QByteArray cipherArray = QByteArray::fromBase64(QByteArray::fromRawData(cipherData.constData() + dataStart, cipherData.size() - dataStart));
     int cipherLength = cipherArray.size();
     int plainTextLength = cipherLength;
     int finalLength = 0;
 
     uchar* cipherText = (uchar*)cipherArray.data();
     // because we have padding ON, we must allocate an extra cipher block size of memory
-    uchar* plainText = (uchar*)malloc(plainTextLength + AES_BLOCK_SIZE);
+    QByteArray result(plainTextLength + AES_BLOCK_SIZE, Qt::Uninitialized);
+    uchar* plainText = (uchar*)result.data();
 
     EVP_DecryptInit_ex(m_decodeCTX, NULL, NULL, NULL, NULL);
     EVP_DecryptUpdate(m_decodeCTX, plainText, &plainTextLength, cipherText, cipherLength);
     int success = EVP_DecryptFinal_ex(m_decodeCTX, plainText + plainTextLength, &finalLength);
 
-    cipherLength = plainTextLength + finalLength;
-
-    QByteArray result((char*)plainText, cipherLength);
-    free(plainText);
+    result.truncate(plainTextLength + finalLength);
 
     if (success != 1) {
         return QByteArray();
@@ -40,20 +40,33 @@ public:
     ~AesInterface();
 
     bool isOk();
+    // Message for user about last failed decrypt(), empty if there is nothing to show
+    QString errorString() const;
 
     QByteArray encrypt(const QByteArray &plainData, const QByteArray &password);
     QByteArray decrypt(const QByteArray &cipherData, const QByteArray &password);
 
+    // Forgets the key derived from last used password
+    void clearKey();
+
     static QByteArray passwordToHash(const QString &masterPassword);
     static QByteArray createRandomData(int length);
 
 private:
     bool init(int evpMode, const QByteArray &password, const QByteArray &iVector = QByteArray());
+    bool deriveKey(const QByteArray &password);
 
     EVP_CIPHER_CTX* m_encodeCTX;
     EVP_CIPHER_CTX* m_decodeCTX;
 
     bool m_ok;
+    QString m_errorString;
     QByteArray m_iVector;
+
+    // Key derivation is the same for all data encrypted with one password,
+    // so it is only done when the password changes
+    bool m_hasKey;
+    QByteArray m_keyPassword;
+    uchar m_key[EVP_MAX_KEY_LENGTH];
 };
 #endif //AESINTERFACE_H
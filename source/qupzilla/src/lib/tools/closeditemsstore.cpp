@@ -0,0 +1,123 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "closeditemsstore.h"
+
+#include <QDir>
+#include <QFile>
+#include <QDateTime>
+#include <QSaveFile>
+#include <QDebug>
+
+ClosedItemsStore::ClosedItemsStore(const QString &path, int capacity)
+    : m_path(path)
+    , m_capacity(capacity)
+{
+}
+
+QString ClosedItemsStore::path() const
+{
+    return m_path;
+}
+
+int ClosedItemsStore::capacity() const
+{
+    return m_capacity;
+}
+
+QString ClosedItemsStore::store(const QByteArray &data)
+{
+    QDir().mkpath(m_path);
+
+    // Keys sort in order of creation
+    static int counter = 0;
+    counter = (counter + 1) % 1000000;
+    const QString key = QSL("%1-%2").arg(QDateTime::currentMSecsSinceEpoch(), 14, 10, QL1C('0')).arg(counter, 6, 10, QL1C('0'));
+
+    QSaveFile file(filePath(key));
+    if (!file.open(QFile::WriteOnly)) {
+        qWarning() << "ClosedItemsStore: Cannot open file for writing" << file.fileName();
+        return QString();
+    }
+
+    file.write(qCompress(data));
+    if (!file.commit()) {
+        qWarning() << "ClosedItemsStore: Cannot write file" << file.fileName();
+        return QString();
+    }
+
+    // Drop oldest entries over capacity, this also cleans entries
+    // orphaned by managers that did not get a chance to remove them
+    QStringList keys = storedKeys();
+    while (keys.count() > m_capacity) {
+        QFile::remove(filePath(keys.takeLast()));
+    }
+
+    return key;
+}
+
+QByteArray ClosedItemsStore::load(const QString &key) const
+{
+    if (key.isEmpty()) {
+        return QByteArray();
+    }
+
+    QFile file(filePath(key));
+    if (!file.open(QFile::ReadOnly)) {
+        return QByteArray();
+    }
+
+    return qUncompress(file.readAll());
+}
+
+bool ClosedItemsStore::contains(const QString &key) const
+{
+    return !key.isEmpty() && QFile::exists(filePath(key));
+}
+
+void ClosedItemsStore::remove(const QString &key)
+{
+    if (!key.isEmpty()) {
+        QFile::remove(filePath(key));
+    }
+}
+
+void ClosedItemsStore::prune(const QStringList &keys)
+{
+    const QStringList stored = storedKeys();
+    for (const QString &key : stored) {
+        if (!keys.contains(key)) {
+            QFile::remove(filePath(key));
+        }
+    }
+}
+
+void ClosedItemsStore::clear()
+{
+    QDir(m_path).removeRecursively();
+}
+
+QString ClosedItemsStore::filePath(const QString &key) const
+{
+    return m_path + QLatin1Char('/') + key;
+}
+
+QStringList ClosedItemsStore::storedKeys() const
+{
+    // Newest first
+    return QDir(m_path).entryList(QDir::Files, QDir::Name | QDir::Reversed);
+}
@@ -0,0 +1,53 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+#include "qzcommon.h"
+
+// Compressed on-disk store for state of closed tabs and windows.
+// Only lightweight summaries are kept in memory by the managers, full
+// state blobs are written here and loaded back on restore.
+// Store keeps at most capacity() entries, oldest entries are dropped first.
+class QUPZILLA_EXPORT ClosedItemsStore
+{
+public:
+    explicit ClosedItemsStore(const QString &path, int capacity);
+
+    QString path() const;
+    int capacity() const;
+
+    // Returns key that can be used to load the data later
+    QString store(const QByteArray &data);
+    QByteArray load(const QString &key) const;
+    bool contains(const QString &key) const;
+    void remove(const QString &key);
+
+    // Removes all entries not present in keys
+    void prune(const QStringList &keys);
+    void clear();
+
+private:
+    QString filePath(const QString &key) const;
+    QStringList storedKeys() const;
+
+    QString m_path;
+    int m_capacity;
+};
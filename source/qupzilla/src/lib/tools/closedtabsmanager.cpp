@@ -17,14 +17,43 @@
 * ============================================================ */
 #include "closedtabsmanager.h"
 #include "mainapplication.h"
+#include "iconprovider.h"
+#include "datapaths.h"
 #include "qztools.h"
 
+#include <QDir>
+#include <QUuid>
+#include <QDataStream>
 #include <QWebEngineHistory>
 
+// Only summaries are kept in memory, so we can afford to remember a lot of tabs
+static const int maxClosedTabs = 500;
+
+static QString createStorePath()
+{
+    const QString storesPath = DataPaths::path(DataPaths::Temp) + QL1S("/closedtabs");
+
+    // Stores are only left behind after a crash, remove them once
+    // before the first manager of this run creates its own store
+    static bool orphansRemoved = false;
+    if (!orphansRemoved) {
+        orphansRemoved = true;
+        QDir(storesPath).removeRecursively();
+    }
+
+    return QSL("%1/%2").arg(storesPath, QUuid::createUuid().toString().mid(1, 36));
+}
+
 ClosedTabsManager::ClosedTabsManager()
+    : m_store(createStorePath(), maxClosedTabs)
 {
 }
 
+ClosedTabsManager::~ClosedTabsManager()
+{
+    m_store.clear();
+}
+
 void ClosedTabsManager::saveTab(WebTab *tab)
 {
     if (mApp->isPrivate()) {
@@ -36,15 +65,27 @@ void ClosedTabsManager::saveTab(WebTab *tab)
         return;
     }
 
+    const WebTab::SavedTab tabState(tab);
+
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << tabState;
+
     Tab closedTab;
     closedTab.position = tab->tabIndex();
-    closedTab.tabState = WebTab::SavedTab(tab);
+    closedTab.title = tabState.title;
+    closedTab.url = tabState.url;
+    closedTab.icon = tabState.icon.isNull() ? IconProvider::emptyWebIcon() : tabState.icon;
+    closedTab.storeKey = m_store.store(data);
+
+    if (closedTab.storeKey.isEmpty()) {
+        return;
+    }
+
     m_closedTabs.prepend(closedTab);
 
-    // Limit closed tabs to save memory (webOS optimization)
-    const int maxClosedTabs = 10;
     while (m_closedTabs.size() > maxClosedTabs) {
-        m_closedTabs.removeLast();
+        m_store.remove(m_closedTabs.takeLast().storeKey);
     }
 }
 
@@ -55,20 +96,12 @@ bool ClosedTabsManager::isClosedTabAvailable() const
 
 ClosedTabsManager::Tab ClosedTabsManager::takeLastClosedTab()
 {
-    Tab tab;
-    if (!m_closedTabs.isEmpty()) {
-        tab = m_closedTabs.takeFirst();
-    }
-    return tab;
+    return takeTab(0);
 }
 
 ClosedTabsManager::Tab ClosedTabsManager::takeTabAt(int index)
 {
-    Tab tab;
-    if (QzTools::containsIndex(m_closedTabs, index)) {
-        tab = m_closedTabs.takeAt(index);
-    }
-    return tab;
+    return takeTab(index);
 }
 
 QVector<ClosedTabsManager::Tab> ClosedTabsManager::closedTabs() const
@@ -79,4 +112,24 @@ QVector<ClosedTabsManager::Tab> ClosedTabsManager::closedTabs() const
 void ClosedTabsManager::clearClosedTabs()
 {
     m_closedTabs.clear();
+    m_store.clear();
+}
+
+ClosedTabsManager::Tab ClosedTabsManager::takeTab(int index)
+{
+    if (!QzTools::containsIndex(m_closedTabs, index)) {
+        return Tab();
+    }
+
+    Tab tab = m_closedTabs.takeAt(index);
+
+    QDataStream stream(m_store.load(tab.storeKey));
+    stream >> tab.tabState;
+    m_store.remove(tab.storeKey);
+
+    if (!tab.tabState.isValid()) {
+        tab.position = -1;
+    }
+
+    return tab;
 }
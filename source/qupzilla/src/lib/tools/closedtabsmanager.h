@@ -22,6 +22,7 @@
 
 #include "webtab.h"
 #include "qzcommon.h"
+#include "closeditemsstore.h"
 
 class WebTab;
 
@@ -30,6 +31,11 @@ class QUPZILLA_EXPORT ClosedTabsManager
 public:
     struct Tab {
         int position = -1;
+        QString title;
+        QUrl url;
+        QIcon icon;
+        QString storeKey;
+        // Full state is only loaded from store by take functions
         WebTab::SavedTab tabState;
 
         bool isValid() const {
@@ -38,6 +44,7 @@ public:
     };
 
     explicit ClosedTabsManager();
+    ~ClosedTabsManager();
 
     void saveTab(WebTab *tab);
     bool isClosedTabAvailable() const;
@@ -51,7 +58,10 @@ public:
     void clearClosedTabs();
 
 private:
+    Tab takeTab(int index);
+
     QVector<Tab> m_closedTabs;
+    ClosedItemsStore m_store;
 };
 
 // Hint to Qt to use std::realloc on item moving
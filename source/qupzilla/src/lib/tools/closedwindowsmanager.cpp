@@ -18,12 +18,18 @@
 #include "closedwindowsmanager.h"
 #include "mainapplication.h"
 #include "tabbedwebview.h"
+#include "iconprovider.h"
+#include "datapaths.h"
 #include "qztools.h"
 
 #include <QAction>
 
+// Only summaries are kept in memory, full window states are stored on disk
+static const int maxClosedWindows = 100;
+
 ClosedWindowsManager::ClosedWindowsManager(QObject *parent)
     : QObject(parent)
+    , m_store(DataPaths::currentProfilePath() + QL1S("/closedwindows"), maxClosedWindows)
 {
 }
 
@@ -43,29 +49,35 @@ void ClosedWindowsManager::saveWindow(BrowserWindow *window)
         return;
     }
 
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << BrowserWindow::SavedWindow(window);
+
     Window closedWindow;
-    closedWindow.icon = window->weView()->icon();
     closedWindow.title = window->weView()->title();
-    closedWindow.windowState = BrowserWindow::SavedWindow(window);
+    closedWindow.url = window->weView()->url();
+    closedWindow.icon = window->weView()->icon();
+    closedWindow.storeKey = m_store.store(data);
+
+    if (!closedWindow.isValid()) {
+        return;
+    }
+
     m_closedWindows.prepend(closedWindow);
+
+    while (m_closedWindows.size() > maxClosedWindows) {
+        m_store.remove(m_closedWindows.takeLast().storeKey);
+    }
 }
 
 ClosedWindowsManager::Window ClosedWindowsManager::takeLastClosedWindow()
 {
-    Window window;
-    if (!m_closedWindows.isEmpty()) {
-        window = m_closedWindows.takeFirst();
-    }
-    return window;
+    return takeWindow(0);
 }
 
 ClosedWindowsManager::Window ClosedWindowsManager::takeClosedWindowAt(int index)
 {
-    Window window;
-    if (QzTools::containsIndex(m_closedWindows, index)) {
-        window = m_closedWindows.takeAt(index);
-    }
-    return window;
+    return takeWindow(index);
 }
 
 void ClosedWindowsManager::restoreClosedWindow()
@@ -78,7 +90,7 @@ void ClosedWindowsManager::restoreClosedWindow()
         window = takeLastClosedWindow();
     }
 
-    if (!window.isValid()) {
+    if (!window.isValid() || !window.windowState.isValid()) {
         return;
     }
 
@@ -96,9 +108,10 @@ void ClosedWindowsManager::restoreAllClosedWindows()
 void ClosedWindowsManager::clearClosedWindows()
 {
     m_closedWindows.clear();
+    m_store.clear();
 }
 
-static const int closedWindowsVersion = 1;
+static const int closedWindowsVersion = 3;
 
 QByteArray ClosedWindowsManager::saveState() const
 {
@@ -107,12 +120,14 @@ QByteArray ClosedWindowsManager::saveState() const
 
     stream << closedWindowsVersion;
 
-    // Only save last 3 windows
-    const int windowCount = qBound(0, m_closedWindows.count(), 3);
-    stream << windowCount;
+    // Window states are already on disk, only save summaries
+    stream << m_closedWindows.count();
 
-    for (int i = 0; i < windowCount; ++i) {
-        stream << m_closedWindows.at(i).windowState;
+    for (const Window &window : m_closedWindows) {
+        stream << window.title;
+        stream << window.url;
+        stream << window.icon;
+        stream << window.storeKey;
     }
 
     return data;
@@ -135,14 +150,71 @@ void ClosedWindowsManager::restoreState(const QByteArray &state)
     stream >> windowCount;
     m_closedWindows.reserve(windowCount);
 
+    QStringList keys;
+
     for (int i = 0; i < windowCount; ++i) {
         Window window;
-        stream >> window.windowState;
+
+        if (version == 1) {
+            // Move full window states from session file to store
+            BrowserWindow::SavedWindow windowState;
+            stream >> windowState;
+            if (!windowState.isValid()) {
+                continue;
+            }
+
+            QByteArray data;
+            QDataStream dataStream(&data, QIODevice::WriteOnly);
+            dataStream << windowState;
+
+            window.title = windowState.tabs.at(0).title;
+            window.url = windowState.tabs.at(0).url;
+            window.icon = windowState.tabs.at(0).icon;
+            window.storeKey = m_store.store(data);
+        } else {
+            stream >> window.title;
+            stream >> window.url;
+            if (version > 2) {
+                stream >> window.icon;
+            }
+            stream >> window.storeKey;
+
+            if (!m_store.contains(window.storeKey)) {
+                continue;
+            }
+
+            // Icons were not saved in summaries before version 3
+            if (version == 2) {
+                window.icon = IconProvider::iconForUrl(window.url);
+            }
+        }
+
+        if (window.icon.isNull()) {
+            window.icon = IconProvider::emptyWebIcon();
+        }
+
         if (!window.isValid()) {
             continue;
         }
-        window.icon = window.windowState.tabs.at(0).icon;
-        window.title = window.windowState.tabs.at(0).title;
+
+        keys.append(window.storeKey);
         m_closedWindows.append(window);
     }
+
+    m_store.prune(keys);
+}
+
+ClosedWindowsManager::Window ClosedWindowsManager::takeWindow(int index)
+{
+    if (!QzTools::containsIndex(m_closedWindows, index)) {
+        return Window();
+    }
+
+    Window window = m_closedWindows.takeAt(index);
+
+    QDataStream stream(m_store.load(window.storeKey));
+    stream >> window.windowState;
+    m_store.remove(window.storeKey);
+
+    return window;
 }
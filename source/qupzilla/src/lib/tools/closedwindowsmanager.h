@@ -22,6 +22,7 @@
 
 #include "qzcommon.h"
 #include "browserwindow.h"
+#include "closeditemsstore.h"
 
 class QUPZILLA_EXPORT ClosedWindowsManager : public QObject
 {
@@ -29,12 +30,15 @@ class QUPZILLA_EXPORT ClosedWindowsManager : public QObject
 
 public:
     struct Window {
-        QIcon icon;
         QString title;
+        QUrl url;
+        QIcon icon;
+        QString storeKey;
+        // Full state is only loaded from store by take functions
         BrowserWindow::SavedWindow windowState;
 
         bool isValid() const {
-            return windowState.isValid();
+            return !storeKey.isEmpty();
         }
     };
 
@@ -59,7 +63,10 @@ public slots:
     void clearClosedWindows();
 
 private:
+    Window takeWindow(int index);
+
     QVector<Window> m_closedWindows;
+    ClosedItemsStore m_store;
 };
 
 // Hint to Qt to use std::realloc on item moving
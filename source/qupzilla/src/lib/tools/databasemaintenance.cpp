@@ -0,0 +1,406 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "databasemaintenance.h"
+#include "sqldatabase.h"
+#include "qztools.h"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QSqlError>
+#include <QThread>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+// Rows deleted in one statement, keeps the write lock short
+static const int s_deleteChunkSize = 500;
+// Pause between chunks so the main thread connection can write
+static const int s_chunkPauseMsecs = 5;
+// Time without user input after which Idle jobs are started
+static const int s_idleDelayMsecs = 5000;
+// VACUUM is only worth it when this many pages (percent and absolute) are free
+static const int s_vacuumFreelistPercent = 20;
+static const int s_vacuumMinFreePages = 64;
+
+Q_GLOBAL_STATIC(DatabaseMaintenance, qz_database_maintenance)
+
+DatabaseMaintenance::DatabaseMaintenance(QObject* parent)
+    : QObject(parent)
+    , m_running(false)
+    , m_idleReady(false)
+    , m_watchingInput(false)
+    , m_lastId(0)
+    , m_cancelled(0)
+    , m_idleTimer(new QTimer(this))
+    , m_watcher(new QFutureWatcher<int>(this))
+{
+    // Jobs must not run concurrently, they share one database connection
+    m_worker.setMaxThreadCount(1);
+
+    m_idleTimer->setSingleShot(true);
+    m_idleTimer->setInterval(s_idleDelayMsecs);
+
+    connect(m_idleTimer, &QTimer::timeout, this, &DatabaseMaintenance::idleTimeout);
+    connect(m_watcher, &QFutureWatcher<int>::finished, this, &DatabaseMaintenance::currentJobFinished);
+}
+
+DatabaseMaintenance::~DatabaseMaintenance()
+{
+    m_cancelled.store(1);
+    m_worker.waitForDone();
+}
+
+DatabaseMaintenance* DatabaseMaintenance::instance()
+{
+    return qz_database_maintenance();
+}
+
+int DatabaseMaintenance::deleteRows(const QString &table, const QString &condition, const QVariantList &values, Priority priority)
+{
+    Job job;
+    job.type = DeleteRowsJob;
+    job.priority = priority;
+    job.table = table;
+    job.condition = condition;
+    job.values = values;
+
+    return addJob(job);
+}
+
+int DatabaseMaintenance::removeDirectories(const QStringList &paths, Priority priority)
+{
+    Job job;
+    job.type = RemoveDirectoriesJob;
+    job.priority = priority;
+    job.paths = paths;
+
+    return addJob(job);
+}
+
+int DatabaseMaintenance::optimize(Priority priority)
+{
+    foreach (const Job &job, m_jobs) {
+        if (job.type == OptimizeJob) {
+            return job.id;
+        }
+    }
+
+    Job job;
+    job.type = OptimizeJob;
+    job.priority = priority;
+
+    return addJob(job);
+}
+
+bool DatabaseMaintenance::isBusy() const
+{
+    return m_running || !m_jobs.isEmpty();
+}
+
+void DatabaseMaintenance::cancel(int id)
+{
+    if (m_running && m_currentJob.id == id) {
+        m_cancelled.store(1);
+        return;
+    }
+
+    for (int i = 0; i < m_jobs.count(); ++i) {
+        if (m_jobs.at(i).id == id) {
+            m_jobs.remove(i);
+            emit jobFinished(id, 0, true);
+            break;
+        }
+    }
+}
+
+void DatabaseMaintenance::cancelAll()
+{
+    const QVector<Job> jobs = m_jobs;
+    m_jobs.clear();
+
+    if (m_running) {
+        m_cancelled.store(1);
+    }
+
+    foreach (const Job &job, jobs) {
+        emit jobFinished(job.id, 0, true);
+    }
+}
+
+void DatabaseMaintenance::shutdown()
+{
+    m_idleTimer->stop();
+    setIdleWatching(false);
+
+    QVector<Job> immediate;
+    QVector<Job> cancelled;
+    foreach (const Job &job, m_jobs) {
+        if (job.priority == Immediate) {
+            immediate.append(job);
+        }
+        else {
+            cancelled.append(job);
+        }
+    }
+    m_jobs.clear();
+
+    if (m_running) {
+        if (m_currentJob.priority == Idle) {
+            m_cancelled.store(1);
+        }
+        m_watcher->waitForFinished();
+        m_running = false;
+        emit jobFinished(m_currentJob.id, m_watcher->result(), m_cancelled.load());
+    }
+
+    foreach (const Job &job, cancelled) {
+        emit jobFinished(job.id, 0, true);
+    }
+
+    foreach (const Job &job, immediate) {
+        m_cancelled.store(0);
+        emit jobFinished(job.id, runJob(job), false);
+    }
+}
+
+bool DatabaseMaintenance::eventFilter(QObject* obj, QEvent* event)
+{
+    switch (event->type()) {
+    case QEvent::KeyPress:
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseMove:
+    case QEvent::Wheel:
+    case QEvent::TouchBegin:
+        m_idleReady = false;
+        m_idleTimer->start();
+        break;
+
+    default:
+        break;
+    }
+
+    return QObject::eventFilter(obj, event);
+}
+
+void DatabaseMaintenance::idleTimeout()
+{
+    m_idleReady = true;
+    startNext();
+}
+
+void DatabaseMaintenance::currentJobFinished()
+{
+    // Already handled in shutdown()
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+
+    const Job job = m_currentJob;
+    const bool cancelled = m_cancelled.load();
+    emit jobFinished(job.id, m_watcher->result(), cancelled);
+
+    // Check whether the deleted rows left enough free pages for VACUUM
+    if (job.type == DeleteRowsJob && !cancelled) {
+        optimize(Idle);
+    }
+
+    startNext();
+
+    if (!isBusy()) {
+        emit idle();
+    }
+}
+
+int DatabaseMaintenance::addJob(Job job)
+{
+    job.id = ++m_lastId;
+    m_jobs.append(job);
+
+    startNext();
+    return job.id;
+}
+
+void DatabaseMaintenance::startNext()
+{
+    if (m_running) {
+        return;
+    }
+
+    int index = -1;
+    bool hasIdleJobs = false;
+
+    for (int i = 0; i < m_jobs.count(); ++i) {
+        if (m_jobs.at(i).priority == Immediate) {
+            index = i;
+            break;
+        }
+        hasIdleJobs = true;
+    }
+
+    if (index == -1 && hasIdleJobs) {
+        if (m_idleReady) {
+            index = 0;
+        }
+        else if (!m_idleTimer->isActive()) {
+            m_idleTimer->start();
+        }
+    }
+
+    if (index == -1) {
+        setIdleWatching(hasIdleJobs);
+        return;
+    }
+
+    m_currentJob = m_jobs.takeAt(index);
+    m_running = true;
+    m_cancelled.store(0);
+
+    setIdleWatching(m_currentJob.priority == Idle || hasIdleJobs);
+
+    m_watcher->setFuture(QtConcurrent::run(&m_worker, this, &DatabaseMaintenance::runJob, m_currentJob));
+}
+
+void DatabaseMaintenance::setIdleWatching(bool enable)
+{
+    if (m_watchingInput == enable) {
+        return;
+    }
+
+    m_watchingInput = enable;
+
+    // Filtering all application events is only needed while Idle jobs are waiting
+    if (enable) {
+        qApp->installEventFilter(this);
+    }
+    else {
+        qApp->removeEventFilter(this);
+    }
+}
+
+int DatabaseMaintenance::runJob(const Job &job)
+{
+    switch (job.type) {
+    case DeleteRowsJob:
+        return runDeleteRows(job);
+
+    case RemoveDirectoriesJob:
+        return runRemoveDirectories(job);
+
+    case OptimizeJob:
+        return runOptimize();
+
+    default:
+        return 0;
+    }
+}
+
+int DatabaseMaintenance::runDeleteRows(const Job &job)
+{
+    QString where;
+    if (!job.condition.isEmpty()) {
+        where = QSL(" WHERE ") + job.condition;
+    }
+
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.prepare(QSL("SELECT COUNT(*) FROM %1%2").arg(job.table, where));
+    for (int i = 0; i < job.values.count(); ++i) {
+        query.bindValue(i, job.values.at(i));
+    }
+    query.exec();
+
+    const int total = query.next() ? query.value(0).toInt() : 0;
+    if (total == 0) {
+        return 0;
+    }
+
+    emit jobProgress(job.id, 0, total);
+
+    query.prepare(QSL("DELETE FROM %1 WHERE rowid IN (SELECT rowid FROM %1%2 LIMIT %3)")
+                  .arg(job.table, where, QString::number(s_deleteChunkSize)));
+
+    int done = 0;
+
+    while (!m_cancelled.load()) {
+        for (int i = 0; i < job.values.count(); ++i) {
+            query.bindValue(i, job.values.at(i));
+        }
+
+        if (!query.exec()) {
+            qWarning() << "DatabaseMaintenance: Cannot delete from" << job.table << query.lastError().text();
+            break;
+        }
+
+        const int deleted = query.numRowsAffected();
+        if (deleted <= 0) {
+            break;
+        }
+
+        done += deleted;
+        emit jobProgress(job.id, qMin(done, total), total);
+
+        if (deleted < s_deleteChunkSize) {
+            break;
+        }
+
+        QThread::msleep(s_chunkPauseMsecs);
+    }
+
+    return done;
+}
+
+int DatabaseMaintenance::runRemoveDirectories(const Job &job)
+{
+    const int total = job.paths.count();
+    int done = 0;
+
+    while (done < total && !m_cancelled.load()) {
+        QzTools::removeDir(job.paths.at(done));
+        emit jobProgress(job.id, ++done, total);
+    }
+
+    return done;
+}
+
+int DatabaseMaintenance::runOptimize()
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+
+    query.exec(QSL("PRAGMA page_count"));
+    const qint64 pageCount = query.next() ? query.value(0).toLongLong() : 0;
+
+    query.exec(QSL("PRAGMA freelist_count"));
+    const qint64 freePages = query.next() ? query.value(0).toLongLong() : 0;
+
+    if (pageCount <= 0 || freePages < s_vacuumMinFreePages || freePages * 100 < pageCount * s_vacuumFreelistPercent) {
+        return 0;
+    }
+
+    if (m_cancelled.load()) {
+        return 0;
+    }
+
+    // VACUUM fails when other connection is writing, it will be retried after next delete
+    if (!query.exec(QSL("VACUUM"))) {
+        qWarning() << "DatabaseMaintenance: VACUUM failed" << query.lastError().text();
+        return 0;
+    }
+
+    query.exec(QSL("ANALYZE"));
+    return 1;
+}
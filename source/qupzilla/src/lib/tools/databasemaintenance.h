@@ -0,0 +1,125 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef DATABASEMAINTENANCE_H
+#define DATABASEMAINTENANCE_H
+
+#include <QAtomicInt>
+#include <QFutureWatcher>
+#include <QObject>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVariantList>
+#include <QVector>
+
+#include "qzcommon.h"
+
+// Runs database and profile maintenance jobs (pruning, clearing, VACUUM,
+// removing directories) in a background thread.
+// Immediate jobs are started right away, Idle jobs wait until the user
+// has not interacted with the application for a while.
+class QUPZILLA_EXPORT DatabaseMaintenance : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Priority {
+        Immediate,
+        Idle
+    };
+
+    explicit DatabaseMaintenance(QObject* parent = 0);
+    ~DatabaseMaintenance();
+
+    static DatabaseMaintenance* instance();
+
+    // All functions below return job id used in signals and cancel()
+
+    // Deletes rows matching condition (all rows if empty) in small chunks,
+    // database is optimized afterwards if enough pages were freed
+    int deleteRows(const QString &table, const QString &condition = QString(),
+                   const QVariantList &values = QVariantList(), Priority priority = Idle);
+
+    // Removes directories recursively
+    int removeDirectories(const QStringList &paths, Priority priority = Immediate);
+
+    // Runs VACUUM and ANALYZE only when the freelist ratio justifies it
+    int optimize(Priority priority = Idle);
+
+    bool isBusy() const;
+
+    void cancel(int id);
+    void cancelAll();
+
+    // Cancels Idle jobs and finishes Immediate jobs in calling thread
+    void shutdown();
+
+signals:
+    // done and total are rows for delete jobs and directories for remove jobs
+    void jobProgress(int id, int done, int total);
+    // result is number of deleted rows / removed directories, or 1 if database was vacuumed
+    void jobFinished(int id, int result, bool cancelled);
+    void idle();
+
+protected:
+    bool eventFilter(QObject* obj, QEvent* event) Q_DECL_OVERRIDE;
+
+private slots:
+    void idleTimeout();
+    void currentJobFinished();
+
+private:
+    enum JobType {
+        DeleteRowsJob,
+        RemoveDirectoriesJob,
+        OptimizeJob
+    };
+
+    struct Job {
+        int id;
+        JobType type;
+        Priority priority;
+        QString table;
+        QString condition;
+        QVariantList values;
+        QStringList paths;
+    };
+
+    int addJob(Job job);
+    void startNext();
+    void setIdleWatching(bool enable);
+
+    int runJob(const Job &job);
+    int runDeleteRows(const Job &job);
+    int runRemoveDirectories(const Job &job);
+    int runOptimize();
+
+    QVector<Job> m_jobs;
+    Job m_currentJob;
+    bool m_running;
+    bool m_idleReady;
+    bool m_watchingInput;
+    int m_lastId;
+    QAtomicInt m_cancelled;
+
+    QTimer* m_idleTimer;
+    QThreadPool m_worker;
+    QFutureWatcher<int>* m_watcher;
+};
+
+#endif // DATABASEMAINTENANCE_H
@@ -31,6 +31,9 @@
 
 Q_GLOBAL_STATIC(IconProvider, qz_icon_provider)
 
+// Number of icons loaded by warmUpIconCache()
+static const int warmUpIconsCount = 100;
+
 static QByteArray encodeUrl(const QUrl &url)
 {
     return url.toEncoded(QUrl::RemoveFragment | QUrl::StripTrailingSlash);
@@ -216,6 +219,14 @@ QImage IconProvider::imageForUrl(const QUrl &url, bool allowNull)
         }
     }
 
+    QMutexLocker locker(&instance()->m_cacheMutex);
+    const QImage cached = instance()->m_iconCache.value(encodedUrl);
+    locker.unlock();
+
+    if (!cached.isNull()) {
+        return cached;
+    }
+
     QSqlQuery query(SqlDatabase::instance()->database());
     query.prepare(QSL("SELECT icon FROM icons WHERE url GLOB ? LIMIT 1"));
     query.addBindValue(QString("%1*").arg(QzTools::escapeSqlGlobString(QString::fromUtf8(encodedUrl))));
@@ -262,8 +273,40 @@ IconProvider* IconProvider::instance()
     return qz_icon_provider();
 }
 
+void IconProvider::warmUpIconCache()
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.prepare(QSL("SELECT url, icon FROM icons ORDER BY id DESC LIMIT ?"));
+    query.addBindValue(warmUpIconsCount);
+    query.exec();
+
+    QHash<QByteArray, QImage> icons;
+
+    while (query.next()) {
+        const QImage image = QImage::fromData(query.value(1).toByteArray());
+        if (!image.isNull()) {
+            icons.insert(query.value(0).toString().toUtf8(), image);
+        }
+    }
+
+    QMutexLocker locker(&m_cacheMutex);
+    m_iconCache = icons;
+}
+
+void IconProvider::clearIconCache()
+{
+    QMutexLocker locker(&m_cacheMutex);
+    m_iconCache.clear();
+}
+
 void IconProvider::saveIconsToDatabase()
 {
+    QMutexLocker locker(&m_cacheMutex);
+    foreach (const BufferedIcon &ic, m_iconBuffer) {
+        m_iconCache.remove(encodeUrl(ic.first));
+    }
+    locker.unlock();
+
     foreach (const BufferedIcon &ic, m_iconBuffer) {
         QSqlQuery query(SqlDatabase::instance()->database());
         query.prepare("SELECT id FROM icons WHERE url = ?");
@@ -295,6 +338,8 @@ void IconProvider::clearOldIconsInDatabase()
     const QDateTime date = QDateTime::currentDateTime().addMonths(-6);
 
     QSqlQuery query(SqlDatabase::instance()->database());
+    clearIconCache();
+
     query.prepare(QSL("DELETE FROM icons WHERE url IN (SELECT url FROM history WHERE date < ?)"));
     query.addBindValue(date.toMSecsSinceEpoch());
     query.exec();
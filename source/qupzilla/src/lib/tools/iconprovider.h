@@ -21,6 +21,8 @@
 #include <QWidget>
 #include <QStyle>
 #include <QImage>
+#include <QMutex>
+#include <QHash>
 #include <QUrl>
 
 #include <functional>
@@ -68,6 +70,10 @@ public:
 
     static IconProvider* instance();
 
+    // Loads recently saved icons into memory, can be called from worker thread
+    void warmUpIconCache();
+    void clearIconCache();
+
 public slots:
     void saveIconsToDatabase();
     void clearOldIconsInDatabase();
@@ -81,6 +87,10 @@ private:
     QIcon m_bookmarkIcon;
     QVector<BufferedIcon> m_iconBuffer;
 
+    // Icons from database by encoded url, accessed also from worker threads
+    QMutex m_cacheMutex;
+    QHash<QByteArray, QImage> m_iconCache;
+
     AutoSaver* m_autoSaver;
 };
 
@@ -180,6 +180,55 @@ QString Scripts::setCss(const QString &css)
     return source.arg(style);
 }
 
+QString Scripts::setupElementHiding(const QString &css, const QStringList &disabledDomains)
+{
+    // Injected at DocumentCreation when there may be no documentElement yet
+    QString source = QL1S("(function() {"
+                          "var p = location.protocol;"
+                          "if (p == 'file:' || p == 'qrc:' || p == 'view-source:' || p == 'qupzilla:' || p == 'data:' || p == 'abp:') return;"
+                          "var h = location.hostname.toLowerCase();"
+                          "var d = [%2];"
+                          "for (var i = 0; i < d.length; ++i) {"
+                          "    if (h == d[i] || h.endsWith('.' + d[i])) return;"
+                          "}"
+                          "var css = document.createElement('style');"
+                          "css.setAttribute('type', 'text/css');"
+                          "css.setAttribute('id', '_qupzilla_adblock_css');"
+                          "css.appendChild(document.createTextNode('%1'));"
+                          "function insert() {"
+                          "    var root = document.head || document.documentElement;"
+                          "    if (!root) return false;"
+                          "    root.appendChild(css);"
+                          "    return true;"
+                          "}"
+                          "if (insert()) return;"
+                          "var observer = new MutationObserver(function() {"
+                          "    if (insert()) observer.disconnect();"
+                          "});"
+                          "observer.observe(document, {childList: true});"
+                          "})()");
+
+    QString style = css;
+    style.replace(QL1S("'"), QL1S("\\'"));
+    style.replace(QL1S("\n"), QL1S("\\n"));
+
+    QStringList domains;
+    foreach (QString domain, disabledDomains) {
+        domain.replace(QL1S("'"), QL1S("\\'"));
+        domains.append(QL1C('\'') + domain.toLower() + QL1C('\''));
+    }
+
+    return source.arg(style, domains.join(QL1C(',')));
+}
+
+QString Scripts::removeElementHiding()
+{
+    return QSL("(function() {"
+               "var css = document.getElementById('_qupzilla_adblock_css');"
+               "if (css) css.parentNode.removeChild(css);"
+               "})()");
+}
+
 QString Scripts::sendPostData(const QUrl &url, const QByteArray &data)
 {
     QString source = QL1S("(function() {"
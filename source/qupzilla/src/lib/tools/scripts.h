@@ -33,6 +33,8 @@ public:
     static QString setupWindowObject();
 
     static QString setCss(const QString &css);
+    static QString setupElementHiding(const QString &css, const QStringList &disabledDomains);
+    static QString removeElementHiding();
     static QString sendPostData(const QUrl &url, const QByteArray &data);
     static QString completeFormData(const QByteArray &data);
     static QString getOpenSearchLinks();
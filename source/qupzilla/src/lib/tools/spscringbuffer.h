@@ -0,0 +1,76 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef SPSCRINGBUFFER_H
+#define SPSCRINGBUFFER_H
+
+#include <QAtomicInt>
+
+#include <utility>
+
+// Lock-free fixed size queue for exactly one producer and one consumer thread.
+// One slot is always kept empty to distinguish full and empty buffer.
+template<typename T, int Capacity>
+class SpscRingBuffer
+{
+    Q_DISABLE_COPY(SpscRingBuffer)
+
+public:
+    SpscRingBuffer()
+        : m_head(0)
+        , m_tail(0)
+    {
+    }
+
+    // Producer thread only, returns false when buffer is full
+    bool push(const T &value)
+    {
+        const int head = m_head.load();
+        const int next = (head + 1) % Capacity;
+        if (next == m_tail.loadAcquire()) {
+            return false;
+        }
+        m_buffer[head] = value;
+        m_head.storeRelease(next);
+        return true;
+    }
+
+    // Consumer thread only, returns false when buffer is empty
+    bool pop(T &value)
+    {
+        const int tail = m_tail.load();
+        if (tail == m_head.loadAcquire()) {
+            return false;
+        }
+        value = std::move(m_buffer[tail]);
+        m_buffer[tail] = T();
+        m_tail.storeRelease((tail + 1) % Capacity);
+        return true;
+    }
+
+    bool isEmpty() const
+    {
+        return m_tail.loadAcquire() == m_head.loadAcquire();
+    }
+
+private:
+    T m_buffer[Capacity];
+    QAtomicInt m_head;
+    QAtomicInt m_tail;
+};
+
+#endif // SPSCRINGBUFFER_H
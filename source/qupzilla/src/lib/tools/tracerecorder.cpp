@@ -0,0 +1,280 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "tracerecorder.h"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+#include <QWidget>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+// Events are written once this many of them are buffered
+static const int s_flushThreshold = 256;
+
+Q_GLOBAL_STATIC(TraceRecorder, qz_trace_recorder)
+
+TraceRecorder::TraceRecorder(QObject* parent)
+    : QObject(parent)
+    , m_enabled(0)
+    , m_pid(QCoreApplication::applicationPid())
+{
+    m_timer.start();
+
+    // Single writer thread keeps the events in the file in order
+    m_writer.setMaxThreadCount(1);
+}
+
+TraceRecorder* TraceRecorder::instance()
+{
+    return qz_trace_recorder();
+}
+
+bool TraceRecorder::isEnabled() const
+{
+    return m_enabled.load();
+}
+
+void TraceRecorder::start(const QString &fileName)
+{
+    if (isEnabled()) {
+        return;
+    }
+
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        qWarning() << "TraceRecorder: Cannot open" << fileName;
+        return;
+    }
+
+    // Closing bracket is optional in JSON array format, so the trace
+    // stays readable even when the application crashes
+    file.write("[\n");
+    file.close();
+
+    m_fileName = fileName;
+    m_enabled.store(1);
+
+    m_events.reserve(s_flushThreshold);
+}
+
+void TraceRecorder::finish()
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    m_enabled.store(0);
+
+    QMutexLocker locker(&m_mutex);
+    const QVector<Event> events = m_events;
+    m_events.clear();
+    locker.unlock();
+
+    m_writer.waitForDone();
+    writeEvents(events, true);
+}
+
+void TraceRecorder::flush()
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    if (m_events.isEmpty()) {
+        return;
+    }
+
+    QVector<Event> events;
+    events.reserve(s_flushThreshold);
+    m_events.swap(events);
+    locker.unlock();
+
+    QtConcurrent::run(&m_writer, this, &TraceRecorder::writeEvents, events, false);
+}
+
+void TraceRecorder::beginEvent(const char* name, const char* category)
+{
+    addEvent(name, category, 'B');
+}
+
+void TraceRecorder::endEvent(const char* name, const char* category)
+{
+    addEvent(name, category, 'E');
+}
+
+void TraceRecorder::instantEvent(const char* name, const char* category, const QString &message)
+{
+    addEvent(name, category, 'i', 0, message);
+}
+
+void TraceRecorder::counterEvent(const char* name, qint64 value)
+{
+    addEvent(name, "counter", 'C', value);
+}
+
+void TraceRecorder::completeEvent(const char* name, const char* category, qint64 startTimestamp, const QString &message)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    Event event;
+    event.name = name;
+    event.category = category;
+    event.phase = 'X';
+    event.timestamp = startTimestamp;
+    event.threadId = reinterpret_cast<quintptr>(QThread::currentThreadId());
+    event.value = timestamp() - startTimestamp;
+    event.message = message;
+
+    appendEvent(event);
+}
+
+qint64 TraceRecorder::timestamp() const
+{
+    return m_timer.nsecsElapsed() / 1000;
+}
+
+void TraceRecorder::traceFirstPaint(QWidget* widget, const char* name)
+{
+    if (!isEnabled() || !widget) {
+        return;
+    }
+
+    m_firstPaint.insert(widget, name);
+    widget->installEventFilter(this);
+}
+
+bool TraceRecorder::eventFilter(QObject* obj, QEvent* event)
+{
+    if (event->type() == QEvent::Paint && m_firstPaint.contains(obj)) {
+        instantEvent(m_firstPaint.take(obj), "paint");
+        obj->removeEventFilter(this);
+    }
+
+    return QObject::eventFilter(obj, event);
+}
+
+void TraceRecorder::addEvent(const char* name, const char* category, char phase, qint64 value, const QString &message)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    Event event;
+    event.name = name;
+    event.category = category;
+    event.phase = phase;
+    event.timestamp = timestamp();
+    event.threadId = reinterpret_cast<quintptr>(QThread::currentThreadId());
+    event.value = value;
+    event.message = message;
+
+    appendEvent(event);
+}
+
+void TraceRecorder::appendEvent(const Event &event)
+{
+    QMutexLocker locker(&m_mutex);
+    m_events.append(event);
+    const bool needsFlush = m_events.size() >= s_flushThreshold;
+    locker.unlock();
+
+    if (needsFlush) {
+        flush();
+    }
+}
+
+void TraceRecorder::writeEvents(const QVector<Event> &events, bool close)
+{
+    QFile file(m_fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Append)) {
+        return;
+    }
+
+    QByteArray data;
+
+    for (const Event &event : events) {
+        QJsonObject object;
+        object.insert(QSL("name"), QString::fromLatin1(event.name));
+        object.insert(QSL("cat"), QString::fromLatin1(event.category));
+        object.insert(QSL("ph"), QString(QL1C(event.phase)));
+        object.insert(QSL("ts"), event.timestamp);
+        object.insert(QSL("pid"), m_pid);
+        object.insert(QSL("tid"), static_cast<qint64>(event.threadId));
+
+        if (event.phase == 'C') {
+            QJsonObject args;
+            args.insert(QSL("value"), event.value);
+            object.insert(QSL("args"), args);
+        }
+        else if (event.phase == 'X') {
+            object.insert(QSL("dur"), event.value);
+            if (!event.message.isEmpty()) {
+                QJsonObject args;
+                args.insert(QSL("message"), event.message);
+                object.insert(QSL("args"), args);
+            }
+        }
+        else if (event.phase == 'i') {
+            object.insert(QSL("s"), QSL("t"));
+            if (!event.message.isEmpty()) {
+                QJsonObject args;
+                args.insert(QSL("message"), event.message);
+                object.insert(QSL("args"), args);
+            }
+        }
+
+        data.append(QJsonDocument(object).toJson(QJsonDocument::Compact));
+        data.append(",\n");
+    }
+
+    if (close) {
+        QJsonObject args;
+        args.insert(QSL("name"), QCoreApplication::applicationName());
+
+        QJsonObject object;
+        object.insert(QSL("name"), QSL("process_name"));
+        object.insert(QSL("ph"), QSL("M"));
+        object.insert(QSL("pid"), m_pid);
+        object.insert(QSL("args"), args);
+
+        data.append(QJsonDocument(object).toJson(QJsonDocument::Compact));
+        data.append("\n]\n");
+    }
+
+    file.write(data);
+}
+
+// TraceScope
+TraceScope::TraceScope(const char* name, const char* category)
+    : m_name(name)
+    , m_category(category)
+{
+    TraceRecorder::instance()->beginEvent(m_name, m_category);
+}
+
+TraceScope::~TraceScope()
+{
+    TraceRecorder::instance()->endEvent(m_name, m_category);
+}
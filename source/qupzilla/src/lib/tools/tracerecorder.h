@@ -0,0 +1,110 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef TRACERECORDER_H
+#define TRACERECORDER_H
+
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QThreadPool>
+#include <QVector>
+
+#include "qzcommon.h"
+
+class QWidget;
+
+// Records trace events in memory and writes them in background into
+// a file in Chrome trace event format (chrome://tracing, Perfetto)
+class QUPZILLA_EXPORT TraceRecorder : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TraceRecorder(QObject* parent = 0);
+
+    static TraceRecorder* instance();
+
+    bool isEnabled() const;
+
+    // Starts recording, any existing file is overwritten
+    void start(const QString &fileName);
+    // Writes remaining events, closes the file and stops recording
+    void finish();
+
+    // Writes recorded events without blocking the calling thread
+    void flush();
+
+    // name and category must be string literals (or otherwise outlive the recorder)
+    void beginEvent(const char* name, const char* category);
+    void endEvent(const char* name, const char* category);
+    void instantEvent(const char* name, const char* category, const QString &message = QString());
+    void counterEvent(const char* name, qint64 value);
+    // Records event that started at startTimestamp and ends now
+    void completeEvent(const char* name, const char* category, qint64 startTimestamp, const QString &message = QString());
+
+    // Time since the recording started, in microseconds
+    qint64 timestamp() const;
+
+    // Records instant event when widget gets painted for the first time
+    void traceFirstPaint(QWidget* widget, const char* name);
+
+protected:
+    bool eventFilter(QObject* obj, QEvent* event) Q_DECL_OVERRIDE;
+
+private:
+    struct Event {
+        const char* name;
+        const char* category;
+        char phase;
+        qint64 timestamp;
+        quint64 threadId;
+        qint64 value;
+        QString message;
+    };
+
+    void addEvent(const char* name, const char* category, char phase, qint64 value = 0, const QString &message = QString());
+    void appendEvent(const Event &event);
+    void writeEvents(const QVector<Event> &events, bool close);
+
+    QAtomicInt m_enabled;
+    QElapsedTimer m_timer;
+    qint64 m_pid;
+
+    QMutex m_mutex;
+    QVector<Event> m_events;
+
+    QString m_fileName;
+    QThreadPool m_writer;
+    QHash<QObject*, const char*> m_firstPaint;
+};
+
+// Records begin event on construction and end event on destruction
+class QUPZILLA_EXPORT TraceScope
+{
+public:
+    explicit TraceScope(const char* name, const char* category = "qupzilla");
+    ~TraceScope();
+
+private:
+    const char* m_name;
+    const char* m_category;
+};
+
+#endif // TRACERECORDER_H
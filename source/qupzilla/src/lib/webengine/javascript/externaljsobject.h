@@ -24,6 +24,7 @@
 
 class WebPage;
 class AutoFillJsObject;
+class ScrollBarsJsObject;
 
 class QWebChannel;
 
@@ -33,6 +34,7 @@ class QUPZILLA_EXPORT ExternalJsObject : public QObject
     Q_PROPERTY(QObject* speedDial READ speedDial CONSTANT)
     Q_PROPERTY(QObject* autoFill READ autoFill CONSTANT)
     Q_PROPERTY(QObject* recovery READ recovery CONSTANT)
+    Q_PROPERTY(QObject* scrollBars READ scrollBars CONSTANT)
 
 public:
     explicit ExternalJsObject(WebPage *page);
@@ -48,9 +50,11 @@ private:
     QObject *speedDial() const;
     QObject *autoFill() const;
     QObject *recovery() const;
+    QObject *scrollBars() const;
 
     WebPage *m_page;
     AutoFillJsObject *m_autoFill;
+    ScrollBarsJsObject *m_scrollBars;
 };
 
 #endif // EXTERNALJSOBJECT_H
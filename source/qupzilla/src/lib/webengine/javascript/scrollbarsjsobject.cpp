@@ -0,0 +1,35 @@
+/* ============================================================
+* QupZilla - QtWebEngine based browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "scrollbarsjsobject.h"
+#include "externaljsobject.h"
+#include "webscrollbarmanager.h"
+#include "webpage.h"
+
+ScrollBarsJsObject::ScrollBarsJsObject(ExternalJsObject *parent)
+    : QObject(parent)
+    , m_jsObject(parent)
+{
+}
+
+void ScrollBarsJsObject::overflowChanged(bool vertical, bool horizontal)
+{
+    WebView *view = m_jsObject->page()->view();
+    if (view) {
+        WebScrollBarManager::instance()->setOverflow(view, vertical, horizontal);
+    }
+}
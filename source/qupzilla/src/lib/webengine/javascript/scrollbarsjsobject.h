@@ -0,0 +1,38 @@
+/* ============================================================
+* QupZilla - QtWebEngine based browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef SCROLLBARSJSOBJECT_H
+#define SCROLLBARSJSOBJECT_H
+
+#include <QObject>
+
+class ExternalJsObject;
+
+class ScrollBarsJsObject : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ScrollBarsJsObject(ExternalJsObject *parent);
+
+public slots:
+    void overflowChanged(bool vertical, bool horizontal);
+
+private:
+    ExternalJsObject *m_jsObject;
+};
+
+#endif // SCROLLBARSJSOBJECT_H
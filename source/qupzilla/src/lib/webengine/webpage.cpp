@@ -42,6 +42,7 @@
 #include "ui_jsalert.h"
 #include "ui_jsprompt.h"
 #include "passwordmanager.h"
+#include "tracerecorder.h"
 
 #include <iostream>
 
@@ -66,26 +67,6 @@ QTime WebPage::s_lastUnsupportedUrlTime;
 static const bool kEnableJsOutput = qEnvironmentVariableIsSet("QUPZILLA_ENABLE_JS_OUTPUT");
 static const bool kEnableJsNonBlockDialogs = qEnvironmentVariableIsSet("QUPZILLA_ENABLE_JS_NONBLOCK_DIALOGS");
 
-#include <cstdio>
-#include <sys/stat.h>
-
-// Check if logging is enabled via flag file
-static bool wpLoggingEnabled() {
-    struct stat st;
-    return (stat("/media/internal/qupzilla/enable_logging", &st) == 0);
-}
-
-// Helper to log (only if logging enabled)
-static void wpLog(const char* msg) {
-    if (!wpLoggingEnabled()) return;
-    std::cerr << msg << std::endl;
-    FILE* f = fopen("/media/internal/qupzilla/startup.log", "a");
-    if (f) {
-        fprintf(f, "%s\n", msg);
-        fclose(f);
-    }
-}
-
 WebPage::WebPage(QObject* parent)
     : QWebEnginePage(mApp->webProfile(), parent)
     , m_fileWatcher(0)
@@ -94,7 +75,8 @@ WebPage::WebPage(QObject* parent)
     , m_blockAlerts(false)
     , m_secureStatus(false)
 {
-    wpLog("[WEBPAGE] Constructor started (QWebEnginePage created)");
+    TraceScope trace("WebPage::WebPage", "tabs");
+
     connect(this, &QWebEnginePage::loadProgress, this, &WebPage::progress);
     connect(this, &QWebEnginePage::loadFinished, this, &WebPage::finished);
     connect(this, &QWebEnginePage::urlChanged, this, &WebPage::urlChanged);
@@ -137,7 +119,6 @@ WebPage::WebPage(QObject* parent)
     connect(m_setupChannelTimer, &QTimer::timeout, this, [this]() {
         setupWebChannelForUrl(m_channelUrl);
     });
-    wpLog("[WEBPAGE] Constructor completed");
 }
 
 WebPage::~WebPage()
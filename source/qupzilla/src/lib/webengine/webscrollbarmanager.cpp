@@ -24,6 +24,7 @@
 #include "scripts.h"
 #include "settings.h"
 
+#include <QTimer>
 #include <QPointer>
 #include <QPaintEvent>
 #include <QWebEngineProfile>
@@ -33,6 +34,9 @@
 
 Q_GLOBAL_STATIC(WebScrollBarManager, qz_web_scrollbar_manager)
 
+// Scrollbar updates are coalesced to at most one per frame
+static const int s_updateInterval = 16;
+
 class WebScrollBarCornerWidget : public QWidget
 {
 public:
@@ -87,6 +91,10 @@ struct ScrollBarData {
     bool vscrollbarVisible = false;
     bool hscrollbarVisible = false;
     WebScrollBarCornerWidget *corner;
+    QTimer *updateTimer;
+    // Set when the overflow observer reported state for the current document
+    bool overflowPushed = false;
+    bool overflowProbeNeeded = false;
 };
 
 WebScrollBarManager::WebScrollBarManager(QObject *parent)
@@ -104,6 +112,48 @@ WebScrollBarManager::WebScrollBarManager(QObject *parent)
                          "head.appendChild(css);"
                          "})()");
 
+    // Reports overflow state through the web channel, at most once per frame
+    // and only when it actually changes
+    m_overflowJs = QL1S("(function() {"
+                        "var vertical = null;"
+                        "var horizontal = null;"
+                        "var scheduled = false;"
+                        "function check() {"
+                        "    scheduled = false;"
+                        "    var e = document.documentElement;"
+                        "    if (!e) return;"
+                        "    var v = window.innerWidth > e.clientWidth;"
+                        "    var h = window.innerHeight > e.clientHeight;"
+                        "    if (v === vertical && h === horizontal) return;"
+                        "    vertical = v;"
+                        "    horizontal = h;"
+                        "    external.scrollBars.overflowChanged(v, h);"
+                        "}"
+                        "function schedule() {"
+                        "    if (scheduled) return;"
+                        "    scheduled = true;"
+                        "    window.requestAnimationFrame(check);"
+                        "}"
+                        "function init() {"
+                        "    if (!document.documentElement || !external.scrollBars) return;"
+                        "    if (window.ResizeObserver) {"
+                        "        var resizeObserver = new ResizeObserver(schedule);"
+                        "        resizeObserver.observe(document.documentElement);"
+                        "        if (document.body) resizeObserver.observe(document.body);"
+                        "    } else {"
+                        "        var mutationObserver = new MutationObserver(schedule);"
+                        "        mutationObserver.observe(document.documentElement, { childList: true, subtree: true, attributes: true });"
+                        "        window.addEventListener('load', schedule);"
+                        "    }"
+                        "    window.addEventListener('resize', schedule);"
+                        "    check();"
+                        "}"
+                        "if (window._qupzilla_external)"
+                        "    init();"
+                        "else"
+                        "    document.addEventListener('_qupzilla_external_created', init);"
+                        "})()");
+
     loadSettings();
 }
 
@@ -143,10 +193,19 @@ void WebScrollBarManager::addWebView(WebView *view)
         data->corner->updateVisibility(data->vscrollbarVisible && data->hscrollbarVisible, thickness);
     };
 
-    connect(view, &WebView::viewportResized, data->vscrollbar, updateValues);
-    connect(view->page(), &WebPage::scrollPositionChanged, data->vscrollbar, updateValues);
+    data->updateTimer = new QTimer(data->vscrollbar);
+    data->updateTimer->setSingleShot(true);
+    data->updateTimer->setInterval(s_updateInterval);
+
+    connect(data->updateTimer, &QTimer::timeout, data->vscrollbar, [=]() {
+        if (!data->overflowProbeNeeded) {
+            updateValues();
+            return;
+        }
+
+        // Pages without the overflow observer (eg. qupzilla: pages) are probed instead
+        data->overflowProbeNeeded = false;
 
-    connect(view->page(), &WebPage::contentsSizeChanged, data->vscrollbar, [=]() {
         const QString source = QL1S("var out = {"
                                     "vertical: document.documentElement && window.innerWidth > document.documentElement.clientWidth,"
                                     "horizontal: document.documentElement && window.innerHeight > document.documentElement.clientHeight"
@@ -164,6 +223,26 @@ void WebScrollBarManager::addWebView(WebView *view)
         });
     });
 
+    auto scheduleUpdate = [=]() {
+        if (!data->updateTimer->isActive()) {
+            data->updateTimer->start();
+        }
+    };
+
+    connect(view, &WebView::viewportResized, data->vscrollbar, scheduleUpdate);
+    connect(view->page(), &WebPage::scrollPositionChanged, data->vscrollbar, scheduleUpdate);
+
+    connect(view->page(), &WebPage::contentsSizeChanged, data->vscrollbar, [=]() {
+        if (!data->overflowPushed) {
+            data->overflowProbeNeeded = true;
+        }
+        scheduleUpdate();
+    });
+
+    connect(view, &WebView::loadStarted, data->vscrollbar, [=]() {
+        data->overflowPushed = false;
+    });
+
     connect(view, &WebView::zoomLevelChanged, data->vscrollbar, [=]() {
         view->page()->runJavaScript(m_scrollbarJs.arg(thickness));
     });
@@ -195,6 +274,23 @@ QScrollBar *WebScrollBarManager::scrollBar(Qt::Orientation orientation, WebView
     return orientation == Qt::Vertical ? d->vscrollbar : d->hscrollbar;
 }
 
+void WebScrollBarManager::setOverflow(WebView *view, bool vertical, bool horizontal)
+{
+    ScrollBarData *data = m_scrollbars.value(view);
+    if (!data) {
+        return;
+    }
+
+    data->overflowPushed = true;
+    data->overflowProbeNeeded = false;
+    data->vscrollbarVisible = vertical;
+    data->hscrollbarVisible = horizontal;
+
+    if (!data->updateTimer->isActive()) {
+        data->updateTimer->start();
+    }
+}
+
 WebScrollBarManager *WebScrollBarManager::instance()
 {
     return qz_web_scrollbar_manager();
@@ -206,7 +302,7 @@ void WebScrollBarManager::createUserScript(int thickness)
     script.setName(QSL("_qupzilla_scrollbar"));
     script.setInjectionPoint(QWebEngineScript::DocumentReady);
     script.setWorldId(WebPage::SafeJsWorld);
-    script.setSourceCode(m_scrollbarJs.arg(thickness));
+    script.setSourceCode(m_scrollbarJs.arg(thickness) + m_overflowJs);
     mApp->webProfile()->scripts()->insert(script);
 }
 
@@ -40,6 +40,9 @@ public:
 
     QScrollBar *scrollBar(Qt::Orientation orientation, WebView *view) const;
 
+    // Called from the injected overflow observer whenever the page overflow changes
+    void setOverflow(WebView *view, bool vertical, bool horizontal);
+
     static WebScrollBarManager *instance();
 
 private:
@@ -49,6 +52,7 @@ private:
 
     bool m_enabled = true;
     QString m_scrollbarJs;
+    QString m_overflowJs;
     QHash<WebView*, struct ScrollBarData*> m_scrollbars;
 };
 
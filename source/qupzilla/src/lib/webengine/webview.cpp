@@ -35,6 +35,7 @@
 #include "scripts.h"
 #include "webhittestresult.h"
 #include "webscrollbarmanager.h"
+#include "speeddial.h"
 
 #include <iostream>
 
@@ -457,8 +458,10 @@ void WebView::slotLoadFinished(bool ok)
 {
     m_progress = 100;
 
-    if (ok)
+    if (ok) {
         mApp->history()->addHistoryEntry(this);
+        mApp->plugins()->speedDial()->captureThumbnail(this);
+    }
 }
 
 void WebView::slotIconChanged()
@@ -29,6 +29,8 @@
 #include "mainapplication.h"
 #include "iconprovider.h"
 #include "searchtoolbar.h"
+#include "tracerecorder.h"
+#include "startupscheduler.h"
 
 #include <QVBoxLayout>
 #include <QWebEngineHistory>
@@ -36,27 +38,6 @@
 #include <QTimer>
 #include <QSplitter>
 
-#include <iostream>
-#include <cstdio>
-#include <sys/stat.h>
-
-// Check if logging is enabled via flag file
-static bool wtLoggingEnabled() {
-    struct stat st;
-    return (stat("/media/internal/qupzilla/enable_logging", &st) == 0);
-}
-
-// Helper to log (only if logging enabled)
-static void wtLog(const char* msg) {
-    if (!wtLoggingEnabled()) return;
-    std::cerr << msg << std::endl;
-    FILE* f = fopen("/media/internal/qupzilla/startup.log", "a");
-    if (f) {
-        fprintf(f, "%s\n", msg);
-        fclose(f);
-    }
-}
-
 static const int savedTabVersion = 6;
 
 WebTab::SavedTab::SavedTab()
@@ -156,37 +137,29 @@ QDataStream &operator >>(QDataStream &stream, WebTab::SavedTab &tab)
 WebTab::WebTab(QWidget *parent)
     : QWidget(parent)
 {
-    wtLog("[WEBTAB] Constructor started");
+    TraceScope trace("WebTab::WebTab", "tabs");
+
     setObjectName(QSL("webtab"));
 
 #ifdef PORTABLE_BUILD
     // PORTABLE_BUILD: Don't create TabbedWebView yet - will be created in attach()
-    wtLog("[WEBTAB] PORTABLE_BUILD: Deferring TabbedWebView creation entirely");
     m_webView = nullptr;
-    wtLog("[WEBTAB] m_webView set to nullptr");
 #else
-    wtLog("[WEBTAB] Creating TabbedWebView...");
     m_webView = new TabbedWebView(this);
-    wtLog("[WEBTAB] TabbedWebView created, creating WebPage...");
     m_webView->setPage(new WebPage);
-    wtLog("[WEBTAB] WebPage set on view");
     m_webView->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Expanding);
     setFocusProxy(m_webView);
 #endif
 
-    wtLog("[WEBTAB] Creating LocationBar...");
     m_locationBar = new LocationBar(this);
-    wtLog("[WEBTAB] LocationBar created");
 #ifndef PORTABLE_BUILD
     m_locationBar->setWebView(m_webView);
 #endif
 
-    wtLog("[WEBTAB] Creating TabIcon...");
     m_tabIcon = new TabIcon(this);
 #ifndef PORTABLE_BUILD
     m_tabIcon->setWebTab(this);
 #endif
-    wtLog("[WEBTAB] TabIcon created");
 
     m_layout = new QVBoxLayout(this);
     m_layout->setContentsMargins(0, 0, 0, 0);
@@ -225,6 +198,7 @@ WebTab::WebTab(QWidget *parent)
     connect(m_webView, &TabbedWebView::titleChanged, this, &WebTab::titleWasChanged);
     connect(m_webView, &TabbedWebView::titleChanged, this, &WebTab::titleChanged);
     connect(m_webView, &TabbedWebView::iconChanged, this, &WebTab::iconChanged);
+    connect(m_webView, &TabbedWebView::urlChanged, this, &WebTab::urlChanged);
     connect(m_webView, &TabbedWebView::backgroundActivityChanged, this, &WebTab::backgroundActivityChanged);
     connect(m_webView, &TabbedWebView::loadStarted, this, std::bind(&WebTab::loadingChanged, this, true));
     connect(m_webView, &TabbedWebView::loadFinished, this, std::bind(&WebTab::loadingChanged, this, false));
@@ -414,20 +388,16 @@ void WebTab::attach(BrowserWindow* window)
 
 #ifdef PORTABLE_BUILD
     // Create TabbedWebView immediately (no deferral) since Stage2 already waited for Chromium
-    wtLog("[WEBTAB] attach() creating TabbedWebView immediately...");
+    TraceScope trace("WebTab::createWebView", "tabs");
+
     m_webView = new TabbedWebView(this);
     m_webView->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Expanding);
     setFocusProxy(m_webView);
     m_locationBar->setWebView(m_webView);
-    wtLog("[WEBTAB] TabbedWebView created");
 
-    wtLog("[WEBTAB] Adding WebView to layout...");
     m_layout->addWidget(m_webView);
-    wtLog("[WEBTAB] WebView added to layout");
 
-    wtLog("[WEBTAB] Creating WebPage...");
     m_webView->setPage(new WebPage);
-    wtLog("[WEBTAB] WebPage created");
 
     m_webView->setBrowserWindow(m_window);
 
@@ -455,8 +425,6 @@ void WebTab::attach(BrowserWindow* window)
         pageChanged(m_webView->page());
     }
     connect(m_webView, &TabbedWebView::pageChanged, this, pageChanged);
-
-    wtLog("[WEBTAB] WebView fully initialized");
 #endif
 }
 
@@ -669,9 +637,16 @@ void WebTab::restoreTab(const WebTab::SavedTab &tab)
     else {
         // This is called only on restore session and restoring tabs immediately
         // crashes QtWebEngine, waiting after initialization is complete fixes it
-        QTimer::singleShot(1000, this, [=]() {
-            p_restoreTab(tab);
-        });
+        if (!mApp->startupScheduler()->isStageFinished("WindowStarted")) {
+            mApp->startupScheduler()->runAfterStage("WindowStarted", this, [=]() {
+                p_restoreTab(tab);
+            });
+        }
+        else {
+            QTimer::singleShot(1000, this, [=]() {
+                p_restoreTab(tab);
+            });
+        }
     }
 }
 
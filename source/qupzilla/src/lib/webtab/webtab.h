@@ -140,6 +140,7 @@ private slots:
 signals:
     void titleChanged(const QString &title);
     void iconChanged(const QIcon &icon);
+    void urlChanged(const QUrl &url);
     void pinnedChanged(bool pinned);
     void restoredChanged(bool restored);
     void currentTabChanged(bool current);
@@ -18,6 +18,7 @@
 #include "mainapplication.h"
 #include "proxystyle.h"
 #include "datapaths.h"
+#include "tracerecorder.h"
 
 #include <QMessageBox> // For QT_REQUIRE_VERSION
 #include <iostream>
@@ -35,57 +36,19 @@
 #include <unistd.h>
 #include <cstring>
 #include <sys/stat.h>
-#include <sys/time.h>
 
 #include <QDir>
 #include <QDateTime>
 #include <QTextStream>
 #include <QWebEnginePage>
 
-// Startup logging - enabled by creating /media/internal/qupzilla/enable_logging file
-static FILE* g_logFile = nullptr;
-static bool g_loggingEnabled = false;
-static struct timeval g_startTime;
-
-// Check if logging should be enabled (file-based flag)
+// Startup tracing - enabled by creating /media/internal/qupzilla/enable_logging file
 static bool shouldEnableLogging()
 {
     struct stat st;
     return (stat("/media/internal/qupzilla/enable_logging", &st) == 0);
 }
 
-// Get milliseconds since startup for logging
-static long getElapsedMs()
-{
-    struct timeval now;
-    gettimeofday(&now, NULL);
-    return (now.tv_sec - g_startTime.tv_sec) * 1000 +
-           (now.tv_usec - g_startTime.tv_usec) / 1000;
-}
-
-static void logMsg(const char* msg)
-{
-    if (!g_loggingEnabled) return;
-    char buf[1024];
-    snprintf(buf, sizeof(buf), "[%6ldms] %s", getElapsedMs(), msg);
-    std::cerr << buf << std::endl;
-    if (g_logFile) {
-        fprintf(g_logFile, "%s\n", buf);
-        fflush(g_logFile);
-    }
-}
-
-static void logMsgFmt(const char* fmt, ...)
-{
-    if (!g_loggingEnabled) return;
-    char msg[1024];
-    va_list args;
-    va_start(args, fmt);
-    vsnprintf(msg, sizeof(msg), fmt, args);
-    va_end(args);
-    logMsg(msg);
-}
-
 // Simple cleanup of /tmp IPC files
 static void cleanupStaleChromiumFiles()
 {
@@ -207,21 +170,26 @@ void msgHandler(QtMsgType type, const QMessageLogContext &context, const QString
 
 int main(int argc, char* argv[])
 {
-    gettimeofday(&g_startTime, NULL);
+    TraceRecorder* trace = TraceRecorder::instance();
+
+    // Trace can be opened in chrome://tracing or Perfetto UI
+    if (qEnvironmentVariableIsSet("QUPZILLA_TRACE_FILE")) {
+        trace->start(QString::fromLocal8Bit(qgetenv("QUPZILLA_TRACE_FILE")));
+    }
 
 #if defined(Q_OS_LINUX) || defined(__GLIBC__) || defined(__FreeBSD__)
     // Check for logging flag file
-    g_loggingEnabled = shouldEnableLogging();
-    if (g_loggingEnabled) {
+    if (shouldEnableLogging()) {
         mkdir("/media/internal/qupzilla", 0755);
-        g_logFile = fopen("/media/internal/qupzilla/startup.log", "w");
-        logMsg("[STARTUP] QupZilla starting (logging enabled via flag file)");
+        trace->start(QSL("/media/internal/qupzilla/startup-trace.json"));
     }
 
     // Clean up stale IPC files
     cleanupStaleChromiumFiles();
 #endif
 
+    trace->instantEvent("Started", "startup");
+
     QT_REQUIRE_VERSION(argc, argv, "5.8.0");
 
 #ifndef Q_OS_WIN
@@ -233,7 +201,6 @@ int main(int argc, char* argv[])
 #endif
 
 #if defined(PORTABLE_BUILD) && defined(Q_OS_LINUX)
-    logMsg("[STARTUP] Setting webOS environment variables");
     // webOS-specific environment setup - must be set before QApplication
     // GPU acceleration with safe performance flags
     qputenv("QTWEBENGINE_CHROMIUM_FLAGS",
@@ -262,9 +229,10 @@ int main(int argc, char* argv[])
 
 #if defined(PORTABLE_BUILD) && defined(Q_OS_LINUX)
     // Log all argv for debugging
-    logMsgFmt("[STARTUP] argc = %d", argc);
-    for (int i = 0; i < argc; ++i) {
-        logMsgFmt("[STARTUP] argv[%d] = %s", i, argv[i]);
+    if (trace->isEnabled()) {
+        for (int i = 0; i < argc; ++i) {
+            trace->instantEvent("Argument", "startup", QString::fromLocal8Bit(argv[i]));
+        }
     }
 
     // Parse launch URL from command-line arguments
@@ -289,7 +257,6 @@ int main(int argc, char* argv[])
                 // Unescape JSON slashes
                 url.replace(QLatin1String("\\/"), QLatin1String("/"));
                 launchUrl = url;
-                logMsgFmt("[STARTUP] Parsed URL from JSON: %s", launchUrl.toUtf8().constData());
             }
             break;
         }
@@ -300,23 +267,21 @@ int main(int argc, char* argv[])
             arg.startsWith(QLatin1String("file://")) ||
             arg.contains(QLatin1String("://"))) {
             launchUrl = arg;
-            logMsgFmt("[STARTUP] Found direct URL in argv: %s", arg.toUtf8().constData());
             break;
         }
     }
 
     // Cache URL for opening after window is fully ready
     if (!launchUrl.isEmpty()) {
-        logMsgFmt("[STARTUP] Setting pending launch URL: %s", launchUrl.toUtf8().constData());
+        trace->instantEvent("PendingLaunchUrl", "startup", launchUrl);
         MainApplication::setPendingLaunchUrl(launchUrl);
     }
 #endif
 
-    logMsg("[STARTUP] Creating MainApplication");
     MainApplication app(argc, argv);
 
     if (app.isClosing()) {
-        if (g_logFile) fclose(g_logFile);
+        trace->finish();
         return 0;
     }
 
@@ -327,17 +292,16 @@ int main(int argc, char* argv[])
         QSslConfiguration sslConfig = QSslConfiguration::defaultConfiguration();
         sslConfig.setCaCertificates(systemCerts);
         QSslConfiguration::setDefaultConfiguration(sslConfig);
-        logMsgFmt("[STARTUP] SSL certificates loaded: %d certs", systemCerts.size());
+        trace->counterEvent("SslCertificates", systemCerts.size());
     }
 #endif
 
     app.setProxyStyle(new ProxyStyle);
     app.processEvents();
 
-    logMsg("[STARTUP] Entering event loop");
+    trace->instantEvent("EnterEventLoop", "startup");
     int result = app.exec();
 
-    logMsgFmt("[SHUTDOWN] Exit code %d", result);
-    if (g_logFile) fclose(g_logFile);
+    trace->finish();
     return result;
 }
@@ -4,11 +4,13 @@ os2: TARGET  = AcKeyNav
 SOURCES = \
     akn_plugin.cpp \
     akn_handler.cpp \
+    akn_overlay.cpp \
     akn_settings.cpp
 
 HEADERS = \
     akn_plugin.h \
     akn_handler.h \
+    akn_overlay.h \
     akn_settings.h
 
 FORMS += \
@@ -34,16 +34,13 @@
  * Boston, MA  02110-1301  USA
  */
 #include "akn_handler.h"
+#include "akn_overlay.h"
 #include "webview.h"
 #include "webpage.h"
 
 #include <QApplication>
 #include <QSettings>
-#include <QWebPage>
-#include <QWebFrame>
-#include <QLabel>
 #include <QTimer>
-#include <QToolTip>
 #include <QKeyEvent>
 
 Qt::Key keyFromCode(int code)
@@ -132,7 +129,7 @@ bool AKN_Handler::handleKeyPress(QObject* obj, QKeyEvent* event)
 
 bool AKN_Handler::eventFilter(QObject* obj, QEvent* event)
 {
-    if (obj != m_view.data()) {
+    if (!m_view || (obj != m_view.data() && obj != m_view.data()->inputWidget())) {
         return false;
     }
 
@@ -195,27 +192,17 @@ void AKN_Handler::handleAccessKey(QKeyEvent* event)
     }
 
     if (m_accessKeyNodes.contains(key)) {
-        QWebElement element = m_accessKeyNodes[key];
-        QPoint p = element.geometry().center();
-        QWebFrame* frame = element.webFrame();
+        const QPoint p = m_accessKeyNodes.value(key).center();
+        QWidget* receiver = m_view.data()->inputWidget();
 
-        if (!frame) {
-            return;
-        }
-
-        do {
-            p -= frame->scrollPosition();
-            frame = frame->parentFrame();
-        }
-        while (frame && frame != m_view.data()->page()->currentFrame());
-
-        QMouseEvent pevent(QEvent::MouseButtonPress, p, Qt::LeftButton, 0, 0);
-        qApp->sendEvent(m_view.data(), &pevent);
+        // Hide first so the click is not swallowed by our own event filter
+        hideAccessKeys();
 
-        QMouseEvent revent(QEvent::MouseButtonRelease, p, Qt::LeftButton, 0, 0);
-        qApp->sendEvent(m_view.data(), &revent);
+        QMouseEvent pevent(QEvent::MouseButtonPress, p, Qt::LeftButton, Qt::LeftButton, Qt::NoModifier);
+        QApplication::sendEvent(receiver, &pevent);
 
-        hideAccessKeys();
+        QMouseEvent revent(QEvent::MouseButtonRelease, p, Qt::LeftButton, Qt::NoButton, Qt::NoModifier);
+        QApplication::sendEvent(receiver, &revent);
     }
 }
 
@@ -225,153 +212,146 @@ void AKN_Handler::showAccessKeys()
         return;
     }
 
-    QWebPage* page = m_view.data()->page();
+    // Collect all visible clickable elements in one round-trip. The result is a flat
+    // array of [left, top, width, height, accesskey, text] tuples in viewport CSS pixels.
+    const QString source = QL1S("(function() {"
+                                "var elements = document.querySelectorAll('input:not([type=hidden]),a,area,button,label,legend,textarea,select');"
+                                "var width = window.innerWidth;"
+                                "var height = window.innerHeight;"
+                                "var out = [];"
+                                "for (var i = 0; i < elements.length; ++i) {"
+                                "    var e = elements[i];"
+                                "    var r = e.getBoundingClientRect();"
+                                "    if (r.width <= 0 || r.height <= 0 || r.left < 0 || r.top < 0 || r.left >= width || r.top >= height)"
+                                "        continue;"
+                                "    var text = e.innerText || e.value || '';"
+                                "    out.push(r.left, r.top, r.width, r.height, e.getAttribute('accesskey') || '', text.substr(0, 64));"
+                                "}"
+                                "return out;"
+                                "})()");
+
+    QPointer<WebView> view = m_view;
+    m_view.data()->page()->runJavaScript(source, WebPage::SafeJsWorld, [this, view](const QVariant &res) {
+        if (!view || view != m_view || m_accessKeysVisible) {
+            return;
+        }
+        createAccessKeys(res.toList());
+    });
+}
 
-    QStringList supportedElement;
-    supportedElement << QLatin1String("input")
-                     << QLatin1String("a")
-                     << QLatin1String("area")
-                     << QLatin1String("button")
-                     << QLatin1String("label")
-                     << QLatin1String("legend")
-                     << QLatin1String("textarea");
+void AKN_Handler::createAccessKeys(const QVariantList &elements)
+{
+    const int fieldsCount = 6;
+    const int count = elements.size() / fieldsCount;
+    if (count == 0) {
+        return;
+    }
+
+    const qreal zoom = m_view.data()->page()->zoomFactor();
+
+    QVector<QRect> rects(count);
+    for (int i = 0; i < count; ++i) {
+        const int n = i * fieldsCount;
+        const QRectF r(elements.at(n).toReal(), elements.at(n + 1).toReal(), elements.at(n + 2).toReal(), elements.at(n + 3).toReal());
+        rects[i] = QRectF(r.topLeft() * zoom, r.size() * zoom).toRect();
+    }
 
-    QList<QChar> unusedKeys;
+    QString unusedKeys;
+    unusedKeys.reserve(62);
     for (char c = 'A'; c <= 'Z'; ++c) {
-        unusedKeys << QLatin1Char(c);
+        unusedKeys.append(QLatin1Char(c));
     }
     for (char c = '0'; c <= '9'; ++c) {
-        unusedKeys << QLatin1Char(c);
+        unusedKeys.append(QLatin1Char(c));
     }
     for (char c = 'a'; c <= 'z'; ++c) {
-        unusedKeys << QLatin1Char(c);
+        unusedKeys.append(QLatin1Char(c));
     }
 
-    QRect viewport = QRect(page->currentFrame()->scrollPosition(), page->viewportSize());
+    QVector<bool> labeled(count, false);
+
     // Priority first goes to elements with accesskey attributes
-    QList<QWebElement> alreadyLabeled;
-    foreach (const QString &elementType, supportedElement) {
-        QList<QWebElement> result = page->currentFrame()->findAllElements(elementType).toList();
-        foreach (const QWebElement &element, result) {
-            const QRect geometry = element.geometry();
-            if (geometry.size().isEmpty() ||
-                !viewport.contains(geometry.topLeft())
-               ) {
-                continue;
-            }
-            QString accessKeyAttribute = element.attribute(QLatin1String("accesskey")).toUpper();
-            if (accessKeyAttribute.isEmpty()) {
-                continue;
-            }
-            QChar accessKey;
-            for (int i = 0; i < accessKeyAttribute.count(); i += 2) {
-                const QChar possibleAccessKey = accessKeyAttribute[i];
-                if (unusedKeys.contains(possibleAccessKey)) {
-                    accessKey = possibleAccessKey;
-                    break;
-                }
+    for (int i = 0; i < count; ++i) {
+        const QString accessKeyAttribute = elements.at(i * fieldsCount + 4).toString().toUpper();
+        for (int j = 0; j < accessKeyAttribute.size(); j += 2) {
+            const QChar possibleAccessKey = accessKeyAttribute.at(j);
+            const int index = unusedKeys.indexOf(possibleAccessKey);
+            if (index != -1) {
+                unusedKeys.remove(index, 1);
+                m_accessKeyNodes.insert(possibleAccessKey, rects.at(i));
+                labeled[i] = true;
+                break;
             }
-            if (accessKey.isNull()) {
-                continue;
-            }
-            unusedKeys.removeOne(accessKey);
-            makeAccessKeyLabel(accessKey, element);
-            alreadyLabeled.append(element);
         }
     }
 
     // Pick an access key first from the letters in the text and then from the
     // list of unused access keys
-    foreach (const QString &elementType, supportedElement) {
-        QWebElementCollection result = page->currentFrame()->findAllElements(elementType);
-        foreach (const QWebElement &element, result) {
-            const QRect geometry = element.geometry();
-            if (unusedKeys.isEmpty() ||
-                alreadyLabeled.contains(element) ||
-                geometry.size().isEmpty() ||
-                !viewport.contains(geometry.topLeft())
-               ) {
-                continue;
-            }
-            QChar accessKey;
-            QString text = element.toPlainText().toLower();
-            for (int i = 0; i < text.count(); ++i) {
-                const QChar c = text.at(i);
-                if (unusedKeys.contains(c)) {
-                    accessKey = c;
-                    break;
-                }
-            }
-            if (accessKey.isNull()) {
-                accessKey = unusedKeys.takeFirst();
+    for (int i = 0; i < count && !unusedKeys.isEmpty(); ++i) {
+        if (labeled.at(i)) {
+            continue;
+        }
+
+        QChar accessKey;
+        const QString text = elements.at(i * fieldsCount + 5).toString().toLower();
+        for (int j = 0; j < text.size(); ++j) {
+            if (unusedKeys.contains(text.at(j))) {
+                accessKey = text.at(j);
+                break;
             }
-            unusedKeys.removeOne(accessKey);
-            makeAccessKeyLabel(accessKey, element);
         }
+        if (accessKey.isNull()) {
+            accessKey = unusedKeys.at(0);
+        }
+        unusedKeys.remove(unusedKeys.indexOf(accessKey), 1);
+        m_accessKeyNodes.insert(accessKey, rects.at(i));
     }
 
-    // Install event filter and connect loadStarted
-    m_accessKeysVisible = !m_accessKeyLabels.isEmpty();
-    if (m_accessKeysVisible) {
-        m_view.data()->installEventFilter(this);
-        connect(m_view.data(), SIGNAL(loadStarted()), this, SLOT(hideAccessKeys()));
-        connect(m_view.data()->page(), SIGNAL(scrollRequested(int,int,QRect)), this, SLOT(hideAccessKeys()));
-#if QT_VERSION >= 0x040800
-        connect(m_view.data()->page(), SIGNAL(viewportChangeRequested()), this, SLOT(hideAccessKeys()));
-#endif
+    // All labels are painted by one overlay widget
+    QWidget* parent = m_view.data()->overlayWidget();
+    const QPoint offset = m_view.data()->mapTo(parent, QPoint(0, 0));
+
+    QVector<AKN_Overlay::Label> labels;
+    labels.reserve(m_accessKeyNodes.size());
+
+    QHash<QChar, QRect>::const_iterator it = m_accessKeyNodes.constBegin();
+    while (it != m_accessKeyNodes.constEnd()) {
+        AKN_Overlay::Label label;
+        label.key = it.key();
+        label.rect = it.value();
+        labels.append(label);
+        ++it;
     }
+
+    m_overlay = new AKN_Overlay(parent);
+    m_overlay->setGeometry(QRect(offset, m_view.data()->size()));
+    m_overlay->setLabels(labels);
+    m_overlay->show();
+    m_overlay->raise();
+
+    // Install event filter and connect loadStarted
+    m_accessKeysVisible = true;
+    m_view.data()->installEventFilter(this);
+    m_view.data()->inputWidget()->installEventFilter(this);
+    connect(m_view.data(), SIGNAL(loadStarted()), this, SLOT(hideAccessKeys()));
+    connect(m_view.data()->page(), SIGNAL(scrollPositionChanged(QPointF)), this, SLOT(hideAccessKeys()));
 }
 
 void AKN_Handler::hideAccessKeys()
 {
-    if (!m_accessKeyLabels.isEmpty() && m_view) {
-        // Fixes crash when hiding labels while closing view
-        if (!m_view->inherits("WebView")) {
-            m_accessKeyLabels.clear();
-            m_accessKeyNodes.clear();
-            return;
-        }
-
-        for (int i = 0; i < m_accessKeyLabels.count(); ++i) {
-            QLabel* label = m_accessKeyLabels[i];
-            label->hide();
-            label->deleteLater();
-        }
-        m_accessKeyLabels.clear();
-        m_accessKeyNodes.clear();
-        m_view.data()->update();
-
+    if (m_accessKeysVisible && m_view) {
         // Uninstall event filter and disconnect loadStarted
         m_view.data()->removeEventFilter(this);
+        m_view.data()->inputWidget()->removeEventFilter(this);
         disconnect(m_view.data(), SIGNAL(loadStarted()), this, SLOT(hideAccessKeys()));
-        disconnect(m_view.data()->page(), SIGNAL(scrollRequested(int,int,QRect)), this, SLOT(hideAccessKeys()));
-#if QT_VERSION >= 0x040800
-        disconnect(m_view.data()->page(), SIGNAL(viewportChangeRequested()), this, SLOT(hideAccessKeys()));
-#endif
+        disconnect(m_view.data()->page(), SIGNAL(scrollPositionChanged(QPointF)), this, SLOT(hideAccessKeys()));
     }
 
-    m_accessKeysVisible = false;
-}
+    if (m_overlay) {
+        m_overlay->hide();
+        m_overlay->deleteLater();
+    }
 
-void AKN_Handler::makeAccessKeyLabel(const QChar &accessKey, const QWebElement &element)
-{
-    QLabel* label = new QLabel(m_view.data()->overlayWidget());
-    label->setText(QString(QLatin1String("<b>%1</b>")).arg(accessKey));
-
-    QPalette p = QToolTip::palette();
-    QColor color = QColor(220, 243, 253);
-    color.setAlpha(175);
-    p.setColor(QPalette::Window, color);
-
-    label->setPalette(p);
-    label->setAutoFillBackground(true);
-    label->setFrameStyle(QFrame::Box | QFrame::Plain);
-    QPoint point = element.geometry().center();
-    point -= m_view.data()->page()->currentFrame()->scrollPosition();
-    label->show();
-    label->resize(label->sizeHint());
-    point.setX(point.x() - label->width() / 2);
-    label->move(point);
-    m_accessKeyLabels.append(label);
-    m_accessKeyNodes[accessKey] = element;
+    m_accessKeyNodes.clear();
+    m_accessKeysVisible = false;
 }
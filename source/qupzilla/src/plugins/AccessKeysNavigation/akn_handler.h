@@ -21,15 +21,15 @@
 #include <QObject>
 #include <QTime>
 #include <QHash>
-#include <QWebElement>
+#include <QRect>
+#include <QVariant>
 #include <QPointer>
 
 class QKeyEvent;
-class QWebElement;
 class QTime;
-class QLabel;
 
 class WebView;
+class AKN_Overlay;
 
 class AKN_Handler : public QObject
 {
@@ -54,13 +54,14 @@ private slots:
 private:
     void triggerShowAccessKeys();
 
-    void makeAccessKeyLabel(const QChar &accessKey, const QWebElement &element);
+    void createAccessKeys(const QVariantList &elements);
     void handleAccessKey(QKeyEvent* event);
 
     QPointer<WebView> m_view;
+    QPointer<AKN_Overlay> m_overlay;
 
-    QList<QLabel*> m_accessKeyLabels;
-    QHash<QChar, QWebElement> m_accessKeyNodes;
+    // Element rects in view coordinates
+    QHash<QChar, QRect> m_accessKeyNodes;
     bool m_accessKeysVisible;
 
     Qt::Key m_key;
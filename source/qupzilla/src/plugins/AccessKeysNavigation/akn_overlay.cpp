@@ -0,0 +1,72 @@
+/* ============================================================
+* Access Keys Navigation plugin for QupZilla
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "akn_overlay.h"
+
+#include <QPainter>
+#include <QPaintEvent>
+
+AKN_Overlay::AKN_Overlay(QWidget* parent)
+    : QWidget(parent)
+{
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setAttribute(Qt::WA_NoSystemBackground);
+
+    QFont f = font();
+    f.setBold(true);
+    setFont(f);
+}
+
+void AKN_Overlay::setLabels(const QVector<Label> &labels)
+{
+    const QFontMetrics fm = fontMetrics();
+    const int height = fm.height() + 2;
+
+    m_labels.clear();
+    m_labels.reserve(labels.size());
+
+    foreach (const Label &label, labels) {
+        const int width = fm.width(label.key) + 6;
+        const QPoint center = label.rect.center();
+
+        Label l;
+        l.key = label.key;
+        l.rect = QRect(center.x() - width / 2, center.y() - height / 2, width, height);
+        m_labels.append(l);
+    }
+
+    update();
+}
+
+void AKN_Overlay::paintEvent(QPaintEvent* event)
+{
+    QColor background(220, 243, 253);
+    background.setAlpha(175);
+
+    QPainter p(this);
+    p.setPen(palette().color(QPalette::ToolTipText));
+
+    foreach (const Label &label, m_labels) {
+        if (!event->rect().intersects(label.rect)) {
+            continue;
+        }
+
+        p.fillRect(label.rect, background);
+        p.drawRect(label.rect.adjusted(0, 0, -1, -1));
+        p.drawText(label.rect, Qt::AlignCenter, QString(label.key));
+    }
+}
@@ -0,0 +1,44 @@
+/* ============================================================
+* Access Keys Navigation plugin for QupZilla
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef AKN_OVERLAY_H
+#define AKN_OVERLAY_H
+
+#include <QWidget>
+#include <QVector>
+
+class AKN_Overlay : public QWidget
+{
+public:
+    struct Label {
+        QChar key;
+        QRect rect;
+    };
+
+    explicit AKN_Overlay(QWidget* parent = 0);
+
+    // Rects are in overlay coordinates and are centered on the labeled element
+    void setLabels(const QVector<Label> &labels);
+
+protected:
+    void paintEvent(QPaintEvent* event);
+
+private:
+    QVector<Label> m_labels;
+};
+
+#endif // AKN_OVERLAY_H
@@ -6,13 +6,17 @@ SOURCES += tabmanagerplugin.cpp \
     tabmanagerwidget.cpp \
     tabmanagerwidgetcontroller.cpp \
     tabmanagersettings.cpp \
-    tabmanagerdelegate.cpp
+    tabmanagerdelegate.cpp \
+    tabmanagermodel.cpp \
+    tabmanagerfiltermodel.cpp
 
 HEADERS += tabmanagerplugin.h \
     tabmanagerwidget.h \
     tabmanagerwidgetcontroller.h \
     tabmanagersettings.h \
-    tabmanagerdelegate.h
+    tabmanagerdelegate.h \
+    tabmanagermodel.h \
+    tabmanagerfiltermodel.h
 
 RESOURCES += tabmanagerplugin.qrc
 
@@ -17,7 +17,7 @@
 * along with this program.  If not, see <http://www.gnu.org/licenses/>.
 * ============================================================ */
 #include "tabmanagerdelegate.h"
-#include "tabmanagerwidget.h"
+#include "tabmanagermodel.h"
 
 #include <QPainter>
 #include <QApplication>
@@ -37,8 +37,8 @@ void TabManagerDelegate::paint(QPainter* painter, const QStyleOptionViewItem &op
     const QWidget* w = opt.widget;
     const QStyle* style = w ? w->style() : QApplication::style();
     const Qt::LayoutDirection direction = w ? w->layoutDirection() : QApplication::layoutDirection();
-    const bool isActiveOrCaption = index.data(TabItem::ActiveOrCaptionRole).toBool();
-    const bool isSavedTab = index.data(TabItem::SavedRole).toBool();
+    const bool isActiveOrCaption = index.data(TabManagerModel::ActiveOrCaptionRole).toBool();
+    const bool isSavedTab = index.data(TabManagerModel::SavedRole).toBool();
 
     const QPalette::ColorRole colorRole = opt.state & QStyle::State_Selected ? QPalette::HighlightedText : QPalette::Text;
 
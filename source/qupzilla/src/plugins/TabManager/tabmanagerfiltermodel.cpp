@@ -0,0 +1,104 @@
+/* ============================================================
+* TabManager plugin for QupZilla
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "tabmanagerfiltermodel.h"
+#include "tabmodel.h"
+
+#include <QUrl>
+
+TabManagerFilterModel::TabManagerFilterModel(QObject* parent)
+    : QSortFilterProxyModel(parent)
+{
+}
+
+QString TabManagerFilterModel::filterText() const
+{
+    return m_filterText;
+}
+
+void TabManagerFilterModel::setFilterText(const QString &text)
+{
+    const QString filterText = text.simplified();
+    if (m_filterText == filterText) {
+        return;
+    }
+
+    m_filterText = filterText;
+    m_filterRegExp = QRegularExpression(QString(m_filterText).replace(QLatin1Char(' '), QLatin1String(".*"))
+                                        .append(QLatin1String(".*")).prepend(QLatin1String(".*")),
+                                        QRegularExpression::CaseInsensitiveOption);
+    invalidateFilter();
+}
+
+void TabManagerFilterModel::setSourceModel(QAbstractItemModel* sourceModel)
+{
+    if (this->sourceModel()) {
+        this->sourceModel()->disconnect(this);
+    }
+
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+
+    // Group is visible only with visible tabs, but QSortFilterProxyModel
+    // doesn't filter parents again when their children change
+    connect(sourceModel, &QAbstractItemModel::rowsInserted, this, &TabManagerFilterModel::sourceRowsChanged);
+    connect(sourceModel, &QAbstractItemModel::rowsRemoved, this, &TabManagerFilterModel::sourceRowsChanged);
+    connect(sourceModel, &QAbstractItemModel::dataChanged, this, [this](const QModelIndex &topLeft) {
+        sourceRowsChanged(topLeft.parent());
+    });
+}
+
+bool TabManagerFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    if (m_filterText.isEmpty()) {
+        return true;
+    }
+
+    const QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+
+    if (sourceParent.isValid()) {
+        return tabAccepted(index);
+    }
+
+    const int count = sourceModel()->rowCount(index);
+    for (int i = 0; i < count; ++i) {
+        if (tabAccepted(sourceModel()->index(i, 0, index))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TabManagerFilterModel::tabAccepted(const QModelIndex &index) const
+{
+    return index.data(Qt::DisplayRole).toString().contains(m_filterRegExp) ||
+           index.data(TabModel::UrlRole).toUrl().toString().simplified().contains(m_filterRegExp);
+}
+
+void TabManagerFilterModel::sourceRowsChanged(const QModelIndex &parent)
+{
+    if (m_filterText.isEmpty() || !parent.isValid()) {
+        return;
+    }
+
+    // Re-evaluate only the group of changed tabs
+    const QModelIndex groupIndex = parent.sibling(parent.row(), 0);
+    const bool visible = mapFromSource(groupIndex).isValid();
+    if (visible != filterAcceptsRow(groupIndex.row(), QModelIndex())) {
+        invalidateFilter();
+    }
+}
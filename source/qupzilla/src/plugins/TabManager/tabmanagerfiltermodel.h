@@ -0,0 +1,47 @@
+/* ============================================================
+* TabManager plugin for QupZilla
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef TABMANAGERFILTERMODEL_H
+#define TABMANAGERFILTERMODEL_H
+
+#include <QSortFilterProxyModel>
+#include <QRegularExpression>
+
+class TabManagerFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+public:
+    explicit TabManagerFilterModel(QObject* parent = 0);
+
+    QString filterText() const;
+    void setFilterText(const QString &text);
+
+    void setSourceModel(QAbstractItemModel* sourceModel) override;
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+
+private:
+    bool tabAccepted(const QModelIndex &index) const;
+    void sourceRowsChanged(const QModelIndex &parent);
+
+    QString m_filterText;
+    QRegularExpression m_filterRegExp;
+};
+
+#endif // TABMANAGERFILTERMODEL_H
@@ -0,0 +1,827 @@
+/* ============================================================
+* TabManager plugin for QupZilla
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "tabmanagermodel.h"
+#include "mainapplication.h"
+#include "browserwindow.h"
+#include "tabwidget.h"
+#include "tabmodel.h"
+#include "webtab.h"
+#include "pluginproxy.h"
+
+#include <QMimeData>
+
+#include <algorithm>
+
+TabManagerModel::TabManagerModel(BrowserWindow* currentWindow, bool currentWindowFirst, QObject* parent)
+    : QAbstractItemModel(parent)
+    , m_groupType(TabManagerWidget::GroupByWindow)
+    , m_currentWindow(currentWindow)
+{
+    QList<BrowserWindow*> windows = mApp->windows();
+    if (currentWindowFirst && windows.contains(currentWindow)) {
+        windows.move(windows.indexOf(currentWindow), 0);
+    }
+
+    for (BrowserWindow* window : qAsConst(windows)) {
+        m_windows.append(window);
+        connectWindow(window);
+    }
+
+    rebuild();
+
+    connect(mApp->plugins(), &PluginProxy::mainWindowCreated, this, &TabManagerModel::addWindow);
+    connect(mApp->plugins(), &PluginProxy::mainWindowDeleted, this, &TabManagerModel::removeWindow);
+}
+
+TabManagerModel::~TabManagerModel()
+{
+    qDeleteAll(m_groups);
+}
+
+TabManagerWidget::GroupType TabManagerModel::groupType() const
+{
+    return m_groupType;
+}
+
+void TabManagerModel::setGroupType(TabManagerWidget::GroupType type)
+{
+    if (m_groupType == type) {
+        return;
+    }
+
+    m_groupType = type;
+    m_domainCache.clear();
+
+    beginResetModel();
+    rebuild();
+    endResetModel();
+}
+
+BrowserWindow* TabManagerModel::currentWindow() const
+{
+    return m_currentWindow.data();
+}
+
+void TabManagerModel::setCurrentWindow(BrowserWindow* window)
+{
+    if (m_currentWindow == window) {
+        return;
+    }
+
+    m_currentWindow = window;
+
+    if (m_groupType == TabManagerWidget::GroupByWindow && !m_groups.isEmpty()) {
+        emit dataChanged(index(0, 0), index(m_groups.count() - 1, 0), {ActiveOrCaptionRole});
+    }
+}
+
+QModelIndex TabManagerModel::tabIndex(WebTab* tab) const
+{
+    Group* g = m_tabGroups.value(tab);
+    if (!g) {
+        return QModelIndex();
+    }
+
+    return createIndex(g->tabs.indexOf(tab), 0, g);
+}
+
+WebTab* TabManagerModel::tab(const QModelIndex &index) const
+{
+    Group* g = static_cast<Group*>(index.internalPointer());
+    if (!index.isValid() || !g) {
+        return nullptr;
+    }
+
+    return g->tabs.value(index.row());
+}
+
+BrowserWindow* TabManagerModel::window(const QModelIndex &index) const
+{
+    if (WebTab* t = tab(index)) {
+        return m_tabWindows.value(t);
+    }
+
+    Group* g = group(index);
+    return g ? g->window : nullptr;
+}
+
+bool TabManagerModel::isGroup(const QModelIndex &index) const
+{
+    return index.isValid() && !index.internalPointer();
+}
+
+bool TabManagerModel::hasCheckedTabs() const
+{
+    return !m_checkedTabs.isEmpty();
+}
+
+QHash<BrowserWindow*, WebTab*> TabManagerModel::takeCheckedTabs()
+{
+    QHash<BrowserWindow*, WebTab*> tabs;
+
+    // Keep the order of tabs in the tree
+    for (Group* g : qAsConst(m_groups)) {
+        for (WebTab* t : qAsConst(g->tabs)) {
+            if (!m_checkedTabs.contains(t)) {
+                continue;
+            }
+
+            // current supported actions are not applied to pinned tabs
+            if (!t->isPinned()) {
+                tabs.insertMulti(m_tabWindows.value(t), t);
+            }
+        }
+    }
+
+    const QSet<WebTab*> checkedTabs = m_checkedTabs;
+    m_checkedTabs.clear();
+
+    for (WebTab* t : checkedTabs) {
+        emitTabChanged(t, {Qt::CheckStateRole});
+    }
+
+    for (Group* g : qAsConst(m_groups)) {
+        emitGroupChanged(g);
+    }
+
+    return tabs;
+}
+
+QModelIndex TabManagerModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (column < 0 || column > 1 || row < 0) {
+        return QModelIndex();
+    }
+
+    if (!parent.isValid()) {
+        return row < m_groups.count() ? createIndex(row, column, nullptr) : QModelIndex();
+    }
+
+    Group* g = group(parent);
+    if (!g || row >= g->tabs.count()) {
+        return QModelIndex();
+    }
+
+    return createIndex(row, column, g);
+}
+
+QModelIndex TabManagerModel::parent(const QModelIndex &child) const
+{
+    Group* g = static_cast<Group*>(child.internalPointer());
+    if (!child.isValid() || !g) {
+        return QModelIndex();
+    }
+
+    return groupIndex(g);
+}
+
+int TabManagerModel::rowCount(const QModelIndex &parent) const
+{
+    if (!parent.isValid()) {
+        return m_groups.count();
+    }
+
+    if (parent.column() > 0) {
+        return 0;
+    }
+
+    Group* g = group(parent);
+    return g ? g->tabs.count() : 0;
+}
+
+int TabManagerModel::columnCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent)
+
+    return 2;
+}
+
+Qt::ItemFlags TabManagerModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+
+    Qt::ItemFlags flags = Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+
+    if (index.column() > 0) {
+        return flags;
+    }
+
+    flags |= Qt::ItemIsUserCheckable;
+
+    if (isGroup(index)) {
+        if (m_groupType == TabManagerWidget::GroupByWindow) {
+            flags |= Qt::ItemIsDropEnabled;
+        }
+    }
+    else {
+        flags |= Qt::ItemNeverHasChildren;
+        if (m_groupType == TabManagerWidget::GroupByWindow) {
+            flags |= Qt::ItemIsDragEnabled;
+        }
+    }
+
+    return flags;
+}
+
+QVariant TabManagerModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.column() > 0) {
+        return QVariant();
+    }
+
+    if (isGroup(index)) {
+        Group* g = group(index);
+        if (!g) {
+            return QVariant();
+        }
+
+        const bool windowGroup = m_groupType == TabManagerWidget::GroupByWindow;
+
+        switch (role) {
+        case Qt::DisplayRole:
+            return windowGroup ? tr("Window %1").arg(QString::number(index.row() + 1)) : g->key;
+
+        case Qt::ToolTipRole:
+            return windowGroup ? tr("Double click to switch") : g->key;
+
+        case ActiveOrCaptionRole:
+            return windowGroup ? g->window == m_currentWindow.data() : true;
+
+        case Qt::CheckStateRole: {
+            int checked = 0;
+            for (WebTab* t : qAsConst(g->tabs)) {
+                if (m_checkedTabs.contains(t)) {
+                    ++checked;
+                }
+            }
+            if (checked == 0) {
+                return Qt::Unchecked;
+            }
+            return checked == g->tabs.count() ? Qt::Checked : Qt::PartiallyChecked;
+        }
+
+        default:
+            return QVariant();
+        }
+    }
+
+    WebTab* t = tab(index);
+    if (!t) {
+        return QVariant();
+    }
+
+    switch (role) {
+    case Qt::DisplayRole:
+    case Qt::ToolTipRole:
+        return t->title();
+
+    case Qt::DecorationRole:
+        if (t->isLoading()) {
+            return QIcon(QSL(":tabmanager/data/tab-loading.png"));
+        }
+        if (t->isPinned()) {
+            return QIcon(QSL(":tabmanager/data/tab-pinned.png"));
+        }
+        if (t->isMuted()) {
+            return QIcon::fromTheme(QSL("audio-volume-muted"), QIcon(QSL(":icons/other/audiomuted.svg")));
+        }
+        if (t->isPlaying()) {
+            return QIcon::fromTheme(QSL("audio-volume-high"), QIcon(QSL(":icons/other/audioplaying.svg")));
+        }
+        return t->icon();
+
+    case ActiveOrCaptionRole:
+        return (t->isLoading() || t->isRestored()) && t->isCurrentTab();
+
+    case SavedRole:
+        return !t->isLoading() && !t->isRestored();
+
+    case Qt::CheckStateRole:
+        return m_checkedTabs.contains(t) ? Qt::Checked : Qt::Unchecked;
+
+    default:
+        break;
+    }
+
+    // Other roles are the same as in TabModel
+    BrowserWindow* w = m_tabWindows.value(t);
+    if (role > Qt::UserRole && w && w->tabModel()) {
+        return w->tabModel()->tabIndex(t).data(role);
+    }
+
+    return QVariant();
+}
+
+bool TabManagerModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!index.isValid() || index.column() > 0 || role != Qt::CheckStateRole) {
+        return false;
+    }
+
+    const bool checked = value.toInt() != Qt::Unchecked;
+
+    if (isGroup(index)) {
+        Group* g = group(index);
+        if (!g || g->tabs.isEmpty()) {
+            return false;
+        }
+
+        for (WebTab* t : qAsConst(g->tabs)) {
+            if (checked) {
+                m_checkedTabs.insert(t);
+            }
+            else {
+                m_checkedTabs.remove(t);
+            }
+        }
+
+        emit dataChanged(this->index(0, 0, index), this->index(g->tabs.count() - 1, 0, index), {Qt::CheckStateRole});
+        emitGroupChanged(g);
+        return true;
+    }
+
+    WebTab* t = tab(index);
+    if (!t) {
+        return false;
+    }
+
+    if (checked) {
+        m_checkedTabs.insert(t);
+    }
+    else {
+        m_checkedTabs.remove(t);
+    }
+
+    emit dataChanged(index, index, {Qt::CheckStateRole});
+    emitGroupChanged(m_tabGroups.value(t));
+    return true;
+}
+
+Qt::DropActions TabManagerModel::supportedDropActions() const
+{
+    return Qt::MoveAction;
+}
+
+QStringList TabManagerModel::mimeTypes() const
+{
+    return {TabModelMimeData::mimeType()};
+}
+
+QMimeData* TabManagerModel::mimeData(const QModelIndexList &indexes) const
+{
+    if (indexes.isEmpty()) {
+        return nullptr;
+    }
+
+    WebTab* t = tab(indexes.at(0));
+    if (!t) {
+        return nullptr;
+    }
+
+    TabModelMimeData* mimeData = new TabModelMimeData;
+    mimeData->setTab(t);
+    return mimeData;
+}
+
+bool TabManagerModel::canDropMimeData(const QMimeData* data, Qt::DropAction action, int row, int column, const QModelIndex &parent) const
+{
+    Q_UNUSED(row)
+    Q_UNUSED(column)
+
+    if (m_groupType != TabManagerWidget::GroupByWindow || !isGroup(parent)) {
+        return false;
+    }
+
+    Group* g = group(parent);
+    if (!g || !g->window || !g->window->tabModel()) {
+        return false;
+    }
+
+    return g->window->tabModel()->canDropMimeData(data, action, -1, 0, QModelIndex());
+}
+
+bool TabManagerModel::dropMimeData(const QMimeData* data, Qt::DropAction action, int row, int column, const QModelIndex &parent)
+{
+    if (!canDropMimeData(data, action, row, column, parent)) {
+        return false;
+    }
+
+    // Rows of window group are the same as rows of window's TabModel
+    Group* g = group(parent);
+    return g->window->tabModel()->dropMimeData(data, action, row, 0, QModelIndex());
+}
+
+void TabManagerModel::addWindow(BrowserWindow* window)
+{
+    if (!window || m_windows.contains(window)) {
+        return;
+    }
+
+    m_windows.append(window);
+
+    if (m_groupType == TabManagerWidget::GroupByWindow) {
+        Group* g = new Group;
+        g->window = window;
+
+        beginInsertRows(QModelIndex(), m_groups.count(), m_groups.count());
+        m_groups.append(g);
+        endInsertRows();
+    }
+
+    connectWindow(window);
+
+    TabModel* model = window->tabModel();
+    if (model && model->rowCount() > 0) {
+        sourceRowsInserted(window, 0, model->rowCount() - 1);
+    }
+}
+
+void TabManagerModel::removeWindow(BrowserWindow* window)
+{
+    const int windowIndex = m_windows.indexOf(window);
+    if (windowIndex == -1) {
+        return;
+    }
+
+    if (window->tabModel()) {
+        window->tabModel()->disconnect(this);
+    }
+
+    const QList<WebTab*> tabs = m_tabWindows.keys(window);
+    for (WebTab* t : tabs) {
+        removeTab(t);
+    }
+
+    m_windows.remove(windowIndex);
+
+    if (m_groupType == TabManagerWidget::GroupByWindow) {
+        for (Group* g : qAsConst(m_groups)) {
+            if (g->window == window) {
+                removeGroup(g);
+                break;
+            }
+        }
+
+        // Window titles contain their position
+        if (!m_groups.isEmpty()) {
+            emit dataChanged(index(0, 0), index(m_groups.count() - 1, 0), {Qt::DisplayRole});
+        }
+    }
+}
+
+TabManagerModel::Group* TabManagerModel::group(const QModelIndex &index) const
+{
+    if (!index.isValid() || index.internalPointer()) {
+        return nullptr;
+    }
+
+    return m_groups.value(index.row());
+}
+
+QModelIndex TabManagerModel::groupIndex(Group* group, int column) const
+{
+    const int row = m_groups.indexOf(group);
+    return row == -1 ? QModelIndex() : createIndex(row, column, nullptr);
+}
+
+TabManagerModel::Group* TabManagerModel::createGroup(WebTab* tab, BrowserWindow* window)
+{
+    if (m_groupType == TabManagerWidget::GroupByWindow) {
+        for (Group* g : qAsConst(m_groups)) {
+            if (g->window == window) {
+                return g;
+            }
+        }
+        return nullptr;
+    }
+
+    const QString key = groupKey(tab);
+
+    // Domain groups are sorted by name
+    int row = 0;
+    for (; row < m_groups.count(); ++row) {
+        const int cmp = QString::compare(m_groups.at(row)->key, key);
+        if (cmp == 0) {
+            return m_groups.at(row);
+        }
+        if (cmp > 0) {
+            break;
+        }
+    }
+
+    Group* g = new Group;
+    g->key = key;
+    g->window = nullptr;
+
+    beginInsertRows(QModelIndex(), row, row);
+    m_groups.insert(row, g);
+    endInsertRows();
+
+    return g;
+}
+
+QString TabManagerModel::groupKey(WebTab* tab) const
+{
+    const QUrl url = tab->url();
+    const bool useHostName = m_groupType == TabManagerWidget::GroupByHost;
+
+    if (url.host().isEmpty()) {
+        return TabManagerWidget::domainFromUrl(url, useHostName);
+    }
+
+    // Looking up registrable domain is expensive, do it only once per host
+    const QString cacheKey = url.scheme() + QL1C(':') + url.host();
+    auto it = m_domainCache.constFind(cacheKey);
+    if (it != m_domainCache.constEnd()) {
+        return it.value();
+    }
+
+    const QString key = TabManagerWidget::domainFromUrl(url, useHostName);
+    m_domainCache.insert(cacheKey, key);
+    return key;
+}
+
+void TabManagerModel::insertTab(WebTab* tab, BrowserWindow* window, int sourceRow)
+{
+    Group* g = createGroup(tab, window);
+    if (!g) {
+        return;
+    }
+
+    const QModelIndex parent = groupIndex(g);
+    const int row = m_groupType == TabManagerWidget::GroupByWindow ? qBound(0, sourceRow, g->tabs.count()) : g->tabs.count();
+
+    beginInsertRows(parent, row, row);
+    g->tabs.insert(row, tab);
+    m_tabGroups.insert(tab, g);
+    m_tabWindows.insert(tab, window);
+    endInsertRows();
+
+    emitGroupChanged(g);
+}
+
+void TabManagerModel::removeTab(WebTab* tab)
+{
+    Group* g = m_tabGroups.value(tab);
+    if (!g) {
+        return;
+    }
+
+    const int row = g->tabs.indexOf(tab);
+
+    beginRemoveRows(groupIndex(g), row, row);
+    g->tabs.remove(row);
+    m_tabGroups.remove(tab);
+    m_tabWindows.remove(tab);
+    m_checkedTabs.remove(tab);
+    endRemoveRows();
+
+    if (g->tabs.isEmpty() && m_groupType != TabManagerWidget::GroupByWindow) {
+        removeGroup(g);
+    }
+    else {
+        emitGroupChanged(g);
+    }
+}
+
+void TabManagerModel::removeGroup(Group* group)
+{
+    const int row = m_groups.indexOf(group);
+    if (row == -1) {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_groups.remove(row);
+    endRemoveRows();
+
+    delete group;
+}
+
+void TabManagerModel::emitGroupChanged(Group* group)
+{
+    const QModelIndex index = groupIndex(group);
+    if (index.isValid()) {
+        emit dataChanged(index, index, {Qt::CheckStateRole});
+    }
+}
+
+void TabManagerModel::emitTabChanged(WebTab* tab, const QVector<int> &roles)
+{
+    const QModelIndex index = tabIndex(tab);
+    if (index.isValid()) {
+        emit dataChanged(index, index.sibling(index.row(), 1), roles);
+    }
+}
+
+void TabManagerModel::sourceRowsInserted(BrowserWindow* window, int start, int end)
+{
+    TabModel* model = window->tabModel();
+
+    for (int i = start; i <= end; ++i) {
+        WebTab* t = model->tab(model->index(i));
+        if (t) {
+            insertTab(t, window, i);
+        }
+    }
+}
+
+void TabManagerModel::sourceRowsAboutToBeRemoved(BrowserWindow* window, int start, int end)
+{
+    TabModel* model = window->tabModel();
+
+    for (int i = start; i <= end; ++i) {
+        removeTab(model->tab(model->index(i)));
+    }
+}
+
+void TabManagerModel::sourceRowsMoved(BrowserWindow* window, int start, int end, int row)
+{
+    // Order of tabs in domain groups doesn't follow tab bar
+    if (m_groupType != TabManagerWidget::GroupByWindow) {
+        return;
+    }
+
+    Group* g = createGroup(nullptr, window);
+    if (!g) {
+        return;
+    }
+
+    const QModelIndex parent = groupIndex(g);
+    if (!beginMoveRows(parent, start, end, parent, row)) {
+        return;
+    }
+
+    const QVector<WebTab*> moved = g->tabs.mid(start, end - start + 1);
+    g->tabs.remove(start, moved.count());
+
+    int to = row > start ? row - moved.count() : row;
+    for (WebTab* t : moved) {
+        g->tabs.insert(to++, t);
+    }
+
+    endMoveRows();
+}
+
+void TabManagerModel::sourceDataChanged(BrowserWindow* window, const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    TabModel* model = window->tabModel();
+
+    const bool urlChanged = roles.isEmpty() || roles.contains(TabModel::UrlRole) || roles.contains(TabModel::RestoredRole);
+
+    // Roles that are computed from TabModel roles
+    QVector<int> changedRoles = roles;
+    if (!roles.isEmpty()) {
+        for (int role : roles) {
+            switch (role) {
+            case TabModel::TitleRole:
+                changedRoles << Qt::ToolTipRole;
+                break;
+            case TabModel::IconRole:
+            case TabModel::PinnedRole:
+            case TabModel::AudioPlayingRole:
+            case TabModel::AudioMutedRole:
+                changedRoles << Qt::DecorationRole;
+                break;
+            case TabModel::LoadingRole:
+            case TabModel::RestoredRole:
+            case TabModel::CurrentTabRole:
+                changedRoles << Qt::DecorationRole << ActiveOrCaptionRole << SavedRole;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    for (int i = topLeft.row(); i <= bottomRight.row(); ++i) {
+        WebTab* t = model->tab(model->index(i));
+        Group* g = m_tabGroups.value(t);
+        if (!g) {
+            continue;
+        }
+
+        // Tab needs to be moved to another group
+        if (urlChanged && m_groupType != TabManagerWidget::GroupByWindow && groupKey(t) != g->key) {
+            const bool checked = m_checkedTabs.contains(t);
+            removeTab(t);
+            insertTab(t, window, i);
+            if (checked) {
+                m_checkedTabs.insert(t);
+                emitTabChanged(t, {Qt::CheckStateRole});
+                emitGroupChanged(m_tabGroups.value(t));
+            }
+            continue;
+        }
+
+        emitTabChanged(t, changedRoles);
+    }
+}
+
+void TabManagerModel::sourceReset(BrowserWindow* window)
+{
+    const QList<WebTab*> tabs = m_tabWindows.keys(window);
+    for (WebTab* t : tabs) {
+        removeTab(t);
+    }
+
+    TabModel* model = window->tabModel();
+    if (model && model->rowCount() > 0) {
+        sourceRowsInserted(window, 0, model->rowCount() - 1);
+    }
+}
+
+void TabManagerModel::connectWindow(BrowserWindow* window)
+{
+    TabModel* model = window->tabModel();
+    if (!model) {
+        return;
+    }
+
+    connect(model, &TabModel::rowsInserted, this, [=](const QModelIndex &, int start, int end) {
+        sourceRowsInserted(window, start, end);
+    });
+    connect(model, &TabModel::rowsAboutToBeRemoved, this, [=](const QModelIndex &, int start, int end) {
+        sourceRowsAboutToBeRemoved(window, start, end);
+    });
+    connect(model, &TabModel::rowsMoved, this, [=](const QModelIndex &, int start, int end, const QModelIndex &, int row) {
+        sourceRowsMoved(window, start, end, row);
+    });
+    connect(model, &TabModel::dataChanged, this, [=](const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles) {
+        sourceDataChanged(window, topLeft, bottomRight, roles);
+    });
+    connect(model, &TabModel::modelReset, this, [=]() {
+        sourceReset(window);
+    });
+}
+
+void TabManagerModel::rebuild()
+{
+    qDeleteAll(m_groups);
+    m_groups.clear();
+    m_tabGroups.clear();
+    m_tabWindows.clear();
+
+    QHash<QString, Group*> domainGroups;
+
+    for (BrowserWindow* window : qAsConst(m_windows)) {
+        Group* windowGroup = nullptr;
+        if (m_groupType == TabManagerWidget::GroupByWindow) {
+            windowGroup = new Group;
+            windowGroup->window = window;
+            m_groups.append(windowGroup);
+        }
+
+        TabModel* model = window->tabModel();
+        if (!model) {
+            continue;
+        }
+
+        for (int i = 0; i < model->rowCount(); ++i) {
+            WebTab* t = model->tab(model->index(i));
+            if (!t) {
+                continue;
+            }
+
+            Group* g = windowGroup;
+            if (!g) {
+                const QString key = groupKey(t);
+                g = domainGroups.value(key);
+                if (!g) {
+                    g = new Group;
+                    g->key = key;
+                    g->window = nullptr;
+                    m_groups.append(g);
+                    domainGroups.insert(key, g);
+                }
+            }
+
+            g->tabs.append(t);
+            m_tabGroups.insert(t, g);
+            m_tabWindows.insert(t, window);
+        }
+    }
+
+    if (m_groupType != TabManagerWidget::GroupByWindow) {
+        std::sort(m_groups.begin(), m_groups.end(), [](Group* a, Group* b) {
+            return QString::compare(a->key, b->key) < 0;
+        });
+    }
+}
@@ -0,0 +1,119 @@
+/* ============================================================
+* TabManager plugin for QupZilla
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#ifndef TABMANAGERMODEL_H
+#define TABMANAGERMODEL_H
+
+#include <QAbstractItemModel>
+#include <QPointer>
+#include <QHash>
+#include <QSet>
+
+#include "tabmanagerwidget.h"
+
+class BrowserWindow;
+class TabModel;
+class WebTab;
+
+// Groups tabs of all windows on top of their TabModels. Groups and tabs are
+// updated from row inserts, removals, moves and data changes only.
+class TabManagerModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        ActiveOrCaptionRole = Qt::UserRole + 100,
+        SavedRole = Qt::UserRole + 101
+    };
+
+    explicit TabManagerModel(BrowserWindow* currentWindow, bool currentWindowFirst, QObject* parent = 0);
+    ~TabManagerModel();
+
+    TabManagerWidget::GroupType groupType() const;
+    void setGroupType(TabManagerWidget::GroupType type);
+
+    BrowserWindow* currentWindow() const;
+    void setCurrentWindow(BrowserWindow* window);
+
+    QModelIndex tabIndex(WebTab* tab) const;
+    WebTab* tab(const QModelIndex &index) const;
+    BrowserWindow* window(const QModelIndex &index) const;
+    bool isGroup(const QModelIndex &index) const;
+
+    bool hasCheckedTabs() const;
+    // Returns checked tabs and unchecks them, pinned tabs are skipped
+    QHash<BrowserWindow*, WebTab*> takeCheckedTabs();
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex &child) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+
+    Qt::DropActions supportedDropActions() const override;
+    QStringList mimeTypes() const override;
+    QMimeData* mimeData(const QModelIndexList &indexes) const override;
+    bool canDropMimeData(const QMimeData* data, Qt::DropAction action, int row, int column, const QModelIndex &parent) const override;
+    bool dropMimeData(const QMimeData* data, Qt::DropAction action, int row, int column, const QModelIndex &parent) override;
+
+public slots:
+    void addWindow(BrowserWindow* window);
+    void removeWindow(BrowserWindow* window);
+
+private:
+    struct Group {
+        QString key;
+        BrowserWindow* window;
+        QVector<WebTab*> tabs;
+    };
+
+    Group* group(const QModelIndex &index) const;
+    QModelIndex groupIndex(Group* group, int column = 0) const;
+    Group* createGroup(WebTab* tab, BrowserWindow* window);
+    QString groupKey(WebTab* tab) const;
+
+    void insertTab(WebTab* tab, BrowserWindow* window, int sourceRow);
+    void removeTab(WebTab* tab);
+    void removeGroup(Group* group);
+    void emitGroupChanged(Group* group);
+    void emitTabChanged(WebTab* tab, const QVector<int> &roles = QVector<int>());
+
+    void sourceRowsInserted(BrowserWindow* window, int start, int end);
+    void sourceRowsAboutToBeRemoved(BrowserWindow* window, int start, int end);
+    void sourceRowsMoved(BrowserWindow* window, int start, int end, int row);
+    void sourceDataChanged(BrowserWindow* window, const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+    void sourceReset(BrowserWindow* window);
+
+    void connectWindow(BrowserWindow* window);
+    void rebuild();
+
+    TabManagerWidget::GroupType m_groupType;
+    QPointer<BrowserWindow> m_currentWindow;
+
+    QVector<BrowserWindow*> m_windows;
+    QVector<Group*> m_groups;
+    QHash<WebTab*, Group*> m_tabGroups;
+    QHash<WebTab*, BrowserWindow*> m_tabWindows;
+    QSet<WebTab*> m_checkedTabs;
+
+    mutable QHash<QString, QString> m_domainCache;
+};
+
+#endif // TABMANAGERMODEL_H
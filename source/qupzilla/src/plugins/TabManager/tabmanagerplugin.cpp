@@ -66,8 +66,6 @@ void TabManagerPlugin::init(InitState state, const QString &settingsPath)
     m_controller = new TabManagerWidgetController(this);
     connect(mApp->plugins(), SIGNAL(mainWindowCreated(BrowserWindow*)), this, SLOT(mainWindowCreated(BrowserWindow*)));
     connect(mApp->plugins(), SIGNAL(mainWindowDeleted(BrowserWindow*)), m_controller, SLOT(mainWindowDeleted(BrowserWindow*)));
-    connect(mApp->plugins(), SIGNAL(webPageCreated(WebPage*)), m_controller, SIGNAL(requestRefreshTree()));
-    connect(mApp->plugins(), SIGNAL(webPageDeleted(WebPage*)), m_controller, SIGNAL(requestRefreshTree(WebPage*)));
 
     s_settingsPath = settingsPath + QL1S("/TabManager");
     m_initState = true;
@@ -136,13 +134,13 @@ void TabManagerPlugin::insertManagerWidget()
 
     if (m_initState) {
         foreach (BrowserWindow* window, mApp->windows()) {
-            mainWindowCreated(window, false);
+            mainWindowCreated(window);
         }
         m_initState = false;
     }
 }
 
-void TabManagerPlugin::mainWindowCreated(BrowserWindow* window, bool refresh)
+void TabManagerPlugin::mainWindowCreated(BrowserWindow* window)
 {
     if (window) {
         window->tabWidget()->tabBar()->setForceHidden(m_asTabBarReplacement);
@@ -150,13 +148,6 @@ void TabManagerPlugin::mainWindowCreated(BrowserWindow* window, bool refresh)
         if (m_viewType == ShowAsWindow) {
             m_controller->addStatusBarIcon(window);
         }
-
-        connect(window->tabWidget(), SIGNAL(currentChanged(int)), m_controller, SIGNAL(requestRefreshTree()));
-        connect(window->tabWidget(), SIGNAL(pinStateChanged(int,bool)), m_controller, SIGNAL(requestRefreshTree()));
-    }
-
-    if (refresh) {
-        m_controller->emitRefreshTree();
     }
 }
 
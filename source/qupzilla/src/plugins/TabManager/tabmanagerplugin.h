@@ -69,7 +69,7 @@ public slots:
     void insertManagerWidget();
 
 private slots:
-    void mainWindowCreated(BrowserWindow* window, bool refresh = true);
+    void mainWindowCreated(BrowserWindow* window);
 
 private:
     void setTabBarVisible(bool visible);
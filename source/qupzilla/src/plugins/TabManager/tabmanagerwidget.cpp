@@ -21,7 +21,6 @@
 #include "mainapplication.h"
 #include "browserwindow.h"
 #include "webtab.h"
-#include "webpage.h"
 #include "tabbedwebview.h"
 #include "tabwidget.h"
 #include "locationbar.h"
@@ -31,16 +30,19 @@
 #include "tabmanagerplugin.h"
 #include "tldextractor/tldextractor.h"
 #include "tabmanagerdelegate.h"
+#include "tabmanagermodel.h"
+#include "tabmanagerfiltermodel.h"
 #include "tabcontextmenu.h"
+#include "tabmodel.h"
 #include "tabbar.h"
 
 #include <QDesktopWidget>
 #include <QDialogButtonBox>
 #include <QStackedWidget>
+#include <QHeaderView>
 #include <QDialog>
 #include <QTimer>
 #include <QLabel>
-#include <QMimeData>
 
 TLDExtractor* TabManagerWidget::s_tldExtractor = 0;
 
@@ -48,11 +50,10 @@ TabManagerWidget::TabManagerWidget(BrowserWindow* mainClass, QWidget* parent, bo
     : QWidget(parent)
     , ui(new Ui::TabManagerWidget)
     , p_QupZilla(mainClass)
-    , m_webPage(0)
-    , m_isRefreshing(false)
-    , m_refreshBlocked(false)
-    , m_waitForRefresh(false)
+    , m_model(0)
+    , m_filterModel(0)
     , m_isDefaultWidget(defaultWidget)
+    , m_groupType(GroupByWindow)
 {
     if(s_tldExtractor == 0)
     {
@@ -61,19 +62,25 @@ TabManagerWidget::TabManagerWidget(BrowserWindow* mainClass, QWidget* parent, bo
     }
 
     ui->setupUi(this);
-    ui->treeWidget->setSelectionMode(QTreeWidget::SingleSelection);
-    ui->treeWidget->setUniformRowHeights(true);
-    ui->treeWidget->setColumnCount(2);
-    ui->treeWidget->header()->hide();
-    ui->treeWidget->header()->setStretchLastSection(false);
-    ui->treeWidget->header()->setSectionResizeMode(0, QHeaderView::Stretch);
-    ui->treeWidget->header()->setSectionResizeMode(1, QHeaderView::Fixed);
-    ui->treeWidget->header()->resizeSection(1, 16);
-
-    ui->treeWidget->setExpandsOnDoubleClick(false);
-    ui->treeWidget->setContextMenuPolicy(Qt::CustomContextMenu);
-
-    ui->treeWidget->installEventFilter(this);
+
+    m_model = new TabManagerModel(getQupZilla(), !m_isDefaultWidget, this);
+    m_filterModel = new TabManagerFilterModel(this);
+    m_filterModel->setSourceModel(m_model);
+
+    ui->treeView->setModel(m_filterModel);
+    ui->treeView->setSelectionMode(QTreeView::SingleSelection);
+    ui->treeView->setUniformRowHeights(true);
+    ui->treeView->header()->hide();
+    ui->treeView->header()->setStretchLastSection(false);
+    ui->treeView->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    ui->treeView->header()->setSectionResizeMode(1, QHeaderView::Fixed);
+    ui->treeView->header()->resizeSection(1, 16);
+
+    ui->treeView->setExpandsOnDoubleClick(false);
+    ui->treeView->setContextMenuPolicy(Qt::CustomContextMenu);
+    ui->treeView->setEnableDragTabs(true);
+
+    ui->treeView->installEventFilter(this);
     ui->filterBar->installEventFilter(this);
 
     QPushButton* closeButton = new QPushButton(ui->filterBar);
@@ -82,13 +89,36 @@ TabManagerWidget::TabManagerWidget(BrowserWindow* mainClass, QWidget* parent, bo
     ui->filterBar->addWidget(closeButton, LineEdit::RightSide);
     ui->filterBar->hide();
 
-    ui->treeWidget->setItemDelegate(new TabManagerDelegate(ui->treeWidget));
+    ui->treeView->setItemDelegate(new TabManagerDelegate(ui->treeView));
+    ui->treeView->expandAll();
+
+    // Newly added groups are expanded, existing items keep their state
+    connect(m_filterModel, &QAbstractItemModel::rowsInserted, this, [this](const QModelIndex &parent, int start, int end) {
+        if (!parent.isValid()) {
+            for (int i = start; i <= end; ++i) {
+                ui->treeView->expand(m_filterModel->index(i, 0));
+            }
+        }
+    });
+    connect(m_filterModel, &QAbstractItemModel::modelReset, ui->treeView, &QTreeView::expandAll);
+    connect(m_filterModel, &QAbstractItemModel::layoutChanged, ui->treeView, &QTreeView::expandAll);
+
+    connect(m_model, &QAbstractItemModel::dataChanged, this, [this](const QModelIndex &topLeft, const QModelIndex &, const QVector<int> &roles) {
+        if (roles.contains(TabModel::CurrentTabRole) && m_model->tab(topLeft) && m_model->tab(topLeft)->isCurrentTab()) {
+            scrollToCurrentTab();
+        }
+    });
+
+    if (m_isDefaultWidget) {
+        connect(mApp, &MainApplication::activeWindowChanged, m_model, &TabManagerModel::setCurrentWindow);
+    }
 
     connect(closeButton, SIGNAL(clicked(bool)), this, SLOT(filterBarClosed()));
     connect(ui->filterBar, SIGNAL(textChanged(QString)), this, SLOT(filterChanged(QString)));
-    connect(ui->treeWidget, SIGNAL(itemClicked(QTreeWidgetItem*,int)), this, SLOT(onItemActivated(QTreeWidgetItem*,int)));
-    connect(ui->treeWidget, SIGNAL(customContextMenuRequested(QPoint)), this, SLOT(customContextMenuRequested(QPoint)));
-    connect(ui->treeWidget, SIGNAL(requestRefreshTree()), this, SLOT(delayedRefreshTree()));
+    connect(ui->treeView, SIGNAL(clicked(QModelIndex)), this, SLOT(onItemActivated(QModelIndex)));
+    connect(ui->treeView, SIGNAL(customContextMenuRequested(QPoint)), this, SLOT(customContextMenuRequested(QPoint)));
+
+    scrollToCurrentTab();
 }
 
 TabManagerWidget::~TabManagerWidget()
@@ -99,6 +129,11 @@ TabManagerWidget::~TabManagerWidget()
 void TabManagerWidget::setGroupType(GroupType type)
 {
     m_groupType = type;
+
+    m_model->setGroupType(m_groupType);
+    ui->treeView->setEnableDragTabs(m_groupType == GroupByWindow);
+
+    scrollToCurrentTab();
 }
 
 QString TabManagerWidget::domainFromUrl(const QUrl &url, bool useHostName)
@@ -139,102 +174,34 @@ QString TabManagerWidget::domainFromUrl(const QUrl &url, bool useHostName)
     }
 }
 
-void TabManagerWidget::delayedRefreshTree(WebPage* p)
+void TabManagerWidget::scrollToCurrentTab()
 {
-    if (m_refreshBlocked || m_waitForRefresh) {
+    BrowserWindow* window = getQupZilla();
+    if (!window || !window->weView()) {
         return;
     }
 
-    if (m_isRefreshing && !p) {
-        return;
+    const QModelIndex index = m_filterModel->mapFromSource(m_model->tabIndex(window->weView()->webTab()));
+    if (index.isValid()) {
+        ui->treeView->scrollTo(index, QAbstractItemView::EnsureVisible);
     }
-
-    m_webPage = p;
-    m_waitForRefresh = true;
-    QTimer::singleShot(50, this, SLOT(refreshTree()));
 }
 
-void TabManagerWidget::refreshTree()
+void TabManagerWidget::onItemActivated(const QModelIndex &index)
 {
-    if (m_refreshBlocked) {
+    const QModelIndex sourceIndex = m_filterModel->mapToSource(index);
+    if (!sourceIndex.isValid()) {
         return;
     }
 
-    if (m_isRefreshing && !m_webPage) {
-        return;
-    }
-
-    // store selected items
-    QList<QWidget*> selectedTabs;
-    for (int i = 0; i < ui->treeWidget->topLevelItemCount(); ++i) {
-        QTreeWidgetItem* winItem = ui->treeWidget->topLevelItem(i);
-        if (winItem->checkState(0) == Qt::Unchecked) {
-            continue;
-        }
-
-        for (int j = 0; j < winItem->childCount(); ++j) {
-            TabItem* tabItem = static_cast<TabItem*>(winItem->child(j));
-            if (!tabItem || tabItem->checkState(0) == Qt::Unchecked) {
-                continue;
-            }
-            selectedTabs << tabItem->webTab();
-        }
-    }
-
-    ui->treeWidget->clear();
-    ui->treeWidget->setEnableDragTabs(m_groupType == GroupByWindow);
-
-    QTreeWidgetItem* currentTabItem = nullptr;
+    BrowserWindow* mainWindow = m_model->window(sourceIndex);
+    WebTab* webTab = m_model->tab(sourceIndex);
 
-    if (m_groupType == GroupByHost) {
-        currentTabItem = groupByDomainName(true);
-    }
-    else if (m_groupType == GroupByDomain) {
-        currentTabItem = groupByDomainName();
-    }
-    else { // fallback to GroupByWindow
-        m_groupType = GroupByWindow;
-        currentTabItem = groupByWindow();
-    }
-
-    // restore selected items
-    for (int i = 0; i < ui->treeWidget->topLevelItemCount(); ++i) {
-        QTreeWidgetItem* winItem = ui->treeWidget->topLevelItem(i);
-
-        for (int j = 0; j < winItem->childCount(); ++j) {
-            TabItem* tabItem = static_cast<TabItem*>(winItem->child(j));
-
-            if (tabItem && selectedTabs.contains(tabItem->webTab())) {
-                tabItem->setCheckState(0, Qt::Checked);
-            }
-        }
-    }
-
-    filterChanged(m_filterText, true);
-    ui->treeWidget->expandAll();
-
-    if (currentTabItem)
-        ui->treeWidget->scrollToItem(currentTabItem, QAbstractItemView::EnsureVisible);
-
-    m_isRefreshing = false;
-    m_waitForRefresh = false;
-}
-
-void TabManagerWidget::onItemActivated(QTreeWidgetItem* item, int column)
-{
-    TabItem* tabItem = static_cast<TabItem*>(item);
-    if (!tabItem) {
-        return;
-    }
-
-    BrowserWindow* mainWindow = tabItem->window();
-    QWidget* tabWidget = tabItem->webTab();
-
-    if (column == 1) {
-        if (item->childCount() > 0)
+    if (sourceIndex.column() == 1) {
+        if (m_model->isGroup(sourceIndex))
             QMetaObject::invokeMethod(mainWindow ? mainWindow : mApp->getWindow(), "addTab");
-        else if (tabWidget && mainWindow)
-            mainWindow->tabWidget()->requestCloseTab(mainWindow->tabWidget()->indexOf(tabWidget));
+        else if (webTab && mainWindow)
+            mainWindow->tabWidget()->requestCloseTab(webTab->tabIndex());
         return;
     }
 
@@ -252,37 +219,28 @@ void TabManagerWidget::onItemActivated(QTreeWidgetItem* item, int column)
     mainWindow->raise();
     mainWindow->weView()->setFocus();
 
-    if (tabWidget && tabWidget != mainWindow->tabWidget()->currentWidget()) {
-        mainWindow->tabWidget()->setCurrentIndex(mainWindow->tabWidget()->indexOf(tabWidget));
+    if (webTab && !webTab->isCurrentTab()) {
+        mainWindow->tabWidget()->setCurrentIndex(webTab->tabIndex());
     }
 }
 
 bool TabManagerWidget::isTabSelected()
 {
-    bool selected = false;
-    for (int i = 0; i < ui->treeWidget->topLevelItemCount(); ++i) {
-        QTreeWidgetItem* parentItem = ui->treeWidget->topLevelItem(i);
-        if (parentItem->checkState(0) != Qt::Unchecked) {
-            selected = true;
-            break;
-        }
-    }
-
-    return selected;
+    return m_model->hasCheckedTabs();
 }
 
 void TabManagerWidget::customContextMenuRequested(const QPoint &pos)
 {
     QMenu* menu = nullptr;
 
-    TabItem* item = static_cast<TabItem*>(ui->treeWidget->itemAt(pos));
+    const QModelIndex index = m_filterModel->mapToSource(ui->treeView->indexAt(pos));
+    WebTab* webTab = m_model->tab(index);
 
-    if (item) {
-        BrowserWindow* mainWindow = item->window();
-        QWidget* tabWidget = item->webTab();
+    if (webTab) {
+        BrowserWindow* mainWindow = m_model->window(index);
 
-        if (mainWindow && tabWidget) {
-            int index = mainWindow->tabWidget()->indexOf(tabWidget);
+        if (mainWindow) {
+            int tabIndex = webTab->tabIndex();
 
             // if items are not grouped by Window then actions "Close Other Tabs",
             // "Close Tabs To The Bottom" and "Close Tabs To The Top"
@@ -291,11 +249,10 @@ void TabManagerWidget::customContextMenuRequested(const QPoint &pos)
             if (m_groupType == GroupByWindow) {
                 options |= TabContextMenu::ShowCloseOtherTabsActions;
             }
-            menu = new TabContextMenu(index, mainWindow, options);
+            menu = new TabContextMenu(tabIndex, mainWindow, options);
             menu->addSeparator();
         }
     }
-
     if (!menu)
         menu = new QMenu;
 
@@ -333,67 +290,21 @@ void TabManagerWidget::customContextMenuRequested(const QPoint &pos)
         menu->addAction(tr("&Unload checked tabs"), this, SLOT(processActions()))->setObjectName("unloadSelection");
     }
 
-    menu->exec(ui->treeWidget->viewport()->mapToGlobal(pos));
+    menu->exec(ui->treeView->viewport()->mapToGlobal(pos));
 }
 
-void TabManagerWidget::filterChanged(const QString &filter, bool force)
+void TabManagerWidget::filterChanged(const QString &filter)
 {
-    if (force || filter != m_filterText) {
-        m_filterText = filter.simplified();
-        ui->treeWidget->itemDelegate()->setProperty("filterText", m_filterText);
-        if (m_filterText.isEmpty()) {
-            for (int i = 0; i < ui->treeWidget->topLevelItemCount(); ++i) {
-                QTreeWidgetItem* parentItem = ui->treeWidget->topLevelItem(i);
-                for (int j = 0; j < parentItem->childCount(); ++j) {
-                    QTreeWidgetItem* childItem = parentItem->child(j);
-                    childItem->setHidden(false);
-                }
-                parentItem->setHidden(false);
-                parentItem->setExpanded(true);
-            }
-
-            return;
-        }
-
-        const QRegularExpression filterRegExp(filter.simplified().replace(QChar(' '), QLatin1String(".*"))
-                                              .append(QLatin1String(".*")).prepend(QLatin1String(".*")),
-                                              QRegularExpression::CaseInsensitiveOption);
-
-        for (int i = 0; i < ui->treeWidget->topLevelItemCount(); ++i) {
-            QTreeWidgetItem* parentItem = ui->treeWidget->topLevelItem(i);
-            int visibleChildCount = 0;
-            for (int j = 0; j < parentItem->childCount(); ++j) {
-                TabItem* childItem = static_cast<TabItem*>(parentItem->child(j));
-                if (!childItem) {
-                    continue;
-                }
-
-                if (childItem->text(0).contains(filterRegExp) || childItem->webTab()->url().toString().simplified().contains(filterRegExp)) {
-                    ++visibleChildCount;
-                    childItem->setHidden(false);
-                }
-                else {
-                    childItem->setHidden(true);
-                }
-            }
-
-            if (visibleChildCount == 0) {
-                parentItem->setHidden(true);
-            }
-            else {
-                parentItem->setHidden(false);
-                parentItem->setExpanded(true);
-            }
-        }
-    }
+    ui->treeView->itemDelegate()->setProperty("filterText", filter.simplified());
+    m_filterModel->setFilterText(filter);
 }
 
 void TabManagerWidget::filterBarClosed()
 {
     ui->filterBar->clear();
     ui->filterBar->hide();
-    ui->treeWidget->setFocusProxy(0);
-    ui->treeWidget->setFocus();
+    ui->treeView->setFocusProxy(0);
+    ui->treeView->setFocus();
 }
 
 bool TabManagerWidget::eventFilter(QObject* obj, QEvent* event)
@@ -402,16 +313,16 @@ bool TabManagerWidget::eventFilter(QObject* obj, QEvent* event)
         QKeyEvent *keyEvent = static_cast<QKeyEvent *>(event);
         const QString text = keyEvent->text().simplified();
 
-        if (obj == ui->treeWidget) {
+        if (obj == ui->treeView) {
             // switch to tab/window on enter
             if (keyEvent->key() == Qt::Key_Enter || keyEvent->key() == Qt::Key_Return) {
-                onItemActivated(ui->treeWidget->currentItem(), 0);
+                onItemActivated(ui->treeView->currentIndex());
                 return QObject::eventFilter(obj, event);
             }
 
             if (!text.isEmpty() || ((keyEvent->modifiers() & Qt::ControlModifier) && keyEvent->key() == Qt::Key_F)) {
                 ui->filterBar->show();
-                ui->treeWidget->setFocusProxy(ui->filterBar);
+                ui->treeView->setFocusProxy(ui->filterBar);
                 ui->filterBar->setFocus();
                 if (!text.isEmpty() && text.at(0).isPrint()) {
                     ui->filterBar->setText(ui->filterBar->text() + text);
@@ -428,17 +339,17 @@ bool TabManagerWidget::eventFilter(QObject* obj, QEvent* event)
                     keyEvent->key() == Qt::Key_Enter ||
                     keyEvent->key() == Qt::Key_Return;
 
-            // send scroll or action press key to treeWidget
+            // send scroll or action press key to treeView
             if (isNavigationOrActionKey) {
                 QKeyEvent ev(QKeyEvent::KeyPress, keyEvent->key(), keyEvent->modifiers());
-                QApplication::sendEvent(ui->treeWidget, &ev);
+                QApplication::sendEvent(ui->treeView, &ev);
                 return false;
             }
         }
     }
 
-    if (obj == ui->treeWidget && (event->type() == QEvent::Resize || event->type() == QEvent::Show))
-        ui->treeWidget->setColumnHidden(1, ui->treeWidget->viewport()->width() < 150);
+    if (obj == ui->treeView && (event->type() == QEvent::Resize || event->type() == QEvent::Show))
+        ui->treeView->setColumnHidden(1, ui->treeView->viewport()->width() < 150);
 
     return QObject::eventFilter(obj, event);
 }
@@ -449,37 +360,8 @@ void TabManagerWidget::processActions()
         return;
     }
 
-    m_refreshBlocked = true;
-
-    QHash<BrowserWindow*, WebTab*> selectedTabs;
-
     const QString &command = sender()->objectName();
-
-    for (int i = 0; i < ui->treeWidget->topLevelItemCount(); ++i) {
-        QTreeWidgetItem* winItem = ui->treeWidget->topLevelItem(i);
-        if (winItem->checkState(0) == Qt::Unchecked) {
-            continue;
-        }
-
-        for (int j = 0; j < winItem->childCount(); ++j) {
-            TabItem* tabItem = static_cast<TabItem*>(winItem->child(j));
-            if (!tabItem || tabItem->checkState(0) == Qt::Unchecked) {
-                continue;
-            }
-
-            BrowserWindow* mainWindow = tabItem->window();
-            WebTab* webTab = tabItem->webTab();
-
-            // current supported actions are not applied to pinned tabs
-            if (webTab->isPinned()) {
-                tabItem->setCheckState(0, Qt::Unchecked);
-                continue;
-            }
-
-            selectedTabs.insertMulti(mainWindow, webTab);
-        }
-        winItem->setCheckState(0, Qt::Unchecked);
-    }
+    const QHash<BrowserWindow*, WebTab*> selectedTabs = m_model->takeCheckedTabs();
 
     if (!selectedTabs.isEmpty()) {
         if (command == "closeSelection") {
@@ -495,9 +377,6 @@ void TabManagerWidget::processActions()
             unloadSelectedTabs(selectedTabs);
         }
     }
-
-    m_refreshBlocked = false;
-    delayedRefreshTree();
 }
 
 void TabManagerWidget::changeGroupType()
@@ -508,9 +387,7 @@ void TabManagerWidget::changeGroupType()
         int type = action->data().toInt();
 
         if (m_groupType != GroupType(type)) {
-            m_groupType = GroupType(type);
-
-            delayedRefreshTree();
+            setGroupType(GroupType(type));
 
             emit groupTypeChanged(m_groupType);
         }
@@ -623,115 +500,6 @@ void TabManagerWidget::unloadSelectedTabs(const QHash<BrowserWindow*, WebTab*> &
     }
 }
 
-QTreeWidgetItem* TabManagerWidget::groupByDomainName(bool useHostName)
-{
-    QTreeWidgetItem* currentTabItem = nullptr;
-
-    QList<BrowserWindow*> windows = mApp->windows();
-    int currentWindowIdx = windows.indexOf(getQupZilla());
-    if (currentWindowIdx == -1) {
-        // getQupZilla() instance is closing
-        return nullptr;
-    }
-
-    QMap<QString, QTreeWidgetItem*> tabsGroupedByDomain;
-
-    for (int win = 0; win < windows.count(); ++win) {
-        BrowserWindow* mainWin = windows.at(win);
-
-        QList<WebTab*> tabs = mainWin->tabWidget()->allTabs();
-
-        for (int tab = 0; tab < tabs.count(); ++tab) {
-            WebTab* webTab = tabs.at(tab);
-            if (webTab->webView() && m_webPage == webTab->webView()->page()) {
-                m_webPage = 0;
-                continue;
-            }
-            QString domain = domainFromUrl(webTab->url(), useHostName);
-
-            if (!tabsGroupedByDomain.contains(domain)) {
-                TabItem* groupItem = new TabItem(ui->treeWidget, false, false, 0, false);
-                groupItem->setTitle(domain);
-                groupItem->setIsActiveOrCaption(true);
-
-                tabsGroupedByDomain.insert(domain, groupItem);
-            }
-
-            QTreeWidgetItem* groupItem = tabsGroupedByDomain.value(domain);
-
-            TabItem* tabItem = new TabItem(ui->treeWidget, false, true, groupItem);
-            tabItem->setBrowserWindow(mainWin);
-            tabItem->setWebTab(webTab);
-
-            if (webTab == mainWin->weView()->webTab()) {
-                tabItem->setIsActiveOrCaption(true);
-
-                if (mainWin == getQupZilla())
-                    currentTabItem = tabItem;
-            }
-
-
-            tabItem->updateIcon();
-            tabItem->setTitle(webTab->title());
-        }
-    }
-
-    ui->treeWidget->insertTopLevelItems(0, tabsGroupedByDomain.values());
-
-    return currentTabItem;
-}
-
-QTreeWidgetItem* TabManagerWidget::groupByWindow()
-{
-    QTreeWidgetItem* currentTabItem = nullptr;
-
-    QList<BrowserWindow*> windows = mApp->windows();
-    int currentWindowIdx = windows.indexOf(getQupZilla());
-    if (currentWindowIdx == -1) {
-        return nullptr;
-    }
-    m_isRefreshing = true;
-
-    if (!m_isDefaultWidget) {
-        windows.move(currentWindowIdx, 0);
-        currentWindowIdx = 0;
-    }
-
-    for (int win = 0; win < windows.count(); ++win) {
-        BrowserWindow* mainWin = windows.at(win);
-        TabItem* winItem = new TabItem(ui->treeWidget, true, false);
-        winItem->setBrowserWindow(mainWin);
-        winItem->setText(0, tr("Window %1").arg(QString::number(win + 1)));
-        winItem->setToolTip(0, tr("Double click to switch"));
-        winItem->setIsActiveOrCaption(win == currentWindowIdx);
-
-        QList<WebTab*> tabs = mainWin->tabWidget()->allTabs();
-
-        for (int tab = 0; tab < tabs.count(); ++tab) {
-            WebTab* webTab = tabs.at(tab);
-            if (webTab->webView() && m_webPage == webTab->webView()->page()) {
-                m_webPage = 0;
-                continue;
-            }
-            TabItem* tabItem = new TabItem(ui->treeWidget, true, true, winItem);
-            tabItem->setBrowserWindow(mainWin);
-            tabItem->setWebTab(webTab);
-
-            if (webTab == mainWin->weView()->webTab()) {
-                tabItem->setIsActiveOrCaption(true);
-
-                if (mainWin == getQupZilla())
-                    currentTabItem = tabItem;
-            }
-
-            tabItem->updateIcon();
-            tabItem->setTitle(webTab->title());
-        }
-    }
-
-    return currentTabItem;
-}
-
 BrowserWindow* TabManagerWidget::getQupZilla()
 {
     if (m_isDefaultWidget || !p_QupZilla) {
@@ -742,233 +510,16 @@ BrowserWindow* TabManagerWidget::getQupZilla()
     }
 }
 
-TabItem::TabItem(QTreeWidget* treeWidget, bool supportDrag, bool isTab, QTreeWidgetItem* parent, bool addToTree)
-    : QObject()
-    , QTreeWidgetItem(addToTree ? (parent ? parent : treeWidget->invisibleRootItem()) : 0, 1)
-    , m_treeWidget(treeWidget)
-    , m_window(0)
-    , m_webTab(0)
-    , m_isTab(isTab)
-{
-    Qt::ItemFlags flgs = flags() | (parent ? Qt::ItemIsUserCheckable : Qt::ItemIsUserCheckable | Qt::ItemIsTristate);
-
-    if (supportDrag) {
-        if (isTab) {
-            flgs |= Qt::ItemIsDragEnabled | Qt::ItemNeverHasChildren;
-            flgs &= ~Qt::ItemIsDropEnabled;
-        }
-        else {
-            flgs |= Qt::ItemIsDropEnabled;
-            flgs &= ~Qt::ItemIsDragEnabled;
-        }
-    }
-
-    setFlags(flgs);
-
-    setCheckState(0, Qt::Unchecked);
-}
-
-BrowserWindow* TabItem::window() const
-{
-    return m_window;
-}
-
-void TabItem::setBrowserWindow(BrowserWindow* window)
-{
-    m_window = window;
-}
-
-WebTab* TabItem::webTab() const
-{
-    return m_webTab;
-}
-
-void TabItem::setWebTab(WebTab* webTab)
-{
-    m_webTab = webTab;
-
-    if (m_webTab->isRestored())
-        setIsActiveOrCaption(m_webTab->isCurrentTab());
-    else
-        setIsSavedTab(true);
-
-    connect(m_webTab->webView(), SIGNAL(titleChanged(QString)), this, SLOT(setTitle(QString)));
-    connect(m_webTab->webView(), SIGNAL(iconChanged(QIcon)), this, SLOT(updateIcon()));
-
-    auto pageChanged = [this](WebPage *page) {
-        connect(page, &WebPage::audioMutedChanged, this, &TabItem::updateIcon);
-        connect(page, &WebPage::loadFinished, this, &TabItem::updateIcon);
-        connect(page, &WebPage::loadStarted, this, &TabItem::updateIcon);
-    };
-    pageChanged(m_webTab->webView()->page());
-    connect(m_webTab->webView(), &WebView::pageChanged, this, pageChanged);
-}
-
-void TabItem::updateIcon()
-{
-    if (!m_webTab)
-        return;
-
-    if (!m_webTab->isLoading()) {
-        if (!m_webTab->isPinned()) {
-            if (m_webTab->isMuted()) {
-                setIcon(0, QIcon::fromTheme(QSL("audio-volume-muted"), QIcon(QSL(":icons/other/audiomuted.svg"))));
-            }
-            else if (!m_webTab->isMuted() && m_webTab->webView()->page()->recentlyAudible()) {
-                setIcon(0, QIcon::fromTheme(QSL("audio-volume-high"), QIcon(QSL(":icons/other/audioplaying.svg"))));
-            }
-            else {
-                setIcon(0, m_webTab->icon());
-            }
-        }
-        else {
-            setIcon(0, QIcon(":tabmanager/data/tab-pinned.png"));
-        }
-
-        if (m_webTab->isRestored())
-            setIsActiveOrCaption(m_webTab->isCurrentTab());
-        else
-            setIsSavedTab(true);
-    }
-    else {
-        setIcon(0, QIcon(":tabmanager/data/tab-loading.png"));
-        setIsActiveOrCaption(m_webTab->isCurrentTab());
-    }
-}
-
-void TabItem::setTitle(const QString &title)
-{
-    setText(0, title);
-    setToolTip(0, title);
-}
-
-void TabItem::setIsActiveOrCaption(bool yes)
-{
-    setData(0, ActiveOrCaptionRole, yes ? QVariant(true) : QVariant());
-
-    setIsSavedTab(false);
-}
-
-void TabItem::setIsSavedTab(bool yes)
-{
-    setData(0, SavedRole, yes ? QVariant(true) : QVariant());
-}
-
-bool TabItem::isTab() const
-{
-    return m_isTab;
-}
-
-TabTreeWidget::TabTreeWidget(QWidget *parent)
-    : QTreeWidget(parent)
-{
-    invisibleRootItem()->setFlags(invisibleRootItem()->flags() & ~Qt::ItemIsDropEnabled);
-}
-
-Qt::DropActions TabTreeWidget::supportedDropActions() const
-{
-    return Qt::MoveAction | Qt::CopyAction;
-}
-
-#define MIMETYPE QLatin1String("application/qupzilla.tabs")
-
-QStringList TabTreeWidget::mimeTypes() const
-{
-    QStringList types;
-    types.append(MIMETYPE);
-    return types;
-}
-
-QMimeData *TabTreeWidget::mimeData(const QList<QTreeWidgetItem*> items) const
-{
-    QMimeData* mimeData = new QMimeData();
-    QByteArray encodedData;
-
-    QDataStream stream(&encodedData, QIODevice::WriteOnly);
-
-    if (items.size() > 0) {
-        TabItem* tabItem = static_cast<TabItem*>(items.at(0));
-        if (!tabItem || !tabItem->isTab())
-            return 0;
-
-        stream << (quintptr) tabItem->window() << (quintptr) tabItem->webTab();
-
-        mimeData->setData(MIMETYPE, encodedData);
-
-        return mimeData;
-    }
-
-    return 0;
-}
-
-bool TabTreeWidget::dropMimeData(QTreeWidgetItem *parent, int index, const QMimeData *data, Qt::DropAction action)
+TabTreeView::TabTreeView(QWidget *parent)
+    : QTreeView(parent)
 {
-    if (action == Qt::IgnoreAction) {
-        return true;
-    }
-
-    TabItem* parentItem = static_cast<TabItem*>(parent);
-
-    if (!data->hasFormat(MIMETYPE) || !parentItem) {
-        return false;
-    }
-
-    Q_ASSERT(!parentItem->isTab());
-
-    BrowserWindow* targetWindow = parentItem->window();
-
-    QByteArray encodedData = data->data(MIMETYPE);
-    QDataStream stream(&encodedData, QIODevice::ReadOnly);
-
-    if (!stream.atEnd()) {
-        quintptr webTabPtr;
-        quintptr windowPtr;
-
-        stream >> windowPtr >> webTabPtr;
-
-        WebTab* webTab = (WebTab*) webTabPtr;
-        BrowserWindow* window = (BrowserWindow*) windowPtr;
-
-        if (window == targetWindow) {
-            if (index > 0 && webTab->tabIndex() < index)
-                --index;
-
-            if (webTab->isPinned() && index >= targetWindow->tabWidget()->pinnedTabsCount())
-                index = targetWindow->tabWidget()->pinnedTabsCount() - 1;
-
-            if (!webTab->isPinned() && index < targetWindow->tabWidget()->pinnedTabsCount())
-                index = targetWindow->tabWidget()->pinnedTabsCount();
-
-            if (index != webTab->tabIndex()) {
-                targetWindow->tabWidget()->tabBar()->moveTab(webTab->tabIndex(), index);
-
-                if (!webTab->isCurrentTab())
-                    emit requestRefreshTree();
-            }
-            else {
-                return false;
-            }
-        }
-        else if (!webTab->isPinned()) {
-            QHash<BrowserWindow*, WebTab*> tabsHash;
-            tabsHash.insert(window, webTab);
-
-            detachTabsTo(targetWindow, tabsHash);
-
-            if (index < targetWindow->tabWidget()->pinnedTabsCount())
-                index = targetWindow->tabWidget()->pinnedTabsCount();
-
-            targetWindow->tabWidget()->tabBar()->moveTab(webTab->tabIndex(), index);
-        }
-    }
-
-    return true;
 }
 
-void TabTreeWidget::setEnableDragTabs(bool enable)
+void TabTreeView::setEnableDragTabs(bool enable)
 {
     setDragEnabled(enable);
     setAcceptDrops(enable);
     viewport()->setAcceptDrops(enable);
     setDropIndicatorShown(enable);
+    setDragDropMode(enable ? QAbstractItemView::InternalMove : QAbstractItemView::NoDragDrop);
 }
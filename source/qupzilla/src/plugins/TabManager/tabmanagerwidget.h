@@ -21,37 +21,27 @@
 #include <QWidget>
 #include <QPointer>
 #include <QHash>
-#include <QTreeWidgetItem>
+#include <QTreeView>
 
 namespace Ui
 {
 class TabManagerWidget;
 }
 class QUrl;
-class QTreeWidgetItem;
 class BrowserWindow;
-class WebPage;
 class WebTab;
-class WebView;
 class TLDExtractor;
+class TabManagerModel;
+class TabManagerFilterModel;
 
-class TabTreeWidget : public QTreeWidget
+class TabTreeView : public QTreeView
 {
     Q_OBJECT
 
 public:
-    TabTreeWidget(QWidget* parent = 0);
-
-    Qt::DropActions supportedDropActions() const;
-    QStringList mimeTypes() const;
-    QMimeData* mimeData(const QList<QTreeWidgetItem*> items) const;
-    bool dropMimeData(QTreeWidgetItem *parent, int index, const QMimeData *data, Qt::DropAction action);
+    TabTreeView(QWidget* parent = 0);
 
     void setEnableDragTabs(bool enable);
-
-signals:
-    void requestRefreshTree();
-
 };
 
 class TabManagerWidget : public QWidget
@@ -78,35 +68,28 @@ public:
     static QString domainFromUrl(const QUrl &url, bool useHostName = false);
 
 public slots:
-    void delayedRefreshTree(WebPage* p = 0);
     void changeGroupType();
 
 private:
-    QTreeWidgetItem* groupByDomainName(bool useHostName = false);
-    QTreeWidgetItem* groupByWindow();
     BrowserWindow* getQupZilla();
+    void scrollToCurrentTab();
 
     Ui::TabManagerWidget* ui;
     QPointer<BrowserWindow> p_QupZilla;
-    WebPage* m_webPage;
+    TabManagerModel* m_model;
+    TabManagerFilterModel* m_filterModel;
 
-    bool m_isRefreshing;
-    bool m_refreshBlocked;
-    bool m_waitForRefresh;
     bool m_isDefaultWidget;
     GroupType m_groupType;
 
-    QString m_filterText;
-
     static TLDExtractor* s_tldExtractor;
 
 private slots:
-    void refreshTree();
     void processActions();
-    void onItemActivated(QTreeWidgetItem* item, int column);
+    void onItemActivated(const QModelIndex &index);
     bool isTabSelected();
     void customContextMenuRequested(const QPoint &pos);
-    void filterChanged(const QString &filter, bool force = false);
+    void filterChanged(const QString &filter);
     void filterBarClosed();
 
 protected:
@@ -117,37 +100,4 @@ signals:
     void groupTypeChanged(TabManagerWidget::GroupType);
 };
 
-class TabItem : public QObject, public QTreeWidgetItem
-{
-    Q_OBJECT
-
-public:
-    enum StateRole {
-        ActiveOrCaptionRole = Qt::UserRole + 1,
-        SavedRole = Qt::UserRole + 2
-    };
-
-    TabItem(QTreeWidget* treeWidget, bool supportDrag = true, bool isTab = true, QTreeWidgetItem* parent = 0, bool addToTree = true);
-
-    BrowserWindow* window() const;
-    void setBrowserWindow(BrowserWindow* window);
-
-    WebTab* webTab() const;
-    void setWebTab(WebTab* webTab);
-
-    bool isTab() const;
-
-public slots:
-    void updateIcon();
-    void setTitle(const QString& title);
-    void setIsActiveOrCaption(bool yes);
-    void setIsSavedTab(bool yes);
-
-private:
-    QTreeWidget* m_treeWidget;
-    BrowserWindow* m_window;
-    WebTab* m_webTab;
-    bool m_isTab;
-};
-
 #endif // TABMANAGERWIDGET_H
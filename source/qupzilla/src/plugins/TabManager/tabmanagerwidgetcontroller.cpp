@@ -157,9 +157,6 @@ TabManagerWidget* TabManagerWidgetController::createTabManagerWidget(BrowserWind
     }
 
     connect(tabManagerWidget, SIGNAL(groupTypeChanged(TabManagerWidget::GroupType)), this, SLOT(setGroupType(TabManagerWidget::GroupType)));
-    connect(this, SIGNAL(requestRefreshTree(WebPage*)), tabManagerWidget, SLOT(delayedRefreshTree(WebPage*)));
-
-    emit requestRefreshTree();
 
     return tabManagerWidget;
 }
@@ -193,8 +190,6 @@ void TabManagerWidgetController::removeStatusBarIcon(BrowserWindow* window)
 void TabManagerWidgetController::mainWindowDeleted(BrowserWindow* window)
 {
     removeStatusBarIcon(window);
-
-    emit requestRefreshTree();
 }
 
 void TabManagerWidgetController::raiseTabManager()
@@ -231,8 +226,3 @@ void TabManagerWidgetController::showSideBySide()
     defaultTabManager()->activateWindow();
     defaultTabManager()->raise();
 }
-
-void TabManagerWidgetController::emitRefreshTree()
-{
-    emit requestRefreshTree();
-}
@@ -22,7 +22,6 @@
 #include "sidebarinterface.h"
 #include "tabmanagerwidget.h"
 
-class WebPage;
 class AbstractButtonInterface;
 
 class TabManagerWidgetController : public SideBarInterface
@@ -51,7 +50,6 @@ public slots:
     void mainWindowDeleted(BrowserWindow* window);
     void raiseTabManager();
     void showSideBySide();
-    void emitRefreshTree();
 
 private:
     TabManagerWidget* m_defaultTabManager;
@@ -59,9 +57,6 @@ private:
 
     QHash<BrowserWindow*, AbstractButtonInterface*> m_statusBarIcons;
     QHash<BrowserWindow*, QAction*> m_actions;
-
-signals:
-    void requestRefreshTree(WebPage* p = 0);
 };
 
 #endif // TABMANAGERWIDGETCONTROLLER_H
@@ -40,9 +40,6 @@ outOfDirPlugins = $$(QUPZILLA_PLUGINS_SRCDIR)
 !contains(DEFINES, GNOME_INTEGRATION): disablePlugin(GnomeKeyringPasswords)
 !system(pkg-config --exists gnome-keyring-1): disablePlugin(GnomeKeyringPasswords)
 
-# QtWebEngine disable
-disablePlugin(AccessKeysNavigation)
-
 # webOS optimizations - disable heavy/unused plugins
 disablePlugin(MouseGestures)
 disablePlugin(FlashCookieManager)
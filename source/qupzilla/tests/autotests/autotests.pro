@@ -1,6 +1,6 @@
 include($$PWD/../../src/defines.pri)
 
-QT += webenginewidgets network widgets printsupport sql script dbus testlib
+QT += webenginewidgets network widgets printsupport sql script qml dbus testlib
 
 TARGET = autotests
 
@@ -42,6 +42,7 @@ INCLUDEPATH += $$PWD/../../src/lib/3rdparty \
                $$PWD/../../src/lib/plugins \
                $$PWD/../../src/lib/popupwindow \
                $$PWD/../../src/lib/preferences \
+               $$PWD/../../src/lib/readingmode \
                $$PWD/../../src/lib/session \
                $$PWD/../../src/lib/sidebar \
                $$PWD/../../src/lib/tabwidget \
@@ -59,6 +60,13 @@ HEADERS += \
     webviewtest.h \
     tabmodeltest.h \
     webtabtest.h \
+    closeditemsstoretest.h \
+    startupschedulertest.h \
+    networkproxyfactorytest.h \
+    readingmodestoretest.h \
+    themecompilertest.h \
+    opensearchenginetest.h \
+    databasemaintenancetest.h \
 
 SOURCES += \
     qztoolstest.cpp \
@@ -71,6 +79,13 @@ SOURCES += \
     webviewtest.cpp \
     tabmodeltest.cpp \
     webtabtest.cpp \
+    closeditemsstoretest.cpp \
+    startupschedulertest.cpp \
+    networkproxyfactorytest.cpp \
+    readingmodestoretest.cpp \
+    themecompilertest.cpp \
+    opensearchenginetest.cpp \
+    databasemaintenancetest.cpp \
 
 RESOURCES += autotests.qrc
 
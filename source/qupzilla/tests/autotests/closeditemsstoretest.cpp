@@ -0,0 +1,103 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "closeditemsstoretest.h"
+#include "closeditemsstore.h"
+
+#include <QDir>
+#include <QtTest/QtTest>
+
+void ClosedItemsStoreTest::initTestCase()
+{
+    m_tmpPath = QDir::tempPath() + QL1S("/qupzilla-test/closeditemsstoretest");
+}
+
+void ClosedItemsStoreTest::cleanupTestCase()
+{
+    QDir(m_tmpPath).removeRecursively();
+
+    QVERIFY(!QDir(m_tmpPath).exists());
+}
+
+void ClosedItemsStoreTest::storeLoadTest()
+{
+    ClosedItemsStore store(m_tmpPath + QL1S("/storeload"), 10);
+
+    const QByteArray data(10000, 'a');
+    const QString key = store.store(data);
+
+    QVERIFY(!key.isEmpty());
+    QVERIFY(store.contains(key));
+    QCOMPARE(store.load(key), data);
+
+    // Data is compressed on disk
+    QVERIFY(QFileInfo(store.path() + QL1C('/') + key).size() < data.size());
+
+    QCOMPARE(store.load(QSL("nonexistent")), QByteArray());
+    QCOMPARE(store.load(QString()), QByteArray());
+
+    store.clear();
+    QVERIFY(!store.contains(key));
+}
+
+void ClosedItemsStoreTest::removeTest()
+{
+    ClosedItemsStore store(m_tmpPath + QL1S("/remove"), 10);
+
+    const QString key1 = store.store("data1");
+    const QString key2 = store.store("data2");
+
+    store.remove(key1);
+
+    QVERIFY(!store.contains(key1));
+    QVERIFY(store.contains(key2));
+    QCOMPARE(store.load(key2), QByteArray("data2"));
+
+    store.clear();
+}
+
+void ClosedItemsStoreTest::capacityTest()
+{
+    ClosedItemsStore store(m_tmpPath + QL1S("/capacity"), 3);
+
+    QStringList keys;
+    for (int i = 0; i < 5; ++i) {
+        keys.append(store.store(QByteArray::number(i)));
+    }
+
+    QCOMPARE(QDir(store.path()).entryList(QDir::Files).count(), 3);
+    QVERIFY(store.contains(keys.last()));
+
+    store.clear();
+}
+
+void ClosedItemsStoreTest::pruneTest()
+{
+    ClosedItemsStore store(m_tmpPath + QL1S("/prune"), 10);
+
+    const QString key1 = store.store("data1");
+    const QString key2 = store.store("data2");
+    const QString key3 = store.store("data3");
+
+    store.prune(QStringList() << key2);
+
+    QVERIFY(!store.contains(key1));
+    QVERIFY(store.contains(key2));
+    QVERIFY(!store.contains(key3));
+
+    store.clear();
+}
@@ -0,0 +1,223 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "databasemaintenancetest.h"
+#include "databasemaintenance.h"
+#include "sqldatabase.h"
+
+#include <QtTest/QtTest>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+
+static const QString s_table = QSL("maintenance_test");
+
+// Query is destroyed before returning, open statements would make VACUUM fail
+static qint64 queryNumber(const QString &sql)
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.exec(sql);
+    return query.next() ? query.value(0).toLongLong() : -1;
+}
+
+static qint64 rowCount()
+{
+    return queryNumber(QSL("SELECT COUNT(*) FROM %1").arg(s_table));
+}
+
+// Inserts count rows with value set to row number modulo 3
+static void fillRows(int count)
+{
+    QSqlDatabase db = SqlDatabase::instance()->database();
+    db.transaction();
+
+    QSqlQuery query(db);
+    query.prepare(QSL("INSERT INTO %1 (value) VALUES (?)").arg(s_table));
+    for (int i = 0; i < count; ++i) {
+        query.addBindValue(i % 3);
+        query.exec();
+    }
+
+    db.commit();
+}
+
+static QHash<int, QList<QVariant> > finishedJobs(const QSignalSpy &spy)
+{
+    QHash<int, QList<QVariant> > jobs;
+    for (int i = 0; i < spy.count(); ++i) {
+        jobs.insert(spy.at(i).at(0).toInt(), spy.at(i));
+    }
+    return jobs;
+}
+
+void DatabaseMaintenanceTest::initTestCase()
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.exec(QSL("CREATE TABLE IF NOT EXISTS %1 (id INTEGER PRIMARY KEY, value INTEGER, data BLOB)").arg(s_table));
+}
+
+void DatabaseMaintenanceTest::cleanupTestCase()
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.exec(QSL("DROP TABLE %1").arg(s_table));
+}
+
+void DatabaseMaintenanceTest::init()
+{
+    QSqlQuery query(SqlDatabase::instance()->database());
+    query.exec(QSL("DELETE FROM %1").arg(s_table));
+
+    m_maintenance = new DatabaseMaintenance;
+}
+
+void DatabaseMaintenanceTest::cleanup()
+{
+    delete m_maintenance;
+    m_maintenance = 0;
+}
+
+void DatabaseMaintenanceTest::deleteRowsTest()
+{
+    fillRows(1500);
+
+    QSignalSpy progressSpy(m_maintenance, SIGNAL(jobProgress(int,int,int)));
+    QSignalSpy finishedSpy(m_maintenance, SIGNAL(jobFinished(int,int,bool)));
+
+    const int id = m_maintenance->deleteRows(s_table, QSL("value < ?"), QVariantList() << 2,
+                                             DatabaseMaintenance::Immediate);
+
+    QVERIFY(finishedSpy.wait());
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(finishedSpy.at(0).at(0).toInt(), id);
+    QCOMPARE(finishedSpy.at(0).at(1).toInt(), 1000);
+    QCOMPARE(finishedSpy.at(0).at(2).toBool(), false);
+
+    QCOMPARE(rowCount(), qint64(500));
+    QCOMPARE(queryNumber(QSL("SELECT COUNT(*) FROM %1 WHERE value < 2").arg(s_table)), qint64(0));
+
+    // Total first, then one signal per deleted chunk of 500 rows
+    QCOMPARE(progressSpy.count(), 3);
+    QCOMPARE(progressSpy.at(0), QList<QVariant>() << id << 0 << 1000);
+    QCOMPARE(progressSpy.at(1), QList<QVariant>() << id << 500 << 1000);
+    QCOMPARE(progressSpy.at(2), QList<QVariant>() << id << 1000 << 1000);
+}
+
+void DatabaseMaintenanceTest::cancelTest()
+{
+    fillRows(20000);
+
+    QTemporaryDir tempDir;
+    const QString path = tempDir.path() + QL1S("/cancel");
+    QVERIFY(QDir().mkpath(path));
+
+    QSignalSpy finishedSpy(m_maintenance, SIGNAL(jobFinished(int,int,bool)));
+
+    const int runningId = m_maintenance->deleteRows(s_table, QString(), QVariantList(), DatabaseMaintenance::Immediate);
+    const int queuedId = m_maintenance->removeDirectories(QStringList() << path);
+
+    // Queued job is removed right away
+    m_maintenance->cancel(queuedId);
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(finishedSpy.at(0), QList<QVariant>() << queuedId << 0 << true);
+
+    // Running job stops after current chunk
+    m_maintenance->cancel(runningId);
+    QVERIFY(finishedSpy.wait());
+    QCOMPARE(finishedSpy.count(), 2);
+    QCOMPARE(finishedSpy.at(1).at(0).toInt(), runningId);
+    QCOMPARE(finishedSpy.at(1).at(2).toBool(), true);
+
+    QVERIFY(finishedSpy.at(1).at(1).toInt() < 20000);
+    QVERIFY(rowCount() > 0);
+    QVERIFY(QDir(path).exists());
+
+    // Cancelled delete does not queue optimize
+    QTRY_VERIFY(!m_maintenance->isBusy());
+}
+
+void DatabaseMaintenanceTest::shutdownTest()
+{
+    fillRows(20000);
+
+    QTemporaryDir tempDir;
+    const QString path = tempDir.path() + QL1S("/shutdown");
+    QVERIFY(QDir().mkpath(path));
+
+    QSignalSpy finishedSpy(m_maintenance, SIGNAL(jobFinished(int,int,bool)));
+
+    const int runningId = m_maintenance->deleteRows(s_table, QSL("value >= ?"), QVariantList() << 0,
+                                                    DatabaseMaintenance::Immediate);
+    const int immediateId = m_maintenance->removeDirectories(QStringList() << path, DatabaseMaintenance::Immediate);
+    const int idleId = m_maintenance->optimize(DatabaseMaintenance::Idle);
+
+    m_maintenance->shutdown();
+
+    // Everything is finished synchronously
+    QCOMPARE(finishedSpy.count(), 3);
+    QVERIFY(!m_maintenance->isBusy());
+
+    QHash<int, QList<QVariant> > jobs = finishedJobs(finishedSpy);
+    QCOMPARE(jobs.value(runningId), QList<QVariant>() << runningId << 20000 << false);
+    QCOMPARE(jobs.value(immediateId), QList<QVariant>() << immediateId << 1 << false);
+    QCOMPARE(jobs.value(idleId), QList<QVariant>() << idleId << 0 << true);
+
+    QCOMPARE(rowCount(), qint64(0));
+    QVERIFY(!QDir(path).exists());
+
+    // Running Idle job is cancelled
+    fillRows(20000);
+    finishedSpy.clear();
+
+    const int runningIdleId = m_maintenance->deleteRows(s_table);
+    QVERIFY(QMetaObject::invokeMethod(m_maintenance, "idleTimeout"));
+    QVERIFY(m_maintenance->isBusy());
+
+    m_maintenance->shutdown();
+
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(finishedSpy.at(0).at(0).toInt(), runningIdleId);
+    QCOMPARE(finishedSpy.at(0).at(2).toBool(), true);
+    QVERIFY(!m_maintenance->isBusy());
+    QVERIFY(rowCount() > 0);
+}
+
+void DatabaseMaintenanceTest::optimizeTest()
+{
+    QSignalSpy finishedSpy(m_maintenance, SIGNAL(jobFinished(int,int,bool)));
+
+    // Nothing to reclaim
+    queryNumber(QSL("VACUUM"));
+    QCOMPARE(queryNumber(QSL("PRAGMA freelist_count")), qint64(0));
+
+    int id = m_maintenance->optimize(DatabaseMaintenance::Immediate);
+    QVERIFY(finishedSpy.wait());
+    QCOMPARE(finishedSpy.at(0), QList<QVariant>() << id << 0 << false);
+
+    // Deleting large rows leaves enough free pages
+    fillRows(5000);
+    queryNumber(QSL("UPDATE %1 SET data = randomblob(1000)").arg(s_table));
+    queryNumber(QSL("DELETE FROM %1").arg(s_table));
+
+    const qint64 freePages = queryNumber(QSL("PRAGMA freelist_count"));
+    QVERIFY(freePages >= 64);
+    QVERIFY(freePages * 100 >= queryNumber(QSL("PRAGMA page_count")) * 20);
+
+    finishedSpy.clear();
+    id = m_maintenance->optimize(DatabaseMaintenance::Immediate);
+    QVERIFY(finishedSpy.wait());
+    QCOMPARE(finishedSpy.at(0), QList<QVariant>() << id << 1 << false);
+    QCOMPARE(queryNumber(QSL("PRAGMA freelist_count")), qint64(0));
+}
@@ -26,6 +26,13 @@
 #include "webviewtest.h"
 #include "tabmodeltest.h"
 #include "webtabtest.h"
+#include "closeditemsstoretest.h"
+#include "startupschedulertest.h"
+#include "networkproxyfactorytest.h"
+#include "readingmodestoretest.h"
+#include "themecompilertest.h"
+#include "opensearchenginetest.h"
+#include "databasemaintenancetest.h"
 
 #include <QtTest/QtTest>
 
@@ -52,6 +59,13 @@ int main(int argc, char *argv[])
     RUN_TEST(WebViewTest)
     RUN_TEST(TabModelTest)
     RUN_TEST(WebTabTest)
+    RUN_TEST(ClosedItemsStoreTest)
+    RUN_TEST(StartupSchedulerTest)
+    RUN_TEST(NetworkProxyFactoryTest)
+    RUN_TEST(ReadingModeStoreTest)
+    RUN_TEST(ThemeCompilerTest)
+    RUN_TEST(OpenSearchEngineTest)
+    RUN_TEST(DatabaseMaintenanceTest)
 
     return 0;
 }
@@ -0,0 +1,132 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "networkproxyfactorytest.h"
+#include "networkproxyfactory.h"
+#include "pacrunner.h"
+
+#include <QtTest/QtTest>
+#include <QThread>
+#include <QElapsedTimer>
+
+void NetworkProxyFactoryTest::proxyExceptionsTest_data()
+{
+    QTest::addColumn<QString>("host");
+    QTest::addColumn<bool>("result");
+
+    QTest::newRow("exact") << QString("localhost") << true;
+    QTest::newRow("exact ip") << QString("127.0.0.1") << true;
+    QTest::newRow("ip prefix") << QString("127.0.0.10") << false;
+    QTest::newRow("case") << QString("LocalHost") << true;
+    QTest::newRow("subdomain") << QString("www.example.com") << true;
+    QTest::newRow("domain") << QString("example.com") << true;
+    QTest::newRow("not subdomain") << QString("notexample.com") << false;
+    QTest::newRow("dot prefix") << QString("intranet.lan") << true;
+    QTest::newRow("dot prefix domain") << QString("lan") << true;
+    QTest::newRow("wildcard") << QString("host.corp.org") << true;
+    QTest::newRow("wildcard mismatch") << QString("host.corp.net") << false;
+    QTest::newRow("single char wildcard") << QString("srv1.local") << true;
+    QTest::newRow("single char wildcard mismatch") << QString("srv12.local") << false;
+    QTest::newRow("unrelated") << QString("kde.org") << false;
+}
+
+void NetworkProxyFactoryTest::proxyExceptionsTest()
+{
+    QFETCH(QString, host);
+    QFETCH(bool, result);
+
+    ProxyExceptions exceptions;
+    exceptions.setPatterns(QStringList() << "localhost" << " 127.0.0.1" << "example.com" << ".lan"
+                           << "*.corp.org" << "srv?.local");
+
+    QCOMPARE(exceptions.match(host), result);
+}
+
+void NetworkProxyFactoryTest::pacScriptTest()
+{
+    PacRunner runner;
+    runner.setScript(QSL("function FindProxyForURL(url, host) {"
+                         "    if (isPlainHostName(host) || dnsDomainIs(host, '.intranet.org'))"
+                         "        return 'DIRECT';"
+                         "    if (shExpMatch(url, 'https://*'))"
+                         "        return 'PROXY secure.proxy:3128; DIRECT';"
+                         "    return 'PROXY proxy.example.com:8080';"
+                         "}"));
+
+    QCOMPARE(runner.findProxyForUrl(QUrl("http://printer/")), QString("DIRECT"));
+    QCOMPARE(runner.findProxyForUrl(QUrl("http://www.intranet.org/")), QString("DIRECT"));
+    QCOMPARE(runner.findProxyForUrl(QUrl("https://kde.org/")), QString("PROXY secure.proxy:3128; DIRECT"));
+    QCOMPARE(runner.findProxyForUrl(QUrl("http://kde.org/")), QString("PROXY proxy.example.com:8080"));
+
+    // Broken scripts must not crash and fall back to empty result
+    runner.setScript(QSL("function FindProxyForURL(url, host) { return undefinedFunction(); }"));
+    QCOMPARE(runner.findProxyForUrl(QUrl("http://kde.org/")), QString());
+
+    runner.setScript(QSL("this is not javascript"));
+    QCOMPARE(runner.findProxyForUrl(QUrl("http://kde.org/")), QString());
+}
+
+void NetworkProxyFactoryTest::pacTimeoutTest()
+{
+    QThread thread;
+    PacRunner* runner = new PacRunner;
+    runner->moveToThread(&thread);
+    connect(&thread, &QThread::finished, runner, &QObject::deleteLater);
+    thread.start();
+
+    QMetaObject::invokeMethod(runner, "setScript", Qt::QueuedConnection,
+                              Q_ARG(QString, QSL("function FindProxyForURL(url, host) {"
+                                                 "    if (host == 'slow.org') {"
+                                                 "        var end = Date.now() + 1000;"
+                                                 "        while (Date.now() < end) {}"
+                                                 "    }"
+                                                 "    return 'DIRECT';"
+                                                 "}")));
+
+    QString result;
+    QVERIFY(runner->queryProxy(QUrl("http://kde.org/"), 1000, &result));
+    QCOMPARE(result, QString("DIRECT"));
+
+    // Slow script times out, and further queries don't wait for it
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY(!runner->queryProxy(QUrl("http://slow.org/"), 100, &result));
+    QTest::qWait(200);
+    QVERIFY(!runner->queryProxy(QUrl("http://kde.org/"), 100, &result));
+    QVERIFY(timer.elapsed() < 900);
+
+    // Runner answers again once the script returns
+    QTRY_VERIFY(runner->queryProxy(QUrl("http://kde.org/"), 100, &result));
+    QCOMPARE(result, QString("DIRECT"));
+
+    thread.quit();
+    QVERIFY(thread.wait());
+}
+
+void NetworkProxyFactoryTest::parseProxiesTest()
+{
+    const QList<QNetworkProxy> proxies = PacRunner::parseProxies(QSL("PROXY proxy.example.com:3128; SOCKS 10.0.0.1:1080;DIRECT; BOGUS x"));
+
+    QCOMPARE(proxies.size(), 3);
+    QCOMPARE(proxies.at(0).type(), QNetworkProxy::HttpProxy);
+    QCOMPARE(proxies.at(0).hostName(), QString("proxy.example.com"));
+    QCOMPARE(proxies.at(0).port(), quint16(3128));
+    QCOMPARE(proxies.at(1).type(), QNetworkProxy::Socks5Proxy);
+    QCOMPARE(proxies.at(1).hostName(), QString("10.0.0.1"));
+    QCOMPARE(proxies.at(1).port(), quint16(1080));
+    QCOMPARE(proxies.at(2).type(), QNetworkProxy::NoProxy);
+}
@@ -0,0 +1,220 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "opensearchenginetest.h"
+#include "opensearchengine.h"
+
+#include <QtTest/QtTest>
+#include <QTimer>
+#include <QUrlQuery>
+#include <QNetworkReply>
+#include <QNetworkAccessManager>
+
+// Answers suggestion requests with the search term followed by a number
+class SuggestionsReply : public QNetworkReply
+{
+public:
+    explicit SuggestionsReply(const QNetworkRequest &request, bool stalled, QObject* parent)
+        : QNetworkReply(parent)
+        , m_offset(0)
+    {
+        setRequest(request);
+        setUrl(request.url());
+        setOperation(QNetworkAccessManager::GetOperation);
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+
+        const QString term = QUrlQuery(request.url()).queryItemValue(QSL("q"));
+        m_data = QSL("[\"%1\", [\"%1 1\", \"%1 2\"]]").arg(term).toUtf8();
+
+        if (stalled) {
+            return;
+        }
+
+        QTimer::singleShot(0, this, [this]() {
+            setFinished(true);
+            emit readyRead();
+            emit finished();
+        });
+    }
+
+    void abort() override
+    {
+        if (isFinished()) {
+            return;
+        }
+
+        m_data.clear();
+        setError(OperationCanceledError, QSL("Operation canceled"));
+        setFinished(true);
+        emit finished();
+    }
+
+    qint64 bytesAvailable() const override
+    {
+        return m_data.size() - m_offset + QNetworkReply::bytesAvailable();
+    }
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override
+    {
+        const qint64 size = qMin(maxSize, qint64(m_data.size() - m_offset));
+        memcpy(data, m_data.constData() + m_offset, size);
+        m_offset += size;
+        return size;
+    }
+
+private:
+    QByteArray m_data;
+    qint64 m_offset;
+};
+
+class SuggestionsAccessManager : public QNetworkAccessManager
+{
+public:
+    QStringList requestedTerms;
+    bool stallReplies = false;
+
+protected:
+    QNetworkReply* createRequest(Operation op, const QNetworkRequest &request, QIODevice* outgoingData) override
+    {
+        Q_UNUSED(op)
+        Q_UNUSED(outgoingData)
+
+        requestedTerms.append(QUrlQuery(request.url()).queryItemValue(QSL("q")));
+        return new SuggestionsReply(request, stallReplies, this);
+    }
+};
+
+static void setupEngine(OpenSearchEngine* engine, SuggestionsAccessManager* manager)
+{
+    engine->setSuggestionsUrlTemplate(QSL("https://search.example.org/suggest?q={searchTerms}"));
+    engine->setNetworkAccessManager(manager);
+}
+
+// Skips debouncing and waits for the response
+static bool fetchSuggestions(OpenSearchEngine* engine, const QString &term)
+{
+    QSignalSpy spy(engine, SIGNAL(suggestions(QStringList)));
+    engine->requestSuggestions(term);
+    QMetaObject::invokeMethod(engine, "sendSuggestionsRequest");
+    return spy.wait();
+}
+
+void OpenSearchEngineTest::init()
+{
+    OpenSearchEngine::clearSuggestionsCache();
+}
+
+void OpenSearchEngineTest::suggestionsCacheTest()
+{
+    SuggestionsAccessManager manager;
+    OpenSearchEngine engine;
+    setupEngine(&engine, &manager);
+
+    QVERIFY(fetchSuggestions(&engine, QSL("qupzilla")));
+    QCOMPARE(manager.requestedTerms, QStringList() << QSL("qupzilla"));
+    QCOMPARE(OpenSearchEngine::suggestionsCacheMisses(), quint64(1));
+    QCOMPARE(OpenSearchEngine::suggestionsCacheHits(), quint64(0));
+
+    // Normalized term is answered from the cache without a request
+    QSignalSpy spy(&engine, SIGNAL(suggestions(QStringList)));
+    engine.requestSuggestions(QSL(" QupZilla "));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toStringList(), QStringList() << QSL("qupzilla 1") << QSL("qupzilla 2"));
+    QCOMPARE(OpenSearchEngine::suggestionsCacheHits(), quint64(1));
+
+    // Cache is shared between engines with the same suggestions url
+    OpenSearchEngine engine2;
+    setupEngine(&engine2, &manager);
+    QSignalSpy spy2(&engine2, SIGNAL(suggestions(QStringList)));
+    engine2.requestSuggestions(QSL("qupzilla"));
+    QCOMPARE(spy2.count(), 1);
+    QCOMPARE(OpenSearchEngine::suggestionsCacheHits(), quint64(2));
+
+    // Pending debounce timer must not send a request for cached term
+    QTest::qWait(300);
+    QCOMPARE(manager.requestedTerms.count(), 1);
+
+    OpenSearchEngine::clearSuggestionsCache();
+    QCOMPARE(OpenSearchEngine::suggestionsCacheHits(), quint64(0));
+    QVERIFY(fetchSuggestions(&engine, QSL("qupzilla")));
+    QCOMPARE(manager.requestedTerms.count(), 2);
+}
+
+void OpenSearchEngineTest::suggestionsCacheEvictionTest()
+{
+    SuggestionsAccessManager manager;
+    OpenSearchEngine engine;
+    setupEngine(&engine, &manager);
+
+    QVERIFY(fetchSuggestions(&engine, QSL("term 0")));
+
+    // Least recently used terms expire once the cache is full
+    for (int i = 1; i <= 64; ++i) {
+        QVERIFY(fetchSuggestions(&engine, QSL("term %1").arg(i)));
+    }
+    QCOMPARE(manager.requestedTerms.count(), 65);
+
+    QVERIFY(fetchSuggestions(&engine, QSL("term 0")));
+    QCOMPARE(manager.requestedTerms.count(), 66);
+
+    QSignalSpy spy(&engine, SIGNAL(suggestions(QStringList)));
+    engine.requestSuggestions(QSL("term 64"));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(manager.requestedTerms.count(), 66);
+}
+
+void OpenSearchEngineTest::pendingReplyTest()
+{
+    SuggestionsAccessManager manager;
+    OpenSearchEngine engine;
+    setupEngine(&engine, &manager);
+
+    QVERIFY(fetchSuggestions(&engine, QSL("cached")));
+
+    // Cached term is requested while another reply is in flight
+    engine.requestSuggestions(QSL("pending"));
+    QMetaObject::invokeMethod(&engine, "sendSuggestionsRequest");
+    QSignalSpy spy(&engine, SIGNAL(suggestions(QStringList)));
+    engine.requestSuggestions(QSL("cached"));
+    QCOMPARE(spy.count(), 1);
+
+    // Finished reply must not request the cached term again
+    QTest::qWait(300);
+    QCOMPARE(manager.requestedTerms, QStringList() << QSL("cached") << QSL("pending"));
+    QCOMPARE(spy.count(), 1);
+}
+
+void OpenSearchEngineTest::stalledReplyTest()
+{
+    SuggestionsAccessManager manager;
+    OpenSearchEngine engine;
+    setupEngine(&engine, &manager);
+
+    manager.stallReplies = true;
+    engine.requestSuggestions(QSL("stalled"));
+    QMetaObject::invokeMethod(&engine, "sendSuggestionsRequest");
+    manager.stallReplies = false;
+
+    // Stalled reply is aborted and the pending term is requested
+    QSignalSpy spy(&engine, SIGNAL(suggestions(QStringList)));
+    engine.requestSuggestions(QSL("next"));
+    QVERIFY(spy.wait(5000));
+    QCOMPARE(manager.requestedTerms, QStringList() << QSL("stalled") << QSL("next"));
+    QCOMPARE(spy.at(0).at(0).toStringList(), QStringList() << QSL("next 1") << QSL("next 2"));
+    QCOMPARE(OpenSearchEngine::suggestionsCacheMisses(), quint64(2));
+}
@@ -0,0 +1,121 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "readingmodestoretest.h"
+#include "readingmodestore.h"
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+
+static ReadingModeArticle createArticle(const QString &url, int contentSize = 100)
+{
+    ReadingModeArticle article;
+    article.originalUrl = QUrl(url);
+    article.title = QSL("Title of ") + url;
+    article.byline = QSL("Author");
+    article.content = QSL("<p>%1</p>").arg(QString(contentSize, QL1C('x')));
+    return article;
+}
+
+static void compareArticles(const ReadingModeArticle &a, const ReadingModeArticle &b)
+{
+    QCOMPARE(a.originalUrl, b.originalUrl);
+    QCOMPARE(a.title, b.title);
+    QCOMPARE(a.byline, b.byline);
+    QCOMPARE(a.content, b.content);
+}
+
+void ReadingModeStoreTest::serializeTest()
+{
+    const ReadingModeArticle article = createArticle(QSL("https://kde.org/article"), 10000);
+    const QByteArray data = ReadingModeStore::serialize(article);
+
+    QVERIFY(data.size() < article.content.size());
+    compareArticles(ReadingModeStore::deserialize(data), article);
+
+    QVERIFY(!ReadingModeStore::deserialize(QByteArray()).isValid());
+    QVERIFY(!ReadingModeStore::deserialize(QByteArray("garbage")).isValid());
+}
+
+void ReadingModeStoreTest::persistentStoreTest()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const ReadingModeArticle article1 = createArticle(QSL("https://kde.org/1"));
+    const ReadingModeArticle article2 = createArticle(QSL("https://kde.org/2"));
+
+    {
+        ReadingModeStore store(dir.path());
+        store.insert(article1);
+        store.insert(article2);
+        store.insert(ReadingModeArticle());
+        QVERIFY(store.contains(article1.originalUrl));
+        QVERIFY(!store.contains(QUrl(QSL("https://kde.org/3"))));
+        compareArticles(store.article(article1.originalUrl), article1);
+    }
+
+    // Articles are still available after restart
+    ReadingModeStore store(dir.path());
+    QVERIFY(store.diskSize() > 0);
+    QVERIFY(store.contains(article2.originalUrl));
+    compareArticles(store.article(article1.originalUrl), article1);
+    compareArticles(store.article(article2.originalUrl), article2);
+
+    store.clear();
+    QCOMPARE(store.diskSize(), qint64(0));
+    QVERIFY(!store.contains(article1.originalUrl));
+    QVERIFY(QDir(dir.path()).entryList(QDir::Files).isEmpty());
+}
+
+void ReadingModeStoreTest::memoryOnlyStoreTest()
+{
+    const ReadingModeArticle article = createArticle(QSL("https://kde.org/private"));
+
+    ReadingModeStore store(QString(), 1024 * 1024, 1024);
+    store.insert(article);
+    compareArticles(store.article(article.originalUrl), article);
+    QCOMPARE(store.diskSize(), qint64(0));
+
+    // Larger than memory limit and nothing on disk
+    const ReadingModeArticle big = createArticle(QSL("https://kde.org/big"), 2048);
+    store.insert(big);
+    QVERIFY(!store.article(big.originalUrl).isValid());
+}
+
+void ReadingModeStoreTest::evictionTest()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QByteArray data = ReadingModeStore::serialize(createArticle(QSL("https://kde.org/0")));
+
+    // Room for two articles only, memory cache disabled
+    ReadingModeStore store(dir.path(), data.size() * 2 + data.size() / 2, 0);
+
+    for (int i = 0; i < 3; ++i) {
+        store.insert(createArticle(QSL("https://kde.org/%1").arg(i)));
+        QTest::qWait(5);
+    }
+    store.waitForWrites();
+
+    QVERIFY(store.diskSize() <= data.size() * 2 + data.size() / 2);
+    QVERIFY(!store.contains(QUrl(QSL("https://kde.org/0"))));
+    QVERIFY(store.article(QUrl(QSL("https://kde.org/1"))).isValid());
+    QVERIFY(store.article(QUrl(QSL("https://kde.org/2"))).isValid());
+    QCOMPARE(QDir(dir.path()).entryList(QDir::Files).size(), 2);
+}
@@ -0,0 +1,137 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "startupschedulertest.h"
+#include "startupscheduler.h"
+
+#include <QThread>
+#include <QtTest/QtTest>
+
+void StartupSchedulerTest::dependencyOrderTest()
+{
+    StartupScheduler scheduler;
+    QStringList order;
+
+    scheduler.addStage("C", {"A", "B"}, StartupScheduler::MainThreadStage, [&]() { order.append(QSL("C")); });
+    scheduler.addStage("B", {"A"}, StartupScheduler::MainThreadStage, [&]() { order.append(QSL("B")); });
+    scheduler.addStage("A", {}, StartupScheduler::MainThreadStage, [&]() { order.append(QSL("A")); });
+
+    QSignalSpy finishedSpy(&scheduler, &StartupScheduler::finished);
+    QSignalSpy stageSpy(&scheduler, &StartupScheduler::stageFinished);
+
+    scheduler.start();
+
+    // Stages are started only once event loop is running
+    QVERIFY(order.isEmpty());
+
+    QTRY_COMPARE(finishedSpy.count(), 1);
+    QCOMPARE(order, QStringList({QSL("A"), QSL("B"), QSL("C")}));
+    QCOMPARE(stageSpy.count(), 3);
+    QVERIFY(scheduler.isFinished());
+}
+
+void StartupSchedulerTest::workerStageTest()
+{
+    StartupScheduler scheduler;
+    QThread* mainThread = QThread::currentThread();
+    QThread* workerThread = nullptr;
+    bool workerDone = false;
+    bool workerDoneInMain = false;
+
+    scheduler.addStage("Worker", {}, StartupScheduler::WorkerStage, [&]() {
+        workerThread = QThread::currentThread();
+        workerDone = true;
+    });
+    scheduler.addStage("Main", {"Worker"}, StartupScheduler::MainThreadStage, [&]() {
+        workerDoneInMain = workerDone;
+    });
+
+    QSignalSpy finishedSpy(&scheduler, &StartupScheduler::finished);
+    scheduler.start();
+
+    QTRY_COMPARE(finishedSpy.count(), 1);
+    QVERIFY(workerThread);
+    QVERIFY(workerThread != mainThread);
+    QVERIFY(workerDoneInMain);
+}
+
+void StartupSchedulerTest::readinessStageTest()
+{
+    StartupScheduler scheduler;
+    bool dependentRan = false;
+
+    scheduler.addStage("Early", {}, StartupScheduler::ReadinessStage);
+    scheduler.addStage("Ready", {"Early"}, StartupScheduler::ReadinessStage);
+    scheduler.addStage("Dependent", {"Ready"}, StartupScheduler::MainThreadStage, [&]() { dependentRan = true; });
+
+    // Marking ready before the stage is started finishes it once started
+    scheduler.markReady("Early");
+
+    QSignalSpy finishedSpy(&scheduler, &StartupScheduler::finished);
+    scheduler.start();
+
+    QTRY_VERIFY(scheduler.isStageFinished("Early"));
+    QTest::qWait(50);
+    QVERIFY(!scheduler.isStageFinished("Ready"));
+    QVERIFY(!dependentRan);
+
+    scheduler.markReady("Ready");
+    QVERIFY(dependentRan);
+    QCOMPARE(finishedSpy.count(), 1);
+}
+
+void StartupSchedulerTest::readinessTimeoutTest()
+{
+    StartupScheduler scheduler;
+    scheduler.addStage("Never", {}, StartupScheduler::ReadinessStage);
+    scheduler.setStageTimeout("Never", 10);
+
+    QSignalSpy finishedSpy(&scheduler, &StartupScheduler::finished);
+    scheduler.start();
+
+    QTRY_COMPARE(finishedSpy.count(), 1);
+    QVERIFY(scheduler.isStageFinished("Never"));
+}
+
+void StartupSchedulerTest::runAfterStageTest()
+{
+    StartupScheduler scheduler;
+    scheduler.addStage("Ready", {}, StartupScheduler::ReadinessStage);
+    scheduler.start();
+
+    int calls = 0;
+    scheduler.runAfterStage("Ready", this, [&]() { calls++; });
+
+    scheduler.markReady("Ready");
+    // Called in next event loop iteration
+    QCOMPARE(calls, 0);
+    QTRY_COMPARE(calls, 1);
+
+    // Already finished stage
+    scheduler.runAfterStage("Ready", this, [&]() { calls++; });
+    QCOMPARE(calls, 1);
+    QTRY_COMPARE(calls, 2);
+
+    // Context is destroyed before the stage is finished
+    QObject* context = new QObject;
+    scheduler.addStage("Later", {}, StartupScheduler::ReadinessStage);
+    scheduler.runAfterStage("Later", context, [&]() { calls++; });
+    delete context;
+    scheduler.markReady("Later");
+    QTest::qWait(50);
+    QCOMPARE(calls, 2);
+}
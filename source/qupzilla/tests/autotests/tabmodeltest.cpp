@@ -114,6 +114,7 @@ void TabModelTest::dataTest()
     QCOMPARE(model.index(0, 0).data(TabModel::PinnedRole).toBool(), tab0->isPinned());
     QCOMPARE(model.index(0, 0).data(TabModel::RestoredRole).toBool(), tab0->isRestored());
     QCOMPARE(model.index(0, 0).data(TabModel::CurrentTabRole).toBool(), true);
+    QCOMPARE(model.index(0, 0).data(TabModel::UrlRole).toUrl(), tab0->url());
 
     w->tabWidget()->addView(QUrl("http://test.com"));
 
@@ -0,0 +1,146 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "themecompilertest.h"
+#include "themecompiler.h"
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <QLineEdit>
+#include <QToolButton>
+
+class LocationBar : public QLineEdit
+{
+    Q_OBJECT
+};
+
+class TestLocationBar : public LocationBar
+{
+    Q_OBJECT
+};
+
+void ThemeCompilerTest::processTest()
+{
+    const QString qss = QSL("/* comment { } */\n"
+                            "QToolButton { border: none; }\n"
+                            "LocationBar {\n  padding: 2px;\n}\n"
+                            "LocationBar QToolButton, LocationBar:focus { margin: 0; }\n"
+                            "LocationBar, QLineEdit { color: red; }\n"
+                            "NavigationBar QLabel { font-weight: bold; }\n"
+                            "QLineEdit[placeholderText=\"a, b { }\"] { color: blue; }\n");
+
+    const CompiledTheme theme = ThemeCompiler::process(qss, QSL("theme"));
+
+    QCOMPARE(theme.styleSheet, QSL("QToolButton{border: none;}"
+                                   "LocationBar, QLineEdit{color: red;}"
+                                   "QLineEdit[placeholderText=\"a, b { }\"]{color: blue;}"));
+
+    QCOMPARE(theme.scopedStyleSheets.size(), 2);
+    QCOMPARE(theme.scopedStyleSheets.at(0).first, QSL("LocationBar"));
+    QCOMPARE(theme.scopedStyleSheets.at(0).second, QSL("LocationBar{padding: 2px;}"
+                                                       "LocationBar QToolButton, LocationBar:focus{margin: 0;}"));
+    QCOMPARE(theme.scopedStyleSheets.at(1).first, QSL("NavigationBar"));
+    QCOMPARE(theme.scopedStyleSheets.at(1).second, QSL("NavigationBar QLabel{font-weight: bold;}"));
+}
+
+void ThemeCompilerTest::urlRewriteTest()
+{
+    const CompiledTheme theme = ThemeCompiler::process(QSL("QWidget { image: url(images/a.png); }\n"
+                                                           "QLabel { image: url(:icons/b.png); }"), QSL("themes/default"));
+
+    QCOMPARE(theme.styleSheet, QSL("QWidget{image: url(themes/default/images/a.png);}"
+                                   "QLabel{image: url(:icons/b.png);}"));
+}
+
+void ThemeCompilerTest::cacheTest()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QString themePath = dir.path() + QL1S("/theme");
+    const QString cachePath = dir.path() + QL1S("/cache");
+    QVERIFY(QDir().mkpath(themePath));
+
+    QFile file(themePath + QL1S("/main.css"));
+    QVERIFY(file.open(QFile::WriteOnly));
+    file.write("QWidget { color: red; }");
+    file.close();
+
+    ThemeCompiler compiler(cachePath);
+    const QStringList files = QStringList() << file.fileName() << themePath + QL1S("/missing.css");
+
+    const CompiledTheme theme = compiler.compile(themePath, files);
+    QCOMPARE(theme.styleSheet, QSL("QWidget{color: red;}"));
+    QCOMPARE(QDir(cachePath).entryList(QDir::Files).size(), 1);
+
+    // Cached result is used
+    QCOMPARE(compiler.compile(themePath, files).styleSheet, theme.styleSheet);
+
+    // Modified file gets recompiled
+    QVERIFY(file.open(QFile::WriteOnly));
+    file.write("QWidget { color: blue; }");
+    file.close();
+
+    const QStringList oldEntries = QDir(cachePath).entryList(QDir::Files);
+    QCOMPARE(compiler.compile(themePath, files).styleSheet, QSL("QWidget{color: blue;}"));
+
+    // Stale entry is removed
+    const QStringList entries = QDir(cachePath).entryList(QDir::Files);
+    QCOMPARE(entries.size(), 1);
+    QVERIFY(entries != oldEntries);
+}
+
+void ThemeCompilerTest::applyTest()
+{
+    const QString appStyleSheet = qApp->styleSheet();
+
+    CompiledTheme theme;
+    theme.styleSheet = QSL("QToolButton{border: none;}");
+    theme.scopedStyleSheets.append(qMakePair(QSL("LocationBar"), QSL("LocationBar{padding: 2px;}")));
+
+    ThemeCompiler compiler(QString());
+
+    QLineEdit lineEdit;
+    TestLocationBar locationBar;
+    locationBar.setStyleSheet(QSL("QLineEdit{margin: 1px;}"));
+    locationBar.ensurePolished();
+
+    compiler.apply(theme);
+
+    QCOMPARE(qApp->styleSheet(), theme.styleSheet);
+    QCOMPARE(locationBar.styleSheet(), QSL("LocationBar{padding: 2px;}QLineEdit{margin: 1px;}"));
+
+    // New widgets get scoped rules when polished
+    TestLocationBar locationBar2;
+    locationBar2.ensurePolished();
+    lineEdit.ensurePolished();
+    QCOMPARE(locationBar2.styleSheet(), QSL("LocationBar{padding: 2px;}"));
+    QCOMPARE(lineEdit.styleSheet(), QString());
+
+    // Applying new theme replaces scoped rules
+    theme.scopedStyleSheets[0].second = QSL("LocationBar{padding: 4px;}");
+    compiler.apply(theme);
+    QCOMPARE(locationBar.styleSheet(), QSL("LocationBar{padding: 4px;}QLineEdit{margin: 1px;}"));
+    QCOMPARE(locationBar2.styleSheet(), QSL("LocationBar{padding: 4px;}"));
+
+    compiler.apply(CompiledTheme());
+    QCOMPARE(locationBar.styleSheet(), QSL("QLineEdit{margin: 1px;}"));
+
+    qApp->setStyleSheet(appStyleSheet);
+}
+
+#include "themecompilertest.moc"
@@ -0,0 +1,149 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "aesinterface.h"
+
+#include <QtTest/QtTest>
+
+// Number of password entries, each has encrypted username, password and form data
+static const int s_entriesCount = 1000;
+
+class AesDecryptBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void decryptEntries_data();
+    void decryptEntries();
+
+    void encryptEntries_data();
+    void encryptEntries();
+
+private:
+    struct Entry {
+        QByteArray username;
+        QByteArray password;
+        QByteArray data;
+    };
+
+    QByteArray m_masterPassword;
+    QVector<Entry> m_plainEntries;
+    QVector<Entry> m_encryptedEntries;
+};
+
+void AesDecryptBenchmark::initTestCase()
+{
+    m_masterPassword = AesInterface::passwordToHash(QSL("master password"));
+
+    AesInterface aes;
+    for (int i = 0; i < s_entriesCount; ++i) {
+        Entry plain;
+        plain.username = QSL("user%1@example.com").arg(i).toUtf8();
+        plain.password = QSL("password-%1").arg(i * 7919).toUtf8();
+        plain.data = QSL("login=user%1%40example.com&password=password-%2&remember=on&csrf=%3")
+                     .arg(i).arg(i * 7919).arg(QString::fromLatin1(AesInterface::createRandomData(16).toHex())).toUtf8();
+        m_plainEntries.append(plain);
+
+        Entry encrypted;
+        encrypted.username = aes.encrypt(plain.username, m_masterPassword);
+        encrypted.password = aes.encrypt(plain.password, m_masterPassword);
+        encrypted.data = aes.encrypt(plain.data, m_masterPassword);
+        QVERIFY(aes.isOk());
+        m_encryptedEntries.append(encrypted);
+    }
+}
+
+void AesDecryptBenchmark::decryptEntries_data()
+{
+    QTest::addColumn<bool>("shared");
+
+    // Previous behavior: new AesInterface and key derivation for each field
+    QTest::newRow("per field contexts") << false;
+    QTest::newRow("shared context") << true;
+}
+
+void AesDecryptBenchmark::decryptEntries()
+{
+    QFETCH(bool, shared);
+
+    // Results are for all entries, divide by s_entriesCount for per-entry cost
+    QBENCHMARK {
+        AesInterface sharedAes;
+
+        for (int i = 0; i < m_encryptedEntries.count(); ++i) {
+            const Entry &entry = m_encryptedEntries.at(i);
+
+            if (shared) {
+                sharedAes.decrypt(entry.username, m_masterPassword);
+                sharedAes.decrypt(entry.password, m_masterPassword);
+                sharedAes.decrypt(entry.data, m_masterPassword);
+            }
+            else {
+                AesInterface aes;
+                aes.decrypt(entry.username, m_masterPassword);
+                aes.clearKey();
+                aes.decrypt(entry.password, m_masterPassword);
+                aes.clearKey();
+                aes.decrypt(entry.data, m_masterPassword);
+            }
+        }
+    }
+
+    // Both paths must produce the same output
+    AesInterface aes;
+    for (int i = 0; i < m_encryptedEntries.count(); i += 97) {
+        QCOMPARE(aes.decrypt(m_encryptedEntries.at(i).data, m_masterPassword), m_plainEntries.at(i).data);
+        QVERIFY(aes.isOk());
+    }
+}
+
+void AesDecryptBenchmark::encryptEntries_data()
+{
+    decryptEntries_data();
+}
+
+void AesDecryptBenchmark::encryptEntries()
+{
+    QFETCH(bool, shared);
+
+    QBENCHMARK {
+        AesInterface sharedAes;
+
+        for (int i = 0; i < m_plainEntries.count(); ++i) {
+            const Entry &entry = m_plainEntries.at(i);
+
+            if (shared) {
+                sharedAes.encrypt(entry.username, m_masterPassword);
+                sharedAes.encrypt(entry.password, m_masterPassword);
+                sharedAes.encrypt(entry.data, m_masterPassword);
+            }
+            else {
+                AesInterface aes;
+                aes.encrypt(entry.username, m_masterPassword);
+                aes.clearKey();
+                aes.encrypt(entry.password, m_masterPassword);
+                aes.clearKey();
+                aes.encrypt(entry.data, m_masterPassword);
+            }
+        }
+    }
+}
+
+QTEST_MAIN(AesDecryptBenchmark)
+#include "aesdecrypt.moc"
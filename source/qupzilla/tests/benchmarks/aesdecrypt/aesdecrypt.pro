@@ -0,0 +1,4 @@
+include(../benchmarks.pri)
+
+TARGET = aesdecrypt
+SOURCES = aesdecrypt.cpp
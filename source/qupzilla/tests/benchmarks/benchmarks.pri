@@ -1,11 +1,6 @@
 include($$PWD/../../src/defines.pri)
 
-isEqual(QT_MAJOR_VERSION, 5) {
-    QT += webkitwidgets network widgets printsupport sql script gui-private testlib
-} else {
-    QT += core gui webkit sql network script
-    CONFIG += qtestlib
-}
+QT += webenginewidgets network widgets printsupport sql script qml gui-private testlib
 
 !unix|mac: LIBS += -L$$PWD/../../bin -lQupZilla
 !mac:unix: LIBS += $$PWD/../../bin/libQupZilla.so
@@ -23,6 +18,7 @@ INCLUDEPATH += $$PWD/../../src/lib/3rdparty \
                $$PWD/../../src/lib/app \
                $$PWD/../../src/lib/autofill \
                $$PWD/../../src/lib/bookmarks \
+               $$PWD/../../src/lib/bookmarks/bookmarksimport \
                $$PWD/../../src/lib/cookies \
                $$PWD/../../src/lib/downloads \
                $$PWD/../../src/lib/history \
@@ -34,10 +30,11 @@ INCLUDEPATH += $$PWD/../../src/lib/3rdparty \
                $$PWD/../../src/lib/plugins \
                $$PWD/../../src/lib/popupwindow \
                $$PWD/../../src/lib/preferences \
+               $$PWD/../../src/lib/readingmode \
                $$PWD/../../src/lib/rss \
                $$PWD/../../src/lib/session \
                $$PWD/../../src/lib/sidebar \
                $$PWD/../../src/lib/tabwidget \
                $$PWD/../../src/lib/tools \
-               $$PWD/../../src/lib/webkit \
+               $$PWD/../../src/lib/webengine \
                $$PWD/../../src/lib/webtab \
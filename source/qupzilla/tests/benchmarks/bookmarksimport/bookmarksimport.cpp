@@ -0,0 +1,165 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "htmlimporter.h"
+#include "firefoximporter.h"
+#include "bookmarkitem.h"
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+
+// Imports 50k bookmarks (in 500 folders) from HTML file and Firefox places.sqlite
+class BookmarksImport : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void htmlImport();
+    void firefoxImport();
+
+private:
+    static int countItems(BookmarkItem* item);
+
+    QTemporaryDir m_dir;
+    QString m_htmlFile;
+    QString m_placesFile;
+};
+
+static const int s_folders = 500;
+static const int s_bookmarksPerFolder = 100;
+
+void BookmarksImport::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+
+    // Netscape bookmark file, as exported by Firefox
+    m_htmlFile = m_dir.path() + QL1S("/bookmarks.html");
+
+    QFile file(m_htmlFile);
+    QVERIFY(file.open(QFile::WriteOnly));
+
+    QTextStream stream(&file);
+    stream.setCodec("UTF-8");
+    stream << "<!DOCTYPE NETSCAPE-Bookmark-file-1>\n"
+           << "<!-- This is an automatically generated file. -->\n"
+           << "<META HTTP-EQUIV=\"Content-Type\" CONTENT=\"text/html; charset=UTF-8\">\n"
+           << "<TITLE>Bookmarks</TITLE>\n<H1>Bookmarks Menu</H1>\n\n<DL><p>\n";
+    for (int i = 0; i < s_folders; ++i) {
+        stream << "    <DT><H3 ADD_DATE=\"1500000000\" LAST_MODIFIED=\"1500000000\">Folder " << i << "</H3>\n    <DL><p>\n";
+        for (int j = 0; j < s_bookmarksPerFolder; ++j) {
+            stream << "        <DT><A HREF=\"https://www.example" << i << ".com/page/" << j << "?a=1&amp;b=2\" ADD_DATE=\"1500000000\">"
+                   << "Bookmark &quot;" << j << "&quot; in folder " << i << "</A>\n";
+        }
+        stream << "    </DL><p>\n";
+    }
+    stream << "</DL><p>\n";
+    stream.flush();
+    file.close();
+
+    // Firefox places database
+    m_placesFile = m_dir.path() + QL1S("/places.sqlite");
+
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase(QSL("QSQLITE"), QSL("benchmark-places"));
+        db.setDatabaseName(m_placesFile);
+        QVERIFY(db.open());
+
+        QSqlQuery query(db);
+        QVERIFY(query.exec(QSL("CREATE TABLE moz_places (id INTEGER PRIMARY KEY, url LONGVARCHAR)")));
+        QVERIFY(query.exec(QSL("CREATE TABLE moz_bookmarks (id INTEGER PRIMARY KEY, type INTEGER, fk INTEGER DEFAULT NULL, "
+                               "parent INTEGER, position INTEGER, title LONGVARCHAR)")));
+
+        db.transaction();
+        int id = 1;
+        for (int i = 0; i < s_folders; ++i) {
+            for (int j = 0; j < s_bookmarksPerFolder; ++j, ++id) {
+                query.prepare(QSL("INSERT INTO moz_places (id, url) VALUES (?, ?)"));
+                query.addBindValue(id);
+                query.addBindValue(QSL("https://www.example%1.com/page/%2").arg(i).arg(j));
+                query.exec();
+
+                query.prepare(QSL("INSERT INTO moz_bookmarks (id, type, fk, parent, position, title) VALUES (?, 1, ?, 2, ?, ?)"));
+                query.addBindValue(id);
+                query.addBindValue(id);
+                query.addBindValue(j);
+                query.addBindValue(QSL("Bookmark %1 in folder %2").arg(j).arg(i));
+                query.exec();
+            }
+        }
+        db.commit();
+    }
+    QSqlDatabase::removeDatabase(QSL("benchmark-places"));
+}
+
+int BookmarksImport::countItems(BookmarkItem* item)
+{
+    int count = 1;
+    foreach (BookmarkItem* child, item->children()) {
+        count += countItems(child);
+    }
+    return count;
+}
+
+void BookmarksImport::htmlImport()
+{
+    BookmarkItem* root = 0;
+
+    QBENCHMARK {
+        delete root;
+
+        HtmlImporter importer;
+        importer.setPath(m_htmlFile);
+        QVERIFY(importer.prepareImport());
+        root = importer.importBookmarks();
+        QVERIFY(!importer.error());
+    }
+
+    QCOMPARE(root->children().count(), s_folders);
+    QCOMPARE(root->children().first()->children().count(), s_bookmarksPerFolder);
+    QCOMPARE(root->children().first()->children().first()->title(), QSL("Bookmark \"0\" in folder 0"));
+    QCOMPARE(root->children().first()->children().first()->url(), QUrl(QSL("https://www.example0.com/page/0?a=1&b=2")));
+    QCOMPARE(countItems(root), 1 + s_folders + s_folders * s_bookmarksPerFolder);
+
+    delete root;
+}
+
+void BookmarksImport::firefoxImport()
+{
+    BookmarkItem* root = 0;
+
+    QBENCHMARK {
+        delete root;
+
+        FirefoxImporter importer;
+        importer.setPath(m_placesFile);
+        QVERIFY(importer.prepareImport());
+        root = importer.importBookmarks();
+        QVERIFY(!importer.error());
+    }
+
+    QCOMPARE(countItems(root), 1 + s_folders * s_bookmarksPerFolder);
+    QCOMPARE(root->children().first()->url(), QUrl(QSL("https://www.example0.com/page/0")));
+
+    delete root;
+}
+
+QTEST_MAIN(BookmarksImport)
+#include "bookmarksimport.moc"
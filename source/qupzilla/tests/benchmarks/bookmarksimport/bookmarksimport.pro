@@ -0,0 +1,4 @@
+include(../benchmarks.pri)
+
+TARGET = bookmarksimport
+SOURCES = bookmarksimport.cpp
@@ -0,0 +1,143 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "readingmodeextractor.h"
+#include "readingmodemanager.h"
+
+#include <QtTest/QtTest>
+#include <QWebEnginePage>
+
+// Compares native ReadingModeExtractor with the JavaScript extraction
+// over a corpus of saved article pages in ../files/articles
+class ReadingModeExtract : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void nativeExtraction_data();
+    void nativeExtraction();
+
+    void compareWithJavaScript_data();
+    void compareWithJavaScript();
+
+private:
+    void addCorpus();
+    QString readFile(const QString &fileName) const;
+};
+
+void ReadingModeExtract::addCorpus()
+{
+    QTest::addColumn<QString>("fileName");
+
+    const QDir dir(QSL("../files/articles"));
+    foreach (const QString &fileName, dir.entryList(QStringList(QSL("*.html")), QDir::Files)) {
+        QTest::newRow(fileName.toUtf8().constData()) << dir.absoluteFilePath(fileName);
+    }
+}
+
+QString ReadingModeExtract::readFile(const QString &fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QFile::ReadOnly)) {
+        return QString();
+    }
+    return QString::fromUtf8(file.readAll());
+}
+
+void ReadingModeExtract::nativeExtraction_data()
+{
+    addCorpus();
+}
+
+void ReadingModeExtract::nativeExtraction()
+{
+    QFETCH(QString, fileName);
+
+    const QString html = readFile(fileName);
+    const QUrl url = QUrl::fromLocalFile(fileName);
+    QVERIFY(!html.isEmpty());
+
+    ReadingModeArticle article;
+    QBENCHMARK {
+        article = ReadingModeExtractor::extract(html, url);
+    }
+
+    QVERIFY(article.isValid());
+}
+
+void ReadingModeExtract::compareWithJavaScript_data()
+{
+    addCorpus();
+}
+
+void ReadingModeExtract::compareWithJavaScript()
+{
+    QFETCH(QString, fileName);
+
+    const QUrl url = QUrl::fromLocalFile(fileName);
+
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+    page.load(url);
+    QVERIFY(loadSpy.wait(10000));
+
+    QString html;
+    page.toHtml([&html](const QString &result) {
+        html = result;
+    });
+    QTRY_VERIFY(!html.isEmpty());
+
+    QElapsedTimer timer;
+
+    timer.start();
+    const ReadingModeArticle nativeArticle = ReadingModeExtractor::extract(html, url);
+    const qint64 nativeTime = timer.nsecsElapsed();
+
+    QVariantMap jsResult;
+    bool jsFinished = false;
+    timer.start();
+    page.runJavaScript(ReadingModeManager::getExtractionScript(), [&](const QVariant &result) {
+        jsResult = result.toMap();
+        jsFinished = true;
+    });
+    QTRY_VERIFY(jsFinished);
+    const qint64 jsTime = timer.nsecsElapsed();
+
+    const QString nativeText = ReadingModeExtractor::toPlainText(nativeArticle.content);
+    const QString jsText = ReadingModeExtractor::toPlainText(jsResult.value(QSL("content")).toString());
+
+    // Share of JS output words also present in the native output
+    const QSet<QString> nativeWords = nativeText.split(QL1C(' '), QString::SkipEmptyParts).toSet();
+    const QStringList jsWords = jsText.split(QL1C(' '), QString::SkipEmptyParts);
+    int common = 0;
+    foreach (const QString &word, jsWords) {
+        if (nativeWords.contains(word)) {
+            ++common;
+        }
+    }
+    const double overlap = jsWords.isEmpty() ? 1.0 : double(common) / jsWords.size();
+
+    qDebug() << "native:" << nativeTime / 1000 << "us," << nativeText.size() << "chars"
+             << "| js:" << jsTime / 1000 << "us," << jsText.size() << "chars"
+             << "| overlap:" << overlap;
+
+    QCOMPARE(nativeArticle.title, jsResult.value(QSL("title")).toString().simplified());
+    QVERIFY(overlap > 0.8);
+}
+
+QTEST_MAIN(ReadingModeExtract)
+#include "readingmodeextract.moc"
@@ -0,0 +1,4 @@
+include(../benchmarks.pri)
+
+TARGET = readingmodeextract
+SOURCES = readingmodeextract.cpp
@@ -0,0 +1,229 @@
+/* ============================================================
+* QupZilla - Qt web browser
+* Copyright (C) 2026 QupZilla for webOS contributors
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+* ============================================================ */
+#include "themecompiler.h"
+
+#include <QtTest/QtTest>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QMainWindow>
+#include <QTabBar>
+#include <QTemporaryDir>
+#include <QToolBar>
+#include <QToolButton>
+
+// Stand-ins for QupZilla widgets, only class names matter for style sheets
+class LocationBar : public QLineEdit
+{
+    Q_OBJECT
+};
+
+class NavigationBar : public QWidget
+{
+    Q_OBJECT
+};
+
+class TabBar : public QTabBar
+{
+    Q_OBJECT
+};
+
+class ThemeCompilerBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void windowCreation_data();
+    void windowCreation();
+
+    void tabCreation_data();
+    void tabCreation();
+
+    void compile_data();
+    void compile();
+
+private:
+    void applyTheme(bool compiled);
+    QWidget* createNavigationBar(QWidget* parent) const;
+
+    QTemporaryDir m_dir;
+    QString m_themePath;
+    QString m_qss;
+    ThemeCompiler* m_compiler;
+};
+
+// Theme similar in size to the default one: generic rules for Qt classes
+// and most of the rules for QupZilla classes
+static QString createTheme()
+{
+    QString qss;
+    const QStringList qtClasses = QStringList() << QSL("QToolButton") << QSL("QLineEdit") << QSL("QMenu") << QSL("QLabel");
+    const QStringList qzClasses = QStringList() << QSL("LocationBar") << QSL("NavigationBar") << QSL("TabBar");
+
+    for (int i = 0; i < 50; ++i) {
+        foreach (const QString &cls, qtClasses) {
+            qss += QSL("%1#item%2:hover {\n    /* hover state */\n    background: url(images/item%2.png);\n    color: #%3;\n}\n")
+                   .arg(cls).arg(i).arg(i * 1000 % 0xffffff, 6, 16, QL1C('0'));
+        }
+        foreach (const QString &cls, qzClasses) {
+            qss += QSL("%1 QToolButton#button%2 {\n    margin: %2px;\n    border-image: url(images/button%2.png);\n}\n").arg(cls).arg(i);
+            qss += QSL("%1[property%2=\"true\"] {\n    padding: 1px;\n}\n").arg(cls).arg(i);
+        }
+    }
+
+    return qss;
+}
+
+void ThemeCompilerBenchmark::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+
+    m_themePath = m_dir.path() + QL1S("/theme");
+    QVERIFY(QDir().mkpath(m_themePath));
+
+    m_qss = createTheme();
+
+    QFile file(m_themePath + QL1S("/main.css"));
+    QVERIFY(file.open(QFile::WriteOnly));
+    file.write(m_qss.toUtf8());
+    file.close();
+
+    m_compiler = new ThemeCompiler(m_dir.path() + QL1S("/cache"), this);
+}
+
+void ThemeCompilerBenchmark::cleanupTestCase()
+{
+    m_compiler->apply(CompiledTheme());
+}
+
+void ThemeCompilerBenchmark::applyTheme(bool compiled)
+{
+    if (compiled) {
+        m_compiler->apply(m_compiler->compile(m_themePath, QStringList(m_themePath + QL1S("/main.css"))));
+    }
+    else {
+        // Application wide style sheet, as before ThemeCompiler
+        m_compiler->apply(CompiledTheme());
+        const QString relativePath = QDir::current().relativeFilePath(m_themePath);
+        QString qss = m_qss;
+        qss.replace(QRegularExpression(QSL("url\\s*\\(\\s*([^\\*:\\);]+)\\s*\\)")), QString("url(%1/\\1)").arg(relativePath));
+        qApp->setStyleSheet(qss);
+    }
+}
+
+QWidget* ThemeCompilerBenchmark::createNavigationBar(QWidget* parent) const
+{
+    NavigationBar* navigationBar = new NavigationBar;
+    navigationBar->setParent(parent);
+
+    QHBoxLayout* layout = new QHBoxLayout(navigationBar);
+    for (int i = 0; i < 6; ++i) {
+        QToolButton* button = new QToolButton(navigationBar);
+        button->setObjectName(QSL("button%1").arg(i));
+        layout->addWidget(button);
+    }
+    layout->addWidget(new LocationBar);
+    layout->addWidget(new QLineEdit);
+
+    return navigationBar;
+}
+
+void ThemeCompilerBenchmark::windowCreation_data()
+{
+    QTest::addColumn<bool>("compiled");
+
+    QTest::newRow("application stylesheet") << false;
+    QTest::newRow("compiled theme") << true;
+}
+
+void ThemeCompilerBenchmark::windowCreation()
+{
+    QFETCH(bool, compiled);
+
+    applyTheme(compiled);
+
+    QBENCHMARK {
+        QMainWindow window;
+        QToolBar* toolBar = window.addToolBar(QSL("Navigation"));
+        toolBar->addWidget(createNavigationBar(toolBar));
+
+        QWidget* central = new QWidget(&window);
+        QVBoxLayout* layout = new QVBoxLayout(central);
+        TabBar* tabBar = new TabBar;
+        for (int i = 0; i < 5; ++i) {
+            tabBar->addTab(QSL("Tab %1").arg(i));
+        }
+        layout->addWidget(tabBar);
+        for (int i = 0; i < 20; ++i) {
+            layout->addWidget(new QLabel(QSL("Label %1").arg(i)));
+        }
+        window.setCentralWidget(central);
+
+        window.ensurePolished();
+    }
+}
+
+void ThemeCompilerBenchmark::tabCreation_data()
+{
+    windowCreation_data();
+}
+
+void ThemeCompilerBenchmark::tabCreation()
+{
+    QFETCH(bool, compiled);
+
+    applyTheme(compiled);
+
+    QWidget parent;
+
+    // Each tab has its own navigation widgets (LocationBar, buttons)
+    QBENCHMARK {
+        QWidget* tab = createNavigationBar(&parent);
+        tab->ensurePolished();
+        delete tab;
+    }
+}
+
+void ThemeCompilerBenchmark::compile_data()
+{
+    QTest::addColumn<bool>("cached");
+
+    QTest::newRow("no cache") << false;
+    QTest::newRow("cache") << true;
+}
+
+void ThemeCompilerBenchmark::compile()
+{
+    QFETCH(bool, cached);
+
+    ThemeCompiler compiler(cached ? m_dir.path() + QL1S("/compile-cache") : QString());
+    const QStringList files(m_themePath + QL1S("/main.css"));
+
+    // Fill the cache
+    compiler.compile(m_themePath, files);
+
+    QBENCHMARK {
+        compiler.compile(m_themePath, files);
+    }
+}
+
+QTEST_MAIN(ThemeCompilerBenchmark)
+#include "themecompiler.moc"
@@ -0,0 +1,4 @@
+include(../benchmarks.pri)
+
+TARGET = themecompiler
+SOURCES = themecompiler.cpp